@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/CBCentralManager+StateString.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/CBCentralManager+StateString.h
\ No newline at end of file
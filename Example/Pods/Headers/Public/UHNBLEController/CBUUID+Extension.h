@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/CBUUID+Extension.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/CBUUID+Extension.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/NSData+ConversionExtensions.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/NSData+ConversionExtensions.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/NSData+RACPCommands.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/NSData+RACPCommands.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/NSData+RACPParser.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/NSData+RACPParser.h
\ No newline at end of file
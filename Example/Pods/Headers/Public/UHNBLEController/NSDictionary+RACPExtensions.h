@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/NSDictionary+RACPExtensions.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/NSDictionary+RACPExtensions.h
\ No newline at end of file
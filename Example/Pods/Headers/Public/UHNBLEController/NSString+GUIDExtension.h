@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/NSString+GUIDExtension.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/NSString+GUIDExtension.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/UHNBLEConstants.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/UHNBLEConstants.h
\ No newline at end of file
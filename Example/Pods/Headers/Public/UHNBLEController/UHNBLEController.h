@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/UHNBLEController.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/UHNBLEController.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/UHNBLETypes.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/UHNBLETypes.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/UHNRACPConstants.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/UHNRACPConstants.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNBLEController/Pod/Classes/UHNRecordAccessControlPoint.h
\ No newline at end of file
+../../../../../LocalPods/UHNBLEController/Pod/Classes/UHNRecordAccessControlPoint.h
\ No newline at end of file
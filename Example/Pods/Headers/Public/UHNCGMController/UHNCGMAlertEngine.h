@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMAlertEngine.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMCalibration.h
\ No newline at end of file
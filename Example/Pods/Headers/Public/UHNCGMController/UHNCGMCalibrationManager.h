@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMCalibrationManager.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMCommunicationPolicyEngine.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMFeatures.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMGapDetector.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMGlucoseProfile.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMMeasurement.h
\ No newline at end of file
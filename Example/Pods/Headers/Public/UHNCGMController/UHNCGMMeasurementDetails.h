@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMMeasurementDetails.h
\ No newline at end of file
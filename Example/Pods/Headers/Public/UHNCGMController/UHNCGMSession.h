@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMSession.h
\ No newline at end of file
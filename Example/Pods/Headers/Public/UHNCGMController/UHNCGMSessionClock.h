@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMSessionClock.h
\ No newline at end of file
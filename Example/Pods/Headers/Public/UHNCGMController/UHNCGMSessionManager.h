@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMSessionManager.h
\ No newline at end of file
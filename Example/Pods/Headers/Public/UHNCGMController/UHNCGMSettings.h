@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMSettings.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMStatistics.h
\ No newline at end of file
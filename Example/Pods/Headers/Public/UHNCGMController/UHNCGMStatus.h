@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMStatus.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../Pod/Classes/UHNCGMTrendEstimator.h
\ No newline at end of file
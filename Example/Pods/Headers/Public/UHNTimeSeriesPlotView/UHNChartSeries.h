@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNChartSeries.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNDecimationPyramid.h
\ No newline at end of file
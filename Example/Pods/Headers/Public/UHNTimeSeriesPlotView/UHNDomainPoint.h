@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNDomainPoint.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNDomainPoint.h
\ No newline at end of file
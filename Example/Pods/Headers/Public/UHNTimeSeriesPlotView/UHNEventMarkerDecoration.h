@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNEventMarkerDecoration.h
\ No newline at end of file
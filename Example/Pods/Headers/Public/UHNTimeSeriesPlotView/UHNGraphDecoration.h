@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNGraphDecoration.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNGraphDecoration.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNGraphGridLines.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNGraphGridLines.h
\ No newline at end of file
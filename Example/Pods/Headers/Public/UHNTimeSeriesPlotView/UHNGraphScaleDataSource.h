@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNGraphScaleDataSource.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNGraphScaleDataSource.h
\ No newline at end of file
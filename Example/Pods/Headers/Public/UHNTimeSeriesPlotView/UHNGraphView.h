@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNGraphView.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNGraphView.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNScaleLayout.h
\ No newline at end of file
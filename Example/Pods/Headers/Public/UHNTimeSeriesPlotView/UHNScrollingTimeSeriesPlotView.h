@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNScrollingTimeSeriesPlotView.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNScrollingTimeSeriesPlotView.h
\ No newline at end of file
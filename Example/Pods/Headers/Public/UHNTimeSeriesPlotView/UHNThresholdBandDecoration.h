@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNThresholdBandDecoration.h
\ No newline at end of file
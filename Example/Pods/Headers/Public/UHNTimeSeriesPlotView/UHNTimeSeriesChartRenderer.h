@@ -0,0 +1 @@
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNTimeSeriesChartRenderer.h
\ No newline at end of file
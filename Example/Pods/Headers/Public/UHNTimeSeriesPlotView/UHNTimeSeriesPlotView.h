@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNTimeSeriesPlotView.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNTimeSeriesPlotView.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNXRealScale.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNXRealScale.h
\ No newline at end of file
@@ -1 +1 @@
-../../../UHNTimeSeriesPlotView/Pod/Classes/UHNYRealScale.h
\ No newline at end of file
+../../../../../LocalPods/UHNTimeSeriesPlotView/Pod/Classes/UHNYRealScale.h
\ No newline at end of file
@@ -1,12 +0,0 @@
-//
-//  UHNTimeSeriesPlotView.h
-//  Pods
-//
-//  Created by Nathaniel Hamming on 2015-02-12.
-//
-//
-
-#import "UHNScrollingTimeSeriesPlotView.h"
-#import "UHNGraphGridLines.h"
-#import "UHNXRealScale.h"
-#import "UHNYRealScale.h"
\ No newline at end of file
@@ -0,0 +1,101 @@
+//
+//  CGMAlertEngineTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMAlertEngine.h>
+
+SpecBegin(CGMAlertEngineSpecs)
+
+describe(@"CGM host-side alerts", ^{
+
+    __block UHNCGMAlertEngine *alertEngine;
+    __block CGMAlertOption clearedAlerts;
+
+    beforeEach(^{
+        alertEngine = [[UHNCGMAlertEngine alloc] init];
+        clearedAlerts = 0;
+    });
+
+    it(@"should not raise alerts in range", ^{
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:120 rateOfChange:0 atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(raisedAlerts).to.equal(0);
+        expect(clearedAlerts).to.equal(0);
+        expect(alertEngine.activeAlerts).to.equal(0);
+    });
+
+    it(@"should raise glucose level alerts once", ^{
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:50 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(CGMAlertHypo | CGMAlertPatientLow);
+
+        raisedAlerts = [alertEngine evaluateGlucoseConcentration:48 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(0);
+        expect(alertEngine.activeAlerts).to.equal(CGMAlertHypo | CGMAlertPatientLow);
+
+        raisedAlerts = [alertEngine evaluateGlucoseConcentration:500 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(raisedAlerts).to.equal(CGMAlertPatientHigh | CGMAlertHyper);
+        expect(clearedAlerts).to.equal(CGMAlertHypo | CGMAlertPatientLow);
+    });
+
+    it(@"should apply hysteresis before clearing an alert", ^{
+        [alertEngine evaluateGlucoseConcentration:65 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+
+        // just above the threshold, but within the hysteresis margin
+        [alertEngine evaluateGlucoseConcentration:kCGMAlertDefaultLevelPatientLow + 1 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(clearedAlerts).to.equal(0);
+        expect(alertEngine.activeAlerts).to.equal(CGMAlertPatientLow);
+
+        // dipping below the threshold again does not raise the alert again
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:68 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(0);
+
+        [alertEngine evaluateGlucoseConcentration:kCGMAlertDefaultLevelPatientLow + kCGMAlertDefaultGlucoseHysteresis rateOfChange:NAN atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(clearedAlerts).to.equal(CGMAlertPatientLow);
+        expect(alertEngine.activeAlerts).to.equal(0);
+    });
+
+    it(@"should raise rate alerts", ^{
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:200 rateOfChange:-3.5 atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(CGMAlertRateDecrease);
+
+        raisedAlerts = [alertEngine evaluateGlucoseConcentration:200 rateOfChange:3.5 atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(raisedAlerts).to.equal(CGMAlertRateIncrease);
+        expect(clearedAlerts).to.equal(CGMAlertRateDecrease);
+    });
+
+    it(@"should raise a predicted hypo alert", ^{
+        // 100 - 2.5 * 20 = 50 mg/dl in 20 minutes
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:100 rateOfChange:-2.5 atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(CGMAlertPredictedHypo);
+    });
+
+    it(@"should only evaluate the enabled alerts", ^{
+        alertEngine.enabledAlerts = CGMAlertHypo;
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:50 rateOfChange:-3.5 atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(CGMAlertHypo);
+    });
+
+    it(@"should raise a snoozed alert again once the snooze expires", ^{
+        [alertEngine evaluateGlucoseConcentration:50 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        [alertEngine snoozeAlerts:CGMAlertHypo forTimeInterval:15 * 60];
+
+        CGMAlertOption raisedAlerts = [alertEngine evaluateGlucoseConcentration:50 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(0);
+
+        raisedAlerts = [alertEngine evaluateGlucoseConcentration:50 rateOfChange:NAN atDate:[NSDate dateWithTimeIntervalSinceNow:16 * 60] clearedAlerts:NULL];
+        expect(raisedAlerts).to.equal(CGMAlertHypo);
+    });
+
+    it(@"should report a snoozed alert as cleared", ^{
+        [alertEngine evaluateGlucoseConcentration:50 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:NULL];
+        [alertEngine snoozeAlerts:CGMAlertHypo forTimeInterval:15 * 60];
+
+        [alertEngine evaluateGlucoseConcentration:65 rateOfChange:NAN atDate:[NSDate date] clearedAlerts:&clearedAlerts];
+        expect(clearedAlerts).to.equal(CGMAlertHypo);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,127 @@
+//
+//  CGMCalibrationManagerTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMCalibrationManager.h>
+#import <UHNCGMController/UHNCGMConstants.h>
+
+@interface CalibrationReminderRecorder : NSObject <UHNCGMCalibrationManagerDelegate>
+@property(nonatomic,strong) NSDate *nextCalibrationDate;
+@end
+
+@implementation CalibrationReminderRecorder
+
+- (void)calibrationManager:(UHNCGMCalibrationManager*)calibrationManager didReachNextCalibrationDate:(NSDate*)nextCalibrationDate forSession:(UHNCGMSession*)session
+{
+    self.nextCalibrationDate = nextCalibrationDate;
+}
+
+@end
+
+static NSDictionary *CalibrationDetails(NSUInteger recordNumber, NSUInteger timeOffset, NSUInteger timeOffsetNext)
+{
+    return @{kCGMCalibrationKeyValue: @(100. + recordNumber),
+             kCGMKeyTimeOffset: @(timeOffset),
+             kCGMCalibrationKeyFluidType: @1,
+             kCGMCalibrationKeySampleLocation: @1,
+             kCGMKeyTimeOffsetNext: @(timeOffsetNext),
+             kCGMCalibrationKeyRecordNumber: @(recordNumber),
+             kCGMCalibrationKeyStatus: @0};
+}
+
+SpecBegin(CGMCalibrationManagerSpecs)
+
+describe(@"CGM calibration manager", ^{
+
+    __block UHNCGMCalibrationManager *calibrationManager;
+    __block UHNCGMSession *session;
+
+    beforeEach(^{
+        calibrationManager = [[UHNCGMCalibrationManager alloc] init];
+        int64_t startEpochTime = (int64_t)[[NSDate date] timeIntervalSince1970] + 24 * 60 * 60;
+        session = [[UHNCGMSession alloc] initWithSessionID:1 deviceIdentifier:@"A" startEpochTime:startEpochTime];
+    });
+
+    afterEach(^{
+        [calibrationManager cancelNextCalibrationReminder];
+    });
+
+    it(@"should cache records in order of record number", ^{
+        expect([calibrationManager addCalibrationDetails:CalibrationDetails(3, 30, 720) forSession:session]).to.beTruthy();
+        expect([calibrationManager addCalibrationDetails:CalibrationDetails(1, 10, 720) forSession:session]).to.beTruthy();
+        expect([calibrationManager addCalibrationDetails:CalibrationDetails(3, 30, 720) forSession:session]).to.beFalsy();
+
+        expect([calibrationManager numberOfRecordsForSessionID:1]).to.equal(2);
+        CGMCalibrationRecord record = [calibrationManager recordAtIndex:0 forSessionID:1];
+        expect(record.recordNumber).to.equal(1);
+        expect(record.glucoseConcentration).to.equal(101);
+        expect(record.sampleLocation).to.equal(1);
+        expect([calibrationManager newestRecordNumberForSessionID:1]).to.equal(3);
+        expect([calibrationManager newestRecordNumberForSessionID:2]).to.equal(NSNotFound);
+    });
+
+    it(@"should only request records newer than the cached records", ^{
+        [calibrationManager addCalibrationDetails:CalibrationDetails(1, 10, 720) forSession:session];
+        [calibrationManager addCalibrationDetails:CalibrationDetails(2, 20, 720) forSession:session];
+        [calibrationManager addCalibrationDetails:CalibrationDetails(4, 40, 720) forSession:session];
+
+        [calibrationManager beginRetrievalForSession:session];
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(kCGMCPCalibrationRecordNumberMostRecent);
+        [calibrationManager addCalibrationDetails:CalibrationDetails(6, 60, 720) forSession:session];
+
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(5);
+        [calibrationManager didFailToRetrieveRecord];
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(NSNotFound);
+        expect(calibrationManager.isRetrieving).to.beFalsy();
+    });
+
+    it(@"should request the whole history without cached records", ^{
+        [calibrationManager beginRetrievalForSession:session];
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(kCGMCPCalibrationRecordNumberMostRecent);
+        [calibrationManager addCalibrationDetails:CalibrationDetails(2, 20, 720) forSession:session];
+
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(0);
+        [calibrationManager addCalibrationDetails:CalibrationDetails(0, 0, 720) forSession:session];
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(1);
+        [calibrationManager addCalibrationDetails:CalibrationDetails(1, 10, 720) forSession:session];
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(NSNotFound);
+    });
+
+    it(@"should end the retrieval when there is no most recent record", ^{
+        [calibrationManager beginRetrievalForSession:session];
+        [calibrationManager nextRecordNumberToRequest];
+        [calibrationManager didFailToRetrieveRecord];
+        expect(calibrationManager.isRetrieving).to.beFalsy();
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(NSNotFound);
+    });
+
+    it(@"should cancel the retrieval", ^{
+        [calibrationManager beginRetrievalForSession:session];
+        [calibrationManager nextRecordNumberToRequest];
+        [calibrationManager addCalibrationDetails:CalibrationDetails(2, 20, 720) forSession:session];
+        [calibrationManager cancelRetrieval];
+        expect(calibrationManager.isRetrieving).to.beFalsy();
+        expect([calibrationManager nextRecordNumberToRequest]).to.equal(NSNotFound);
+        expect([calibrationManager numberOfRecordsForSessionID:session.sessionID]).to.equal(1);
+    });
+
+    it(@"should schedule the next calibration of the newest record", ^{
+        [calibrationManager addCalibrationDetails:CalibrationDetails(1, 10, 720) forSession:session];
+        expect(calibrationManager.nextCalibrationDate).to.equal([session.clock dateForTimeOffset:720]);
+
+        [session stopAtEpochTime:session.startEpochTime + 60];
+        UHNCGMSession *nextSession = [[UHNCGMSession alloc] initWithSessionID:2 deviceIdentifier:@"A" startEpochTime:0];
+        CalibrationReminderRecorder *recorder = [[CalibrationReminderRecorder alloc] init];
+        calibrationManager.delegate = recorder;
+
+        // a next calibration time in the past is due right away
+        [calibrationManager addCalibrationDetails:CalibrationDetails(1, 10, 20) forSession:nextSession];
+        expect(recorder.nextCalibrationDate).will.equal([nextSession.clock dateForTimeOffset:20]);
+    });
+});
+
+SpecEnd
@@ -7,7 +7,9 @@
 //
 
 #import <UHNCGMController/NSData+CGMCommands.h>
+#import <UHNCGMController/NSData+CGMParser.h>
 #import <UHNBLEController/NSData+ConversionExtensions.h>
+#import <UHNBLEController/NSData+RACPCommands.h>
 #import <UHNBLEController/UHNBLETypes.h>
 
 SpecBegin(CGMCommandSpecs)
@@ -30,11 +32,10 @@ describe(@"CGM command formatting", ^{
         uint8_t second = components.second;
 
         NSTimeZone *localTimeZone = [NSTimeZone localTimeZone];
-        NSInteger secFromGMT = [localTimeZone secondsFromGMT];
-        float hourFromGMT = secFromGMT / kSecondsInHour;
-        uint8_t timeZoneValue = hourFromGMT * kCGMTimeZoneStepSizeMin60;
-        
         NSTimeInterval daylightOffset = [localTimeZone daylightSavingTimeOffset];
+        NSInteger secFromGMT = [localTimeZone secondsFromGMT] - daylightOffset;
+        float hourFromGMT = secFromGMT / kSecondsInHour;
+        uint8_t timeZoneValue = (int8_t)lroundf(hourFromGMT * kCGMTimeZoneStepSizeMin60);
         
         expect([testCommand unsignedIntegerAtRange:(NSRange){0,2}]).to.equal(year);
         expect([testCommand unsignedIntegerAtRange:(NSRange){2,1}]).to.equal(month);
@@ -46,6 +47,14 @@ describe(@"CGM command formatting", ^{
         expect([testCommand unsignedIntegerAtRange:(NSRange){8,1}]*kSecondsInHour).to.equal(daylightOffset);
     });
     
+    it(@"should parse the current time as the session start time of now", ^{
+        NSData *testCommand = [NSData cgmCurrentTimeValue];
+        int64_t nowEpochTime = (int64_t)[[NSDate date] timeIntervalSince1970];
+
+        // the time zone and daylight saving time are both subtracted from the local time, so neither may include the other
+        expect(llabs([testCommand parseSessionStartEpochTime:NO] - nowEpochTime)).to.beLessThanOrEqualTo(1);
+    });
+    
     it(@"should join glucose fluid type and sample location", ^{
         GlucoseSampleLocationOption location = GlucoseSampleLocationSubcutaneousTissue; // 0101 (5)
         GlucoseFluidTypeOption type = GlucoseFluidTypeISF; // 1001 (9)
@@ -55,6 +64,82 @@ describe(@"CGM command formatting", ^{
         
         expect([testCommand unsignedIntegerAtRange:(NSRange){0,1}]).to.equal(jointValue);
     });
+    
+    it(@"should encode a float as an SFLOAT with the most precision that fits", ^{
+        expect(CGMSFloatFromFloat(0)).to.equal(0x0000);
+        expect(CGMSFloatFromFloat(70)).to.equal(0x0046);
+        expect(CGMSFloatFromFloat(180.5)).to.equal(0xF70D);
+        expect(CGMSFloatFromFloat(-12.5)).to.equal(0xFF83);
+        expect(CGMSFloatFromFloat(3.14159)).to.equal(0xE13A);
+        expect(CGMSFloatFromFloat(123456)).to.equal(0x24D3);
+    });
+    
+    it(@"should not encode finite values as SFLOAT special values", ^{
+        expect(CGMSFloatFromFloat(2045)).to.equal(0x07FD);
+        expect(CGMSFloatFromFloat(2046)).to.equal(0x10CD);
+        expect(CGMSFloatFromFloat(-2048)).to.equal(0x1F33);
+        expect(CGMSFloatFromFloat(NAN)).to.equal(kSFloatNaN);
+        expect(CGMSFloatFromFloat(INFINITY)).to.equal(kSFloatPositiveInfinity);
+        expect(CGMSFloatFromFloat(-INFINITY)).to.equal(kSFloatNegativeInfinity);
+        expect(CGMSFloatFromFloat(1e12)).to.equal(kSFloatPositiveInfinity);
+        expect(CGMSFloatFromFloat(1e-9)).to.equal(0x0000);
+    });
+    
+    it(@"should decode an SFLOAT", ^{
+        expect(CGMFloatFromSFloat(0xF70D)).to.beCloseTo(180.5);
+        expect(CGMFloatFromSFloat(0x1F33)).to.beCloseTo(-2050);
+        expect(isnan(CGMFloatFromSFloat(kSFloatNRes))).to.beTruthy();
+        expect(isinf(CGMFloatFromSFloat(kSFloatNegativeInfinity))).to.beTruthy();
+        
+        shortFloat value;
+        value.exponent = -1;
+        value.mantissa = 1805;
+        expect(CGMSFloatFromShortFloat(value)).to.equal(0xF70D);
+    });
+    
+    it(@"should build a command with an E2E-CRC", ^{
+        uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        expect(CGMCRC(check, sizeof(check))).to.equal(0x29B1);
+        
+        CGMCommandBuffer command;
+        CGMCommandBegin(&command, CGMCPOpCodeAlertLevelHypoSet);
+        CGMCommandAppendSFloat(&command, 70);
+        CGMCommandAppendCRC(&command);
+        NSData *testCommand = [NSData dataWithCGMCommand:&command];
+        
+        expect(testCommand.length).to.equal(5);
+        expect([testCommand unsignedIntegerAtRange:(NSRange){0,1}]).to.equal(CGMCPOpCodeAlertLevelHypoSet);
+        expect([testCommand unsignedIntegerAtRange:(NSRange){1,2}]).to.equal(0x0046);
+        expect([testCommand unsignedIntegerAtRange:(NSRange){3,2}]).to.equal(CGMCRC(command.bytes, 3));
+    });
+    
+    it(@"should reuse the commands consisting of an op code only", ^{
+        NSData *testCommand = [NSData cgmCommandWithOpCode:CGMCPOpCodeSessionStart crcPresent:NO];
+        expect(testCommand).to.beIdenticalTo([NSData cgmCommandWithOpCode:CGMCPOpCodeSessionStart crcPresent:NO]);
+        expect(testCommand.length).to.equal(1);
+        expect([testCommand unsignedIntegerAtRange:(NSRange){0,1}]).to.equal(CGMCPOpCodeSessionStart);
+        
+        testCommand = [NSData cgmCommandWithOpCode:CGMCPOpCodeSessionStart crcPresent:YES];
+        uint8_t opCode = CGMCPOpCodeSessionStart;
+        expect(testCommand.length).to.equal(3);
+        expect([testCommand unsignedIntegerAtRange:(NSRange){1,2}]).to.equal(CGMCRC(&opCode, 1));
+    });
+    
+    it(@"should reuse the RACP commands without an operand", ^{
+        expect([NSData reportAllStoredRecords]).to.beIdenticalTo([NSData reportAllStoredRecords]);
+        expect([NSData abortOperation]).to.equal([NSData dataWithBytes:(uint8_t[]){RACPOpCodeAbortOperation, RACPOperatorNull} length:2]);
+        expect([NSData reportNumberOfAllStoredRecords]).to.equal([NSData dataWithBytes:(uint8_t[]){RACPOpCodeStoredRecordsReportNumber, RACPOperatorRecordsAll} length:2]);
+    });
+    
+    it(@"should patch the time offsets into RACP commands", ^{
+        NSData *testCommand = [NSData reportStoredRecordsBetween:0x0102 and:0x0304];
+        uint8_t rangeBytes[] = {RACPOpCodeStoredRecordsReport, RACPOperatorWithinRange, RACPFilterTypeTimeOffset, 0x02, 0x01, 0x04, 0x03};
+        expect(testCommand).to.equal([NSData dataWithBytes:rangeBytes length:sizeof(rangeBytes)]);
+        
+        testCommand = [NSData reportNumberOfStoredRecordsGreaterThanOrEqualToTimeOffset:0x0506];
+        uint8_t timeOffsetBytes[] = {RACPOpCodeStoredRecordsReportNumber, RACPOperatorGreaterThanEqualTo, RACPFilterTypeTimeOffset, 0x06, 0x05};
+        expect(testCommand).to.equal([NSData dataWithBytes:timeOffsetBytes length:sizeof(timeOffsetBytes)]);
+    });
 
 });
 
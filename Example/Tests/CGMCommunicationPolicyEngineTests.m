@@ -0,0 +1,86 @@
+//
+//  CGMCommunicationPolicyEngineTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMCommunicationPolicyEngine.h>
+
+SpecBegin(CGMCommunicationPolicyEngineSpecs)
+
+describe(@"CGM communication policy engine", ^{
+
+    __block UHNCGMCommunicationPolicyEngine *policyEngine;
+    __block NSDate *startDate;
+
+    beforeEach(^{
+        policyEngine = [[UHNCGMCommunicationPolicyEngine alloc] init];
+        startDate = [NSDate dateWithTimeIntervalSince1970:1792398600];
+        [policyEngine resetStatisticsAtDate:startDate];
+    });
+
+    it(@"should monitor in the background by default", ^{
+        expect([policyEngine evaluatePolicyAtDate:startDate]).to.beFalsy();
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyBackground);
+        expect(policyEngine.communicationInterval).to.equal(kCGMCommunicationPolicyDefaultIntervalBackground);
+    });
+
+    it(@"should choose the policy with the highest priority", ^{
+        policyEngine.numberOfStoredRecords = kCGMCommunicationPolicyDefaultBacklogThreshold;
+        expect([policyEngine evaluatePolicyAtDate:startDate]).to.beTruthy();
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyBacklog);
+
+        policyEngine.isForeground = YES;
+        [policyEngine evaluatePolicyAtDate:startDate];
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyForeground);
+        expect(policyEngine.communicationInterval).to.equal(1);
+
+        policyEngine.rateOfChange = -2.;
+        [policyEngine evaluatePolicyAtDate:startDate];
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyUrgent);
+        expect(policyEngine.communicationInterval).to.equal(kCGMCPCommunicationIntervalFastest);
+
+        policyEngine.rateOfChange = NAN;
+        policyEngine.activeAlerts = CGMAlertPatientLow;
+        [policyEngine evaluatePolicyAtDate:startDate];
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyUrgent);
+    });
+
+    it(@"should only report a change of the communication interval", ^{
+        [policyEngine setCommunicationInterval:5 forPolicy:CGMCommunicationPolicyBacklog];
+        policyEngine.numberOfStoredRecords = 100;
+        expect([policyEngine evaluatePolicyAtDate:startDate]).to.beFalsy();
+        expect(policyEngine.policy).to.equal(CGMCommunicationPolicyBacklog);
+    });
+
+    it(@"should measure the notifications and latency of each policy", ^{
+        for (NSUInteger index = 0; index < 6; index++) {
+            [policyEngine addNotificationWithLatency:index];
+        }
+        policyEngine.isForeground = YES;
+        [policyEngine evaluatePolicyAtDate:[startDate dateByAddingTimeInterval:30 * 60]];
+        [policyEngine addNotificationWithLatency:2];
+
+        CGMCommunicationPolicyStatistics statistics = [policyEngine statisticsForPolicy:CGMCommunicationPolicyBackground
+                                                                                 atDate:[startDate dateByAddingTimeInterval:60 * 60]];
+        expect(statistics.duration).to.equal(30 * 60);
+        expect(statistics.numberOfNotifications).to.equal(6);
+        expect(statistics.notificationsPerHour).to.equal(12);
+        expect(statistics.meanLatency).to.equal(2.5);
+        expect(statistics.maxLatency).to.equal(5);
+
+        statistics = [policyEngine statisticsForPolicy:CGMCommunicationPolicyForeground
+                                                atDate:[startDate dateByAddingTimeInterval:60 * 60]];
+        expect(statistics.duration).to.equal(30 * 60);
+        expect(statistics.notificationsPerHour).to.equal(2);
+
+        statistics = [policyEngine statisticsForPolicy:CGMCommunicationPolicyUrgent
+                                                atDate:[startDate dateByAddingTimeInterval:60 * 60]];
+        expect(statistics.notificationsPerHour).to.equal(0);
+        expect(isnan(statistics.meanLatency)).to.beTruthy();
+    });
+});
+
+SpecEnd
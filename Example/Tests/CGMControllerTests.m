@@ -6,11 +6,207 @@
 //  Copyright (c) 2015 University Health Network.
 //
 
+#import <UHNCGMController/UHNCGMController.h>
+#import <UHNCGMController/NSData+CGMCommands.h>
+
+// the BLE events of the CGM sensor are delivered to the controller directly
+@interface UHNCGMController (Testing)
+- (void)bleController:(id)controller didUpdateValue:(NSData*)value forCharacteristic:(NSString*)charUUID;
+@end
+
+@interface CGMControllerEventRecorder : NSObject <UHNCGMControllerDelegate>
+@property(nonatomic,assign) NSUInteger numberOfRACPOperationsSuccessful;
+@property(nonatomic,assign) NSUInteger numberOfRACPOperationsFailed;
+@property(nonatomic,strong) NSMutableArray *reconciledRanges;
+@property(nonatomic,strong) NSDictionary *measurementDetails;
+@property(nonatomic,assign) CGMAlertOption raisedAlerts;
+@end
+
+@implementation CGMControllerEventRecorder
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _reconciledRanges = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)cgmController:(UHNCGMController*)controller measurementDetails:(NSDictionary*)measurementDetails
+{
+    self.measurementDetails = measurementDetails;
+}
+
+- (void)cgmController:(UHNCGMController*)controller didRaiseAlerts:(CGMAlertOption)alerts measurementDetails:(NSDictionary*)measurementDetails
+{
+    self.raisedAlerts |= alerts;
+}
+
+- (void)cgmController:(UHNCGMController*)controller RACPOperationSuccessful:(RACPOpCode)opCode
+{
+    self.numberOfRACPOperationsSuccessful++;
+}
+
+- (void)cgmController:(UHNCGMController*)controller RACPOperation:(RACPOpCode)opCode failed:(RACPResponseCode)responseCode
+{
+    self.numberOfRACPOperationsFailed++;
+}
+
+- (void)cgmController:(UHNCGMController*)controller didReconcileGapWithTimeOffsets:(NSRange)timeOffsets
+{
+    [self.reconciledRanges addObject:[NSValue valueWithRange:timeOffsets]];
+}
+
+@end
+
+static NSData *MeasurementData(uint8_t glucose, uint16_t timeOffset)
+{
+    uint8_t bytes[] = {6, 0x00, glucose, 0x00, timeOffset & 0xFF, timeOffset >> 8};
+    return [NSData dataWithBytes:bytes length:sizeof(bytes)];
+}
+
+static NSData *RACPResponseData(RACPOpCode requestOpCode, RACPResponseCode responseCode)
+{
+    uint8_t bytes[] = {RACPOpCodeResponse, RACPOperatorNull, requestOpCode, responseCode};
+    return [NSData dataWithBytes:bytes length:sizeof(bytes)];
+}
+
+static NSData *CGMCPResponseData(CGMCPOpCode requestOpCode, CGMCPResponseCode responseCode)
+{
+    uint8_t bytes[] = {CGMCPOpCodeResponse, requestOpCode, responseCode};
+    return [NSData dataWithBytes:bytes length:sizeof(bytes)];
+}
+
 SpecBegin(CGMControllerSpecs)
 
 describe(@"CGM controller interaction with CGM sensor", ^{
-    
-    
+
+    __block UHNCGMController *cgmController;
+    __block CGMControllerEventRecorder *recorder;
+
+    beforeEach(^{
+        recorder = [[CGMControllerEventRecorder alloc] init];
+        cgmController = [[UHNCGMController alloc] initWithDelegate:recorder];
+        // the missing ranges are handed to the controller below, as the CGM sensor is not connected
+        cgmController.shouldReconcileGaps = NO;
+        cgmController.gapDetector.communicationInterval = 1;
+        for (NSNumber *timeOffset in @[@0, @1, @2, @6]) {
+            [cgmController bleController:nil didUpdateValue:MeasurementData(120, [timeOffset unsignedShortValue]) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        }
+    });
+
+    it(@"should not report the reconcile of a gap as a RACP procedure of the app", ^{
+        expect(cgmController.gapDetector.numberOfMissingRanges).to.equal(1);
+        NSRange missingRange = [cgmController.gapDetector missingRangeAtIndex:0];
+        [cgmController setValue:[NSValue valueWithRange:missingRange] forKey:@"reconcilingRange"];
+
+        [cgmController bleController:nil didUpdateValue:RACPResponseData(RACPOpCodeStoredRecordsReport, RACPSuccess) forCharacteristic:kCGMCharacteristicUUIDRecordAccessControlPoint];
+        expect(recorder.numberOfRACPOperationsSuccessful).to.equal(0);
+        expect(recorder.reconciledRanges).to.equal(@[[NSValue valueWithRange:missingRange]]);
+        expect(cgmController.gapDetector.numberOfMissingRanges).to.equal(0);
+    });
+
+    it(@"should keep a missing range when its reconcile fails", ^{
+        NSRange missingRange = [cgmController.gapDetector missingRangeAtIndex:0];
+        [cgmController setValue:[NSValue valueWithRange:missingRange] forKey:@"reconcilingRange"];
+
+        [cgmController bleController:nil didUpdateValue:RACPResponseData(RACPOpCodeStoredRecordsReport, RACPProcedureNotCompleted) forCharacteristic:kCGMCharacteristicUUIDRecordAccessControlPoint];
+        expect(recorder.numberOfRACPOperationsFailed).to.equal(0);
+        expect(recorder.reconciledRanges).to.haveCountOf(0);
+        expect(cgmController.gapDetector.numberOfMissingRanges).to.equal(1);
+        expect(NSEqualRanges([cgmController.gapDetector missingRangeAtIndex:0], missingRange)).to.beTruthy();
+    });
+
+    it(@"should report the RACP procedures of the app", ^{
+        [cgmController bleController:nil didUpdateValue:RACPResponseData(RACPOpCodeStoredRecordsReport, RACPSuccess) forCharacteristic:kCGMCharacteristicUUIDRecordAccessControlPoint];
+        expect(recorder.numberOfRACPOperationsSuccessful).to.equal(1);
+        expect(recorder.reconciledRanges).to.haveCountOf(0);
+        expect(cgmController.gapDetector.numberOfMissingRanges).to.equal(1);
+    });
+
+    it(@"should set the adapted communication interval again once the CGM sensor rejected it", ^{
+        // the interval sent with the last measurement
+        [cgmController setValue:@5 forKey:@"adaptedCommunicationInterval"];
+
+        [cgmController bleController:nil didUpdateValue:CGMCPResponseData(CGMCPOpCodeCommIntervalSet, CGMCPInvalidOperand) forCharacteristic:kCGMCharacteristicUUIDSpecificOpsControlPoint];
+        expect([[cgmController valueForKey:@"adaptedCommunicationInterval"] unsignedIntegerValue]).to.equal(NSNotFound);
+    });
+
+    it(@"should not add historical records to the trend estimator", ^{
+        expect(cgmController.trendEstimator.rateOfChange).to.beCloseTo(0);
+        expect([recorder.measurementDetails[kCGMMeasurementKeyDerivedTrendInfo] floatValue]).to.beCloseTo(0);
+
+        // a record of the missing range is older than the newest reading, which would restart the estimation
+        [cgmController bleController:nil didUpdateValue:MeasurementData(200, 4) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect(cgmController.trendEstimator.rateOfChange).to.beCloseTo(0);
+        expect(recorder.measurementDetails[kCGMMeasurementKeyDerivedTrendInfo]).to.beNil();
+
+        [cgmController bleController:nil didUpdateValue:MeasurementData(120, 7) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect([recorder.measurementDetails[kCGMMeasurementKeyDerivedTrendInfo] floatValue]).to.beCloseTo(0);
+    });
+});
+
+describe(@"CGM controller without a session", ^{
+
+    __block UHNCGMController *cgmController;
+    __block CGMControllerEventRecorder *recorder;
+
+    beforeEach(^{
+        recorder = [[CGMControllerEventRecorder alloc] init];
+        cgmController = [[UHNCGMController alloc] initWithDelegate:recorder];
+        cgmController.shouldReconcileGaps = NO;
+    });
+
+    it(@"should not raise alerts for an ascending stored records transfer", ^{
+        // the transfer is in progress, as the RACP procedure can not be sent to a CGM sensor that is not connected
+        [cgmController setValue:@YES forKey:@"isRetrievingStoredRecords"];
+        for (uint16_t timeOffset = 0; timeOffset < 10; timeOffset += 5) {
+            [cgmController bleController:nil didUpdateValue:MeasurementData(40, timeOffset) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        }
+        expect(recorder.raisedAlerts).to.equal(0);
+    });
+
+    it(@"should raise alerts for live readings", ^{
+        [cgmController bleController:nil didUpdateValue:MeasurementData(40, 0) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect(recorder.raisedAlerts & CGMAlertHypo).to.beTruthy();
+    });
+});
+
+describe(@"CGM controller glucose profile", ^{
+
+    __block UHNCGMController *cgmController;
+    __block NSDate *fromDate;
+    __block NSDate *toDate;
+
+    beforeEach(^{
+        cgmController = [[UHNCGMController alloc] initWithDelegate:nil];
+        cgmController.shouldReconcileGaps = NO;
+        // the session started now, in the format of the session start time characteristic
+        [cgmController bleController:nil didUpdateValue:[NSData cgmCurrentTimeValue] forCharacteristic:kCGMCharacteristicUUIDSessionStartTime];
+        fromDate = [NSDate dateWithTimeIntervalSinceNow:-2 * 24 * kSecondsInHour];
+        toDate = [NSDate dateWithTimeIntervalSinceNow:2 * 24 * kSecondsInHour];
+    });
+
+    it(@"should add a record to the profile only once, even after the statistics are reset", ^{
+        [cgmController bleController:nil didUpdateValue:MeasurementData(120, 0) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        [cgmController bleController:nil didUpdateValue:MeasurementData(120, 1) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect([cgmController glucoseProfileFromDate:fromDate toDate:toDate].numberOfReadings).to.equal(2);
+
+        [cgmController.statistics reset];
+        [cgmController bleController:nil didUpdateValue:MeasurementData(120, 1) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect([cgmController glucoseProfileFromDate:fromDate toDate:toDate].numberOfReadings).to.equal(2);
+    });
+
+    it(@"should evict the profile of the oldest day", ^{
+        NSMutableDictionary *dailyGlucoseProfiles = [cgmController valueForKey:@"dailyGlucoseProfiles"];
+        for (NSInteger day = 0; day < 90; day++) {
+            dailyGlucoseProfiles[@(day)] = [[UHNCGMGlucoseProfile alloc] init];
+        }
+        [cgmController bleController:nil didUpdateValue:MeasurementData(120, 0) forCharacteristic:kCGMCharacteristicUUIDMeasurement];
+        expect(dailyGlucoseProfiles).to.haveCountOf(90);
+        expect(dailyGlucoseProfiles[@0]).to.beNil();
+        expect([cgmController glucoseProfileFromDate:fromDate toDate:toDate].numberOfReadings).to.equal(1);
+    });
 });
 
 SpecEnd
@@ -0,0 +1,95 @@
+//
+//  CGMGapDetectorTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMGapDetector.h>
+
+SpecBegin(CGMGapDetectorSpecs)
+
+describe(@"CGM gap detection", ^{
+
+    __block UHNCGMGapDetector *gapDetector;
+
+    beforeEach(^{
+        gapDetector = [[UHNCGMGapDetector alloc] init];
+    });
+
+    it(@"should learn the cadence from the observed time offsets", ^{
+        [gapDetector addTimeOffset:0];
+        [gapDetector addTimeOffset:5];
+        expect(gapDetector.expectedInterval).to.equal(5);
+        expect(gapDetector.numberOfMissingRanges).to.equal(0);
+    });
+
+    it(@"should prefer the communication interval as cadence", ^{
+        gapDetector.communicationInterval = 2;
+        expect(gapDetector.expectedInterval).to.equal(2);
+
+        gapDetector.communicationInterval = kCGMGapDetectorFastestCommunicationInterval;
+        expect(gapDetector.expectedInterval).to.equal(1);
+    });
+
+    it(@"should detect a missing range", ^{
+        gapDetector.communicationInterval = 5;
+        [gapDetector addTimeOffset:0];
+        [gapDetector addTimeOffset:5];
+        expect([gapDetector addTimeOffset:7]).to.beFalsy();
+        expect([gapDetector addTimeOffset:30]).to.beTruthy();
+
+        expect(gapDetector.numberOfMissingRanges).to.equal(1);
+        NSRange missingRange = [gapDetector missingRangeAtIndex:0];
+        expect(missingRange.location).to.equal(8);
+        expect(NSMaxRange(missingRange)).to.equal(30);
+        expect(gapDetector.newestTimeOffset).to.equal(30);
+    });
+
+    it(@"should fill a missing range with stored records", ^{
+        gapDetector.communicationInterval = 5;
+        [gapDetector addTimeOffset:0];
+        [gapDetector addTimeOffset:30];
+        [gapDetector addTimeOffset:60];
+        [gapDetector addTimeOffset:100];
+        expect(gapDetector.numberOfMissingRanges).to.equal(3);
+
+        // stored records are reported in ascending order
+        [gapDetector addTimeOffset:5];
+        [gapDetector addTimeOffset:10];
+        NSRange missingRange = [gapDetector missingRangeAtIndex:0];
+        expect(missingRange.location).to.equal(11);
+
+        [gapDetector removeMissingRange:NSMakeRange(61, 39)];
+        expect(gapDetector.numberOfMissingRanges).to.equal(2);
+    });
+
+    it(@"should split a missing range", ^{
+        gapDetector.communicationInterval = 1;
+        [gapDetector addTimeOffset:0];
+        [gapDetector addTimeOffset:100];
+        [gapDetector removeMissingRange:NSMakeRange(40, 10)];
+
+        expect(gapDetector.numberOfMissingRanges).to.equal(2);
+        NSRange firstRange = [gapDetector missingRangeAtIndex:0];
+        NSRange secondRange = [gapDetector missingRangeAtIndex:1];
+        expect(firstRange.location).to.equal(1);
+        expect(NSMaxRange(firstRange)).to.equal(40);
+        expect(secondRange.location).to.equal(50);
+        expect(NSMaxRange(secondRange)).to.equal(100);
+    });
+
+    it(@"should reset", ^{
+        gapDetector.communicationInterval = 1;
+        [gapDetector addTimeOffset:0];
+        [gapDetector addTimeOffset:100];
+        [gapDetector reset];
+
+        expect(gapDetector.numberOfMissingRanges).to.equal(0);
+        expect(gapDetector.newestTimeOffset).to.equal(NSNotFound);
+        expect(gapDetector.communicationInterval).to.equal(1);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,99 @@
+//
+//  CGMGlucoseProfileTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMGlucoseProfile.h>
+
+SpecBegin(CGMGlucoseProfileSpecs)
+
+describe(@"CGM ambulatory glucose profile", ^{
+
+    __block UHNCGMGlucoseProfile *profile;
+
+    beforeEach(^{
+        profile = [[UHNCGMGlucoseProfile alloc] init];
+    });
+
+    it(@"should report no percentiles for an empty bucket", ^{
+        expect([profile numberOfReadingsInBucket:0]).to.equal(0);
+        expect(isnan([profile percentile:50 inBucket:0])).to.beTruthy();
+    });
+
+    it(@"should add readings to the bucket of the time of day", ^{
+        [profile addGlucoseConcentration:100 atMinuteOfDay:0];
+        [profile addGlucoseConcentration:100 atMinuteOfDay:29];
+        [profile addGlucoseConcentration:100 atMinuteOfDay:30];
+        [profile addGlucoseConcentration:100 atMinuteOfDay:(24 * 60) - 1];
+
+        expect([profile numberOfReadingsInBucket:0]).to.equal(2);
+        expect([profile numberOfReadingsInBucket:1]).to.equal(1);
+        expect([profile numberOfReadingsInBucket:kCGMGlucoseProfileNumberOfBuckets - 1]).to.equal(1);
+        expect(profile.numberOfReadings).to.equal(4);
+    });
+
+    it(@"should estimate the percentiles of a bucket", ^{
+        for (NSUInteger glucose = 1; glucose <= 400; glucose++) {
+            [profile addGlucoseConcentration:glucose atMinuteOfDay:60];
+        }
+
+        CGMGlucoseProfilePercentiles percentiles = [profile percentilesInBucket:2];
+        expect(percentiles.percentile5).to.beCloseToWithin(20, kCGMGlucoseProfileBinWidth);
+        expect(percentiles.percentile25).to.beCloseToWithin(100, kCGMGlucoseProfileBinWidth);
+        expect(percentiles.percentile50).to.beCloseToWithin(200, kCGMGlucoseProfileBinWidth);
+        expect(percentiles.percentile75).to.beCloseToWithin(300, kCGMGlucoseProfileBinWidth);
+        expect(percentiles.percentile95).to.beCloseToWithin(380, kCGMGlucoseProfileBinWidth);
+    });
+
+    it(@"should clamp readings outside the glucose domain", ^{
+        [profile addGlucoseConcentration:-10 atMinuteOfDay:0];
+        [profile addGlucoseConcentration:1000 atMinuteOfDay:0];
+
+        expect([profile percentile:0 inBucket:0]).to.beCloseToWithin(0, kCGMGlucoseProfileBinWidth);
+        expect([profile percentile:100 inBucket:0]).to.beCloseToWithin(kCGMGlucoseProfileMaximumGlucose, kCGMGlucoseProfileBinWidth);
+    });
+
+    it(@"should ignore non-finite readings", ^{
+        [profile addGlucoseConcentration:INFINITY atMinuteOfDay:0];
+        [profile addGlucoseConcentration:-INFINITY atMinuteOfDay:0];
+        [profile addGlucoseConcentration:NAN atMinuteOfDay:0];
+        expect(profile.numberOfReadings).to.equal(0);
+    });
+
+    it(@"should merge profiles", ^{
+        UHNCGMGlucoseProfile *otherProfile = [[UHNCGMGlucoseProfile alloc] init];
+        [profile addGlucoseConcentration:100 atMinuteOfDay:0];
+        [otherProfile addGlucoseConcentration:200 atMinuteOfDay:0];
+        [otherProfile addGlucoseConcentration:200 atMinuteOfDay:0];
+        [otherProfile addGlucoseConcentration:120 atMinuteOfDay:600];
+        [profile mergeProfile:otherProfile];
+
+        expect(profile.numberOfReadings).to.equal(4);
+        expect([profile numberOfReadingsInBucket:0]).to.equal(3);
+        expect([profile percentile:50 inBucket:0]).to.beCloseToWithin(200, kCGMGlucoseProfileBinWidth);
+        expect([profile percentile:50 inBucket:20]).to.beCloseToWithin(120, kCGMGlucoseProfileBinWidth);
+    });
+
+    it(@"should archive and unarchive a profile", ^{
+        [profile addGlucoseConcentration:150 atMinuteOfDay:720];
+        NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:profile];
+        UHNCGMGlucoseProfile *unarchivedProfile = [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+
+        expect(unarchivedProfile.numberOfReadings).to.equal(1);
+        expect([unarchivedProfile numberOfReadingsInBucket:24]).to.equal(1);
+        expect([unarchivedProfile percentile:50 inBucket:24]).to.beCloseToWithin(150, kCGMGlucoseProfileBinWidth);
+    });
+
+    it(@"should copy a profile", ^{
+        [profile addGlucoseConcentration:150 atMinuteOfDay:720];
+        UHNCGMGlucoseProfile *copiedProfile = [profile copy];
+        [profile addGlucoseConcentration:150 atMinuteOfDay:720];
+
+        expect(copiedProfile.numberOfReadings).to.equal(1);
+    });
+});
+
+SpecEnd
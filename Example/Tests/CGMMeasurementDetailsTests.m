@@ -0,0 +1,129 @@
+//
+//  CGMMeasurementDetailsTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMMeasurementDetails.h>
+#import <UHNCGMController/NSDictionary+CGMExtensions.h>
+
+SpecBegin(CGMMeasurementDetailsSpecs)
+
+describe(@"CGM measurement details", ^{
+
+    __block NSData *measurementData;
+
+    beforeEach(^{
+        // all status octets, trend 10 and quality 95
+        measurementData = [NSData dataWithBytes:(char[]){13, 0xE3, 147, 0x00, 40, 0x00, 0x03, 0x08, 0x05, 10, 0x00, 95, 0x00} length:13];
+    });
+
+    it(@"should decode the fields when looked up", ^{
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:measurementData crcPresent:NO];
+        expect(measurementDetails.count).to.equal(5);
+        expect(measurementDetails.glucoseConcentration).to.equal(147);
+        expect([measurementDetails glucoseValue]).to.equal(147);
+        expect([measurementDetails measurementTimeOffset]).to.equal(40);
+        expect([measurementDetails trendValue]).to.equal(10);
+        expect([measurementDetails qualityValue]).to.equal(95);
+        expect(measurementDetails[kCGMStatusKeySensorStatus]).to.equal(@{kCGMStatusKeyOctetStatus: @3,
+                                                                         kCGMStatusKeyOctetCalTemp: @8,
+                                                                         kCGMStatusKeyOctetWarning: @5});
+        expect(measurementDetails[kCGMMeasurementKeyDerivedTrendInfo]).to.beNil();
+        expect(measurementDetails[@"CGMUnknownKey"]).to.beNil();
+    });
+
+    it(@"should equal the dictionary of all its fields", ^{
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:measurementData crcPresent:YES];
+        NSDictionary *expectedDetails = @{kCGMMeasurementKeyGlucoseConcentration: @147.f,
+                                          kCGMKeyTimeOffset: @40,
+                                          kCGMStatusKeySensorStatus: @{kCGMStatusKeyOctetStatus: @3,
+                                                                       kCGMStatusKeyOctetCalTemp: @8,
+                                                                       kCGMStatusKeyOctetWarning: @5},
+                                          kCGMMeasurementKeyTrendInfo: @10.f,
+                                          kCGMMeasurementKeyQuality: @95.f,
+                                          kCGMCRCFailed: @NO};
+        expect(measurementDetails).to.equal(expectedDetails);
+        expect([measurementDetails.allKeys count]).to.equal(6);
+
+        NSMutableDictionary *mutableDetails = [measurementDetails mutableCopy];
+        mutableDetails[kCGMKeySessionID] = @1;
+        expect(mutableDetails.count).to.equal(7);
+        expect([measurementDetails copy]).to.beIdenticalTo(measurementDetails);
+    });
+
+    it(@"should only include the fields present in the data", ^{
+        NSData *shortData = [NSData dataWithBytes:(char[]){7, 0x81, 140, 0x00, 5, 0x00, 0x03} length:7];
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:shortData crcPresent:NO];
+        expect(measurementDetails.count).to.equal(3);
+        expect(measurementDetails[kCGMStatusKeySensorStatus][kCGMStatusKeyOctetStatus]).to.equal(3);
+        expect([measurementDetails trendValue]).to.beNil();
+        expect(isnan(measurementDetails.trendInformation)).to.beTruthy();
+    });
+
+    it(@"should read the fields of a measurement without creating its details", ^{
+        CGMMeasurementFields fields = CGMMeasurementFieldsFromData(measurementData);
+        expect(fields.timeOffset).to.equal(40);
+        expect(fields.glucoseConcentration).to.equal(147);
+        expect(fields.trendInformation).to.equal(10);
+
+        // the trend information does not fit a truncated measurement
+        NSData *shortData = [NSData dataWithBytes:(char[]){7, 0x81, 140, 0x00, 5, 0x00, 0x03} length:7];
+        fields = CGMMeasurementFieldsFromData(shortData);
+        expect(fields.timeOffset).to.equal(5);
+        expect(fields.glucoseConcentration).to.equal(140);
+        expect(isnan(fields.trendInformation)).to.beTruthy();
+    });
+
+    it(@"should look up the same layout as computed field by field for all flags", ^{
+        for (NSUInteger flags = 0; flags <= UINT8_MAX; flags++) {
+            CGMMeasurementLayout layout = CGMMeasurementLayoutForFlags((uint8_t)flags);
+            CGMMeasurementLayout expectedLayout = CGMMeasurementLayoutMake((uint8_t)flags, kCGMMeasurementMaxLength);
+            expect(memcmp(&layout, &expectedLayout, sizeof(CGMMeasurementLayout))).to.equal(0);
+        }
+    });
+
+    it(@"should decode the optional fields of all flag combinations", ^{
+        for (NSUInteger combination = 0; combination < kCGMMeasurementLayoutCount; combination++) {
+            uint8_t flags = (uint8_t)((combination & 0x03) | ((combination & 0x1C) << 3));
+            CGMMeasurementLayout layout = CGMMeasurementLayoutMake(flags, kCGMMeasurementMaxLength);
+            uint8_t bytes[kCGMMeasurementMaxLength] = {layout.length, flags, 120, 0x00, 30, 0x00};
+            if (layout.statusIndex) bytes[layout.statusIndex] = 0x01;
+            if (layout.calTempIndex) bytes[layout.calTempIndex] = 0x02;
+            if (layout.warningIndex) bytes[layout.warningIndex] = 0x04;
+            if (layout.trendIndex) bytes[layout.trendIndex] = 7;
+            if (layout.qualityIndex) bytes[layout.qualityIndex] = 90;
+
+            NSData *data = [NSData dataWithBytes:bytes length:layout.length];
+            UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:data crcPresent:NO];
+            expect(measurementDetails.glucoseConcentration).to.equal(120);
+            expect(measurementDetails.timeOffset).to.equal(30);
+            expect(measurementDetails.sensorStatus).to.equal(CGMSensorStatusMake(layout.statusIndex ? 0x01 : 0,
+                                                                                 layout.calTempIndex ? 0x02 : 0,
+                                                                                 layout.warningIndex ? 0x04 : 0));
+            expect(!isnan(measurementDetails.trendInformation)).to.equal((flags & CGMMeasurementFlagsTrendInformationPresent) != 0);
+            expect(!isnan(measurementDetails.quality)).to.equal((flags & CGMMeasurementFlagsQualityPresent) != 0);
+        }
+    });
+
+    it(@"should add the details of the controller", ^{
+        UHNCGMSessionClock *clock = [[UHNCGMSessionClock alloc] initWithSessionStartEpochTime:1792398600];
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:measurementData
+                                                                                                       crcPresent:NO
+                                                                                                     sessionClock:clock
+                                                                                                        sessionID:2
+                                                                                                     derivedTrend:-1.5
+                                                                                                       trendArrow:CGMTrendArrowFallingSlightly];
+
+        expect(measurementDetails.count).to.equal(9);
+        expect([measurementDetails measurementDateTime]).to.equal([NSDate dateWithTimeIntervalSince1970:1792398600 + 40 * 60]);
+        expect(measurementDetails[kCGMKeySessionID]).to.equal(2);
+        expect([measurementDetails derivedTrendValue]).to.equal(-1.5);
+        expect([measurementDetails trendArrow]).to.equal(CGMTrendArrowFallingSlightly);
+        expect([measurementDetails copy]).to.beIdenticalTo(measurementDetails);
+    });
+});
+
+SpecEnd
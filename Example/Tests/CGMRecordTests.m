@@ -0,0 +1,116 @@
+//
+//  CGMRecordTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMMeasurement.h>
+#import <UHNCGMController/UHNCGMStatus.h>
+#import <UHNCGMController/UHNCGMFeatures.h>
+#import <UHNCGMController/UHNCGMCalibration.h>
+
+SpecBegin(CGMRecordSpecs)
+
+describe(@"CGM records", ^{
+
+    __block UHNCGMSession *session;
+
+    beforeEach(^{
+        int64_t startEpochTime = (int64_t)[[NSDate date] timeIntervalSince1970];
+        session = [[UHNCGMSession alloc] initWithSessionID:2 deviceIdentifier:@"A" startEpochTime:startEpochTime];
+    });
+
+    it(@"should pack the sensor status octets", ^{
+        CGMSensorStatus sensorStatus = CGMSensorStatusMake(CGMStatusStatusSessionStopped,
+                                                           CGMStatusCalTempCalibrationRequired,
+                                                           CGMStatusWarningSensorResultTooHigh);
+        expect(sensorStatus).to.equal(0x800801);
+        expect(CGMSensorStatusHasStatus(sensorStatus, CGMStatusStatusSessionStopped)).to.beTruthy();
+        expect(CGMSensorStatusHasStatus(sensorStatus, CGMStatusStatusDeviceBatteryLow)).to.beFalsy();
+        expect(CGMSensorStatusHasCalTemp(sensorStatus, CGMStatusCalTempCalibrationRequired)).to.beTruthy();
+        expect(CGMSensorStatusHasCalTemp(sensorStatus, CGMStatusCalTempTimeSynchronizationRequired)).to.beFalsy();
+        expect(CGMSensorStatusHasWarning(sensorStatus, CGMStatusWarningSensorResultTooHigh)).to.beTruthy();
+        expect(CGMSensorStatusHasWarning(sensorStatus, CGMStatusWarningResultLowerThanPatientLow)).to.beFalsy();
+    });
+
+    it(@"should make a measurement from the measurement details", ^{
+        NSData *measurementData = [NSData dataWithBytes:(char[]){13, 0xE3, 147, 0x00, 40, 0x00, 0x03, 0x08, 0x05, 10, 0x00, 95, 0x00} length:13];
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:measurementData
+                                                                                                       crcPresent:NO
+                                                                                                     sessionClock:session.clock
+                                                                                                        sessionID:session.sessionID
+                                                                                                     derivedTrend:2
+                                                                                                       trendArrow:CGMTrendArrowFlat];
+
+        UHNCGMMeasurement *measurement = [[UHNCGMMeasurement alloc] initWithMeasurementDetails:measurementDetails];
+        expect(measurement.glucoseConcentration).to.equal(147);
+        expect(measurement.timeOffset).to.equal(40);
+        expect(measurement.sensorStatus).to.equal(0x050803);
+        expect(measurement.trendInformation).to.equal(10);
+        expect(measurement.rateOfChange).to.equal(10);
+        expect(measurement.quality).to.equal(95);
+        expect(measurement.sessionID).to.equal(2);
+        expect(measurement.date).to.equal([session.clock dateForTimeOffset:40]);
+        expect([measurement copy]).to.beIdenticalTo(measurement);
+    });
+
+    it(@"should clear the status octets a measurement does not include", ^{
+        NSData *measurementData = [NSData dataWithBytes:(char[]){7, 0x80, 140, 0x00, 5, 0x00, 0x03} length:7];
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:measurementData
+                                                                                                       crcPresent:NO
+                                                                                                     sessionClock:nil
+                                                                                                        sessionID:NSNotFound
+                                                                                                     derivedTrend:2
+                                                                                                       trendArrow:CGMTrendArrowFlat];
+
+        UHNCGMMeasurement *measurement = [[UHNCGMMeasurement alloc] initWithMeasurementDetails:measurementDetails];
+        expect(measurement.sensorStatus).to.equal(0x03);
+        expect(isnan(measurement.trendInformation)).to.beTruthy();
+        expect(measurement.rateOfChange).to.equal(2);
+        expect(measurement.sessionID).to.equal(NSNotFound);
+        expect(measurement.date).to.beNil();
+    });
+
+    it(@"should read the status characteristic", ^{
+        NSData *statusData = [NSData dataWithBytes:(char[]){0x2C, 0x01, 0x02, 0x04, 0x40} length:5];
+        UHNCGMStatus *status = [[UHNCGMStatus alloc] initWithStatusData:statusData session:session];
+        expect(status.timeOffset).to.equal(300);
+        expect(CGMSensorStatusHasStatus(status.sensorStatus, CGMStatusStatusDeviceBatteryLow)).to.beTruthy();
+        expect(CGMSensorStatusHasCalTemp(status.sensorStatus, CGMStatusCalTempCalibrationRecommended)).to.beTruthy();
+        expect(CGMSensorStatusHasWarning(status.sensorStatus, CGMStatusWarningSensorResultTooLow)).to.beTruthy();
+        expect(status.sessionID).to.equal(2);
+        expect(status.date).to.equal([session.clock dateForTimeOffset:300]);
+    });
+
+    it(@"should read the feature characteristic", ^{
+        NSData *featureData = [NSData dataWithBytes:(char[]){0x01, 0x90, 0x01, 0x11, 0xFF, 0xFF} length:6];
+        UHNCGMFeatures *features = [[UHNCGMFeatures alloc] initWithFeatureData:featureData];
+        expect(features.features).to.equal(CGMFeatureSupportedCalibration | CGMFeatureSupportedE2ECRC | CGMFeatureSupportedCGMTrend | CGMFeatureSupportedCGMQuality);
+        expect([features supportsFeatures:CGMFeatureSupportedE2ECRC | CGMFeatureSupportedCGMQuality]).to.beTruthy();
+        expect([features supportsFeatures:CGMFeatureSupportedCalibration | CGMFeatureSupportedAlertHypo]).to.beFalsy();
+        expect(features.fluidType).to.equal(GlucoseFluidTypeWholeBloodCapillary);
+        expect(features.sampleLocation).to.equal(GlucoseSampleLocationFinger);
+    });
+
+    it(@"should test the calibration status flags as bit positions", ^{
+        NSDictionary *calibrationDetails = @{kCGMCalibrationKeyValue: @110.f,
+                                             kCGMKeyTimeOffset: @60,
+                                             kCGMCalibrationKeyFluidType: @1,
+                                             kCGMCalibrationKeySampleLocation: @1,
+                                             kCGMKeyTimeOffsetNext: @780,
+                                             kCGMCalibrationKeyRecordNumber: @3,
+                                             kCGMCalibrationKeyStatus: @(1 << CGMCPCalibrationStatusDataOutOfRange)};
+        UHNCGMCalibration *calibration = [[UHNCGMCalibration alloc] initWithCalibrationDetails:calibrationDetails session:session];
+        expect(calibration.recordNumber).to.equal(3);
+        expect(calibration.glucoseConcentration).to.equal(110);
+        expect(calibration.isAccepted).to.beFalsy();
+        expect(CGMCalibrationStatusHas(calibration.status, CGMCPCalibrationStatusDataOutOfRange)).to.beTruthy();
+        expect(CGMCalibrationStatusHas(calibration.status, CGMCPCalibrationStatusDataRejected)).to.beFalsy();
+        expect(calibration.date).to.equal([session.clock dateForTimeOffset:60]);
+        expect(calibration.nextDate).to.equal([session.clock dateForTimeOffset:780]);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,78 @@
+//
+//  CGMSessionClockTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMSessionClock.h>
+#import <UHNCGMController/NSData+CGMParser.h>
+
+SpecBegin(CGMSessionClockSpecs)
+
+describe(@"CGM session clock", ^{
+
+    // 2026-10-19 08:30:00 UTC
+    int64_t const kSessionStartEpochTime = 1792398600;
+
+    __block UHNCGMSessionClock *sessionClock;
+
+    beforeEach(^{
+        sessionClock = [[UHNCGMSessionClock alloc] initWithSessionStartEpochTime:kSessionStartEpochTime];
+    });
+
+    it(@"should convert time offsets in minutes", ^{
+        expect([sessionClock epochTimeForTimeOffset:0]).to.equal(kSessionStartEpochTime);
+        expect([sessionClock epochTimeForTimeOffset:90]).to.equal(kSessionStartEpochTime + 90 * 60);
+        expect([[sessionClock dateForTimeOffset:5] timeIntervalSince1970]).to.equal(kSessionStartEpochTime + 300);
+        expect([sessionClock.sessionStartDate timeIntervalSince1970]).to.equal(kSessionStartEpochTime);
+    });
+
+    it(@"should share the date of a recently converted time offset", ^{
+        NSDate *date = [sessionClock dateForTimeOffset:10];
+        expect([sessionClock dateForTimeOffset:10]).to.beIdenticalTo(date);
+
+        [sessionClock dateForTimeOffset:10 + kCGMSessionClockDateCacheSize];
+        expect([sessionClock dateForTimeOffset:10]).notTo.beIdenticalTo(date);
+    });
+
+    it(@"should convert time offsets from several threads", ^{
+        __block NSUInteger numberOfWrongDates = 0;
+        dispatch_apply(1000, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+            NSUInteger timeOffset = iteration % (2 * kCGMSessionClockDateCacheSize);
+            if ([[sessionClock dateForTimeOffset:timeOffset] timeIntervalSince1970] != kSessionStartEpochTime + timeOffset * 60) {
+                @synchronized(sessionClock) {
+                    numberOfWrongDates++;
+                }
+            }
+        });
+        expect(numberOfWrongDates).to.equal(0);
+    });
+
+    it(@"should convert dates to whole minutes since the session start", ^{
+        NSDate *date = [NSDate dateWithTimeIntervalSince1970:kSessionStartEpochTime + 150];
+        expect([sessionClock timeOffsetForDate:date]).to.equal(2);
+
+        date = [NSDate dateWithTimeIntervalSince1970:kSessionStartEpochTime - 30];
+        expect([sessionClock timeOffsetForDate:date]).to.equal(-1);
+    });
+
+    it(@"should parse the session start time as epoch time", ^{
+        // 2026-10-19 04:30:00 local time at UTC-4 (16 steps of 15 minutes)
+        uint16_t year = 2026;
+        NSData *sessionStartTimeData = [NSData dataWithBytes:(uint8_t[]){year & 0xFF, year >> 8, 10, 19, 4, 30, 0, (uint8_t)-16, DSTStandardTime} length:9];
+        expect([sessionStartTimeData parseSessionStartEpochTime:NO]).to.equal(kSessionStartEpochTime);
+        expect([[sessionStartTimeData parseSessionStartTime:NO] timeIntervalSince1970]).to.equal(kSessionStartEpochTime);
+
+        // the same time at UTC-5 (20 steps of 15 minutes) with one hour of daylight saving time
+        NSData *daylightSavingTimeData = [NSData dataWithBytes:(uint8_t[]){year & 0xFF, year >> 8, 10, 19, 4, 30, 0, (uint8_t)-20, DSTPlusHourOne} length:9];
+        expect([daylightSavingTimeData parseSessionStartEpochTime:NO]).to.equal(kSessionStartEpochTime);
+
+        NSData *unknownTimeData = [NSData dataWithBytes:(uint8_t[]){0, 0, 0, 0, 0, 0, 0, 0, DSTUnknown} length:9];
+        expect([unknownTimeData parseSessionStartEpochTime:NO]).to.equal(kCGMEpochTimeUnknown);
+        expect([unknownTimeData parseSessionStartTime:NO]).to.beNil();
+    });
+});
+
+SpecEnd
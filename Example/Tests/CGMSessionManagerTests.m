@@ -0,0 +1,124 @@
+//
+//  CGMSessionManagerTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMSessionManager.h>
+#import <UHNCGMController/UHNCGMConstants.h>
+
+SpecBegin(CGMSessionManagerSpecs)
+
+describe(@"CGM session manager", ^{
+
+    int64_t const kDay = 24 * 60 * 60;
+    int64_t const kFirstStartTime = 1792398600;
+
+    __block UHNCGMSessionManager *sessionManager;
+
+    beforeEach(^{
+        sessionManager = [[UHNCGMSessionManager alloc] init];
+    });
+
+    it(@"should find a session by its start time", ^{
+        UHNCGMSession *session = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        expect(session.sessionID).to.equal(1);
+        expect(session.isActive).to.beTruthy();
+        expect([sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"]).to.beIdenticalTo(session);
+        expect([sessionManager sessionWithID:1]).to.beIdenticalTo(session);
+        expect(sessionManager.sessions.count).to.equal(1);
+    });
+
+    it(@"should find a session by a start time shifted within the tolerance", ^{
+        UHNCGMSession *session = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        expect([sessionManager sessionWithStartEpochTime:kFirstStartTime + 1 deviceIdentifier:@"A"]).to.beIdenticalTo(session);
+        expect([sessionManager sessionWithStartEpochTime:kFirstStartTime - kCGMSessionStartTimeTolerance deviceIdentifier:@"A"]).to.beIdenticalTo(session);
+        expect(session.isActive).to.beTruthy();
+        expect(session.startEpochTime).to.equal(kFirstStartTime);
+
+        UHNCGMSession *nextSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime + kCGMSessionStartTimeTolerance + 1 deviceIdentifier:@"A"];
+        expect(nextSession).notTo.beIdenticalTo(session);
+        expect(sessionManager.sessions.count).to.equal(2);
+    });
+
+    it(@"should stop the active session when the next one starts", ^{
+        UHNCGMSession *firstSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        UHNCGMSession *otherSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"B"];
+        UHNCGMSession *secondSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime + 10 * kDay deviceIdentifier:@"A"];
+
+        expect(firstSession.isActive).to.beFalsy();
+        expect(firstSession.stopEpochTime).to.equal(kFirstStartTime + 10 * kDay);
+        expect(otherSession.isActive).to.beTruthy();
+        expect([sessionManager activeSessionForDeviceIdentifier:@"A"]).to.beIdenticalTo(secondSession);
+        expect([sessionManager sessionsForDeviceIdentifier:@"A"]).to.equal(@[firstSession, secondSession]);
+    });
+
+    it(@"should keep an older session that is reported later in order", ^{
+        UHNCGMSession *newerSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime + 10 * kDay deviceIdentifier:@"A"];
+        UHNCGMSession *olderSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+
+        expect(newerSession.isActive).to.beTruthy();
+        expect(olderSession.stopEpochTime).to.equal(newerSession.startEpochTime);
+        expect([sessionManager sessionsForDeviceIdentifier:@"A"]).to.equal(@[olderSession, newerSession]);
+    });
+
+    it(@"should find the session of a time", ^{
+        UHNCGMSession *firstSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        [sessionManager stopActiveSessionForDeviceIdentifier:@"A" atEpochTime:kFirstStartTime + 7 * kDay];
+        UHNCGMSession *secondSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime + 10 * kDay deviceIdentifier:@"A"];
+
+        expect([sessionManager sessionForDeviceIdentifier:@"A" atEpochTime:kFirstStartTime]).to.beIdenticalTo(firstSession);
+        expect([sessionManager sessionForDeviceIdentifier:@"A" atEpochTime:kFirstStartTime + 8 * kDay]).to.beNil();
+        expect([sessionManager sessionForDeviceIdentifier:@"A" atEpochTime:kFirstStartTime + 20 * kDay]).to.beIdenticalTo(secondSession);
+        expect([sessionManager sessionForDeviceIdentifier:@"A" atEpochTime:kFirstStartTime - 1]).to.beNil();
+        expect([sessionManager sessionForDeviceIdentifier:@"B" atEpochTime:kFirstStartTime]).to.beNil();
+    });
+
+    it(@"should index the records of a session", ^{
+        UHNCGMSession *session = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        expect(session.newestTimeOffset).to.equal(NSNotFound);
+
+        expect([session addRecordWithTimeOffset:5]).to.beTruthy();
+        expect([session addRecordWithTimeOffset:10]).to.beTruthy();
+        expect([session addRecordWithTimeOffset:5]).to.beFalsy();
+
+        expect(session.numberOfRecords).to.equal(2);
+        expect(session.newestTimeOffset).to.equal(10);
+        expect([session containsRecordWithTimeOffset:10]).to.beTruthy();
+        expect([session numberOfRecordsInRange:NSMakeRange(6, 10)]).to.equal(1);
+    });
+
+    it(@"should detect the gaps of a session from its record index", ^{
+        UHNCGMSession *session = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        UHNCGMSession *otherSession = [sessionManager sessionWithStartEpochTime:kFirstStartTime + 20 * kDay deviceIdentifier:@"A"];
+        session.gapDetector.communicationInterval = 5;
+        [session addRecordWithTimeOffset:0];
+        [session addRecordWithTimeOffset:5];
+        [session addRecordWithTimeOffset:30];
+        expect(session.gapDetector.numberOfMissingRanges).to.equal(1);
+
+        // the records of another session do not touch the missing ranges
+        [otherSession addRecordWithTimeOffset:10];
+        expect([session.gapDetector missingRangeAtIndex:0].location).to.equal(6);
+
+        // a duplicate is not added again, and a stored record fills the range
+        [session addRecordWithTimeOffset:30];
+        [session addRecordWithTimeOffset:29];
+        expect(session.gapDetector.numberOfMissingRanges).to.equal(0);
+        expect(session.gapDetector.newestTimeOffset).to.equal(30);
+    });
+
+    it(@"should not reuse session identifiers", ^{
+        [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        [sessionManager removeAllSessions];
+        expect(sessionManager.sessions.count).to.equal(0);
+        expect([sessionManager activeSessionForDeviceIdentifier:@"A"]).to.beNil();
+
+        UHNCGMSession *session = [sessionManager sessionWithStartEpochTime:kFirstStartTime deviceIdentifier:@"A"];
+        expect(session.sessionID).to.equal(2);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,91 @@
+//
+//  CGMSettingsTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMSettings.h>
+
+SpecBegin(CGMSettingsSpecs)
+
+describe(@"CGM settings", ^{
+
+    __block UHNCGMSettings *settings;
+
+    beforeEach(^{
+        settings = [[UHNCGMSettings alloc] init];
+    });
+
+    it(@"should not know any value initially", ^{
+        for (NSUInteger setting = 0; setting < kCGMSettingCount; setting++) {
+            expect([settings isSettingSupported:setting]).to.beTruthy();
+            expect([settings hasValueForSetting:setting]).to.beFalsy();
+        }
+        expect(isnan([settings valueForSetting:CGMSettingAlertLevelHypo])).to.beTruthy();
+    });
+
+    it(@"should request all settings supported by the features", ^{
+        settings.supportedFeatures = CGMFeatureSupportedAlertHypo | CGMFeatureSupportedAlertIncreaseDecreaseRate;
+        [settings beginRefresh];
+
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeCommIntervalGet);
+        [settings updateValue:5 forResponseOpCode:CGMCPOpCodeCommIntervalResponse];
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeAlertLevelHypoGet);
+        expect(settings.requestedOpCode).to.equal(CGMCPOpCodeAlertLevelHypoGet);
+        [settings updateValue:70 forResponseOpCode:CGMCPOpCodeAlertLevelHypoReponse];
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeAlertLevelRateDecreaseGet);
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeAlertLevelRateIncreaseGet);
+        expect([settings nextOpCodeToRequest]).to.equal(NSNotFound);
+        expect(settings.isRefreshing).to.beFalsy();
+
+        expect([settings valueForSetting:CGMSettingCommunicationInterval]).to.equal(5);
+        expect([settings valueForSetting:CGMSettingAlertLevelHypo]).to.equal(70);
+        expect([settings hasValueForSetting:CGMSettingAlertLevelHyper]).to.beFalsy();
+    });
+
+    it(@"should skip settings that are not supported by the sensor", ^{
+        [settings didFailRequestOpCode:CGMCPOpCodeAlertLevelPatientHighGet responseCode:CGMCPOpCodeNotSupported];
+        [settings didFailRequestOpCode:CGMCPOpCodeAlertLevelHyperSet responseCode:CGMCPParameterOutOfRange];
+        expect([settings isSettingSupported:CGMSettingAlertLevelPatientHigh]).to.beFalsy();
+        expect([settings isSettingSupported:CGMSettingAlertLevelHyper]).to.beTruthy();
+
+        [settings beginRefresh];
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeCommIntervalGet);
+        expect([settings nextOpCodeToRequest]).to.equal(CGMCPOpCodeAlertLevelPatientLowGet);
+    });
+
+    it(@"should keep a written value once it is confirmed", ^{
+        [settings willSetValue:180 forRequestOpCode:CGMCPOpCodeAlertLevelHyperSet];
+        expect([settings hasValueForSetting:CGMSettingAlertLevelHyper]).to.beFalsy();
+        [settings didSucceedRequestOpCode:CGMCPOpCodeAlertLevelHyperSet];
+        expect([settings valueForSetting:CGMSettingAlertLevelHyper]).to.equal(180);
+
+        [settings willSetValue:200 forRequestOpCode:CGMCPOpCodeAlertLevelHyperSet];
+        [settings didFailRequestOpCode:CGMCPOpCodeAlertLevelHyperSet responseCode:CGMCPParameterOutOfRange];
+        [settings didSucceedRequestOpCode:CGMCPOpCodeAlertLevelHyperSet];
+        expect([settings valueForSetting:CGMSettingAlertLevelHyper]).to.equal(180);
+    });
+
+    it(@"should cancel a refresh", ^{
+        [settings beginRefresh];
+        [settings nextOpCodeToRequest];
+        [settings updateValue:5 forResponseOpCode:CGMCPOpCodeCommIntervalResponse];
+        [settings cancelRefresh];
+        expect(settings.isRefreshing).to.beFalsy();
+        expect(settings.requestedOpCode).to.equal(NSNotFound);
+        expect([settings nextOpCodeToRequest]).to.equal(NSNotFound);
+        expect([settings valueForSetting:CGMSettingCommunicationInterval]).to.equal(5);
+    });
+
+    it(@"should reset", ^{
+        settings.supportedFeatures = 0;
+        [settings updateValue:5 forResponseOpCode:CGMCPOpCodeCommIntervalResponse];
+        [settings reset];
+        expect([settings hasValueForSetting:CGMSettingCommunicationInterval]).to.beFalsy();
+        expect([settings isSettingSupported:CGMSettingAlertLevelHypo]).to.beTruthy();
+    });
+});
+
+SpecEnd
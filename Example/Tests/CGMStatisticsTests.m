@@ -0,0 +1,133 @@
+//
+//  CGMStatisticsTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMStatistics.h>
+#import <UHNCGMController/UHNCGMConstants.h>
+
+SpecBegin(CGMStatisticsSpecs)
+
+describe(@"CGM glycemic statistics", ^{
+
+    __block UHNCGMStatistics *statistics;
+
+    beforeEach(^{
+        statistics = [[UHNCGMStatistics alloc] init];
+    });
+
+    it(@"should report an empty summary without readings", ^{
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfReadings).to.equal(0);
+        expect(summary.meanGlucose).to.equal(0);
+        expect(statistics.newestTimeOffset).to.equal(NSNotFound);
+    });
+
+    it(@"should calculate the mean, SD, CV and GMI", ^{
+        [statistics addGlucoseConcentration:100 atTimeOffset:0];
+        [statistics addGlucoseConcentration:200 atTimeOffset:5];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfReadings).to.equal(2);
+        expect(summary.meanGlucose).to.beCloseToWithin(150, 0.001);
+        expect(summary.standardDeviation).to.beCloseToWithin(50, 0.001);
+        expect(summary.coefficientOfVariation).to.beCloseToWithin(1./3., 0.001);
+        expect(summary.glucoseManagementIndicator).to.beCloseToWithin(3.31 + 0.02392 * 150, 0.001);
+    });
+
+    it(@"should calculate the time in ranges", ^{
+        [statistics addGlucoseConcentration:50 atTimeOffset:0];
+        [statistics addGlucoseConcentration:65 atTimeOffset:5];
+        [statistics addGlucoseConcentration:120 atTimeOffset:10];
+        [statistics addGlucoseConcentration:200 atTimeOffset:15];
+        [statistics addGlucoseConcentration:300 atTimeOffset:20];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.timeBelowHypo).to.beCloseToWithin(0.2, 0.001);
+        expect(summary.timeBelowRange).to.beCloseToWithin(0.4, 0.001);
+        expect(summary.timeInRange).to.beCloseToWithin(0.2, 0.001);
+        expect(summary.timeAboveRange).to.beCloseToWithin(0.4, 0.001);
+        expect(summary.timeAboveHyper).to.beCloseToWithin(0.2, 0.001);
+    });
+
+    it(@"should reclassify readings when the thresholds change", ^{
+        [statistics addGlucoseConcentration:65 atTimeOffset:0];
+        [statistics addGlucoseConcentration:120 atTimeOffset:5];
+        statistics.levelPatientLow = 60;
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.timeInRange).to.beCloseToWithin(1, 0.001);
+        expect(summary.timeBelowRange).to.beCloseToWithin(0, 0.001);
+    });
+
+    it(@"should ignore duplicate readings", ^{
+        [statistics addGlucoseConcentration:100 atTimeOffset:5];
+        [statistics addGlucoseConcentration:300 atTimeOffset:5];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfReadings).to.equal(1);
+        expect(summary.meanGlucose).to.beCloseToWithin(100, 0.001);
+    });
+
+    it(@"should evict readings that leave a window", ^{
+        [statistics addGlucoseConcentration:100 atTimeOffset:0];
+        [statistics addGlucoseConcentration:200 atTimeOffset:CGMStatisticsWindowDay];
+
+        CGMGlycemicSummary daySummary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(daySummary.numberOfReadings).to.equal(1);
+        expect(daySummary.meanGlucose).to.beCloseToWithin(200, 0.001);
+
+        CGMGlycemicSummary weekSummary = [statistics summaryForWindow:CGMStatisticsWindowWeek];
+        expect(weekSummary.numberOfReadings).to.equal(2);
+
+        [statistics addGlucoseConcentration:150 atTimeOffset:CGMStatisticsWindowTwoWeeks + 10];
+        CGMGlycemicSummary twoWeekSummary = [statistics summaryForWindow:CGMStatisticsWindowTwoWeeks];
+        expect(twoWeekSummary.numberOfReadings).to.equal(2);
+    });
+
+    it(@"should accept backfilled readings out of order", ^{
+        [statistics addGlucoseConcentration:100 atTimeOffset:60];
+        [statistics addGlucoseConcentration:200 atTimeOffset:10];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfReadings).to.equal(2);
+        expect(statistics.newestTimeOffset).to.equal(60);
+    });
+
+    it(@"should count hypo episodes", ^{
+        // first episode
+        [statistics addGlucoseConcentration:50 atTimeOffset:0];
+        [statistics addGlucoseConcentration:45 atTimeOffset:5];
+        // second episode after a reading above the hypo level
+        [statistics addGlucoseConcentration:80 atTimeOffset:10];
+        [statistics addGlucoseConcentration:50 atTimeOffset:15];
+        // third episode after a gap in the readings
+        [statistics addGlucoseConcentration:50 atTimeOffset:15 + kCGMStatisticsEpisodeGapInMinutes + 1];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfHypoEpisodes).to.equal(3);
+
+        // backfilling the gap joins the second and third episodes
+        [statistics addGlucoseConcentration:50 atTimeOffset:20];
+        summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfHypoEpisodes).to.equal(2);
+
+        // backfilling a reading above the hypo level splits the first episode
+        [statistics addGlucoseConcentration:90 atTimeOffset:3];
+        summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfHypoEpisodes).to.equal(3);
+    });
+
+    it(@"should add the reading of measurement details", ^{
+        [statistics addMeasurementDetails:@{kCGMMeasurementKeyGlucoseConcentration: @(120), kCGMKeyTimeOffset: @(30)}];
+
+        CGMGlycemicSummary summary = [statistics summaryForWindow:CGMStatisticsWindowDay];
+        expect(summary.numberOfReadings).to.equal(1);
+        expect(statistics.newestTimeOffset).to.equal(30);
+    });
+});
+
+SpecEnd
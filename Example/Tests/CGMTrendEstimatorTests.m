@@ -0,0 +1,85 @@
+//
+//  CGMTrendEstimatorTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNCGMController/UHNCGMTrendEstimator.h>
+#import <UHNCGMController/NSDictionary+CGMExtensions.h>
+
+SpecBegin(CGMTrendEstimatorSpecs)
+
+describe(@"CGM trend estimation", ^{
+
+    __block UHNCGMTrendEstimator *trendEstimator;
+
+    beforeEach(^{
+        trendEstimator = [[UHNCGMTrendEstimator alloc] init];
+    });
+
+    it(@"should not estimate a trend without enough readings", ^{
+        [trendEstimator addGlucoseConcentration:100 atTimeOffset:0];
+        float rateOfChange = [trendEstimator addGlucoseConcentration:105 atTimeOffset:5];
+        expect(isnan(rateOfChange)).to.beTruthy();
+    });
+
+    it(@"should estimate the rate of change of a linear trend", ^{
+        for (NSUInteger timeOffset = 0; timeOffset <= 30; timeOffset += 5) {
+            [trendEstimator addGlucoseConcentration:100 - 2 * timeOffset atTimeOffset:timeOffset];
+        }
+        expect(trendEstimator.rateOfChange).to.beCloseToWithin(-2, 0.001);
+    });
+
+    it(@"should ignore non-finite readings", ^{
+        for (NSUInteger timeOffset = 0; timeOffset <= 30; timeOffset += 5) {
+            [trendEstimator addGlucoseConcentration:100 - 2 * timeOffset atTimeOffset:timeOffset];
+        }
+        [trendEstimator addGlucoseConcentration:INFINITY atTimeOffset:35];
+        [trendEstimator addGlucoseConcentration:NAN atTimeOffset:40];
+        float rateOfChange = [trendEstimator addGlucoseConcentration:10 atTimeOffset:45];
+        expect(rateOfChange).to.beCloseToWithin(-2, 0.001);
+    });
+
+    it(@"should only use the readings within the window", ^{
+        // a rise followed by a flat period longer than the window
+        for (NSUInteger timeOffset = 0; timeOffset <= 30; timeOffset++) {
+            [trendEstimator addGlucoseConcentration:100 + 3 * timeOffset atTimeOffset:timeOffset];
+        }
+        for (NSUInteger timeOffset = 31; timeOffset <= 31 + kCGMTrendEstimatorDefaultWindowInMinutes; timeOffset++) {
+            [trendEstimator addGlucoseConcentration:190 atTimeOffset:timeOffset];
+        }
+        expect(trendEstimator.rateOfChange).to.beCloseToWithin(0, 0.001);
+    });
+
+    it(@"should restart when readings go back in time", ^{
+        for (NSUInteger timeOffset = 100; timeOffset <= 110; timeOffset += 5) {
+            [trendEstimator addGlucoseConcentration:100 atTimeOffset:timeOffset];
+        }
+        float rateOfChange = [trendEstimator addGlucoseConcentration:100 atTimeOffset:10];
+        expect(isnan(rateOfChange)).to.beTruthy();
+    });
+
+    it(@"should classify trend arrows", ^{
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:NAN]).to.equal(CGMTrendArrowUnknown);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:3.5]).to.equal(CGMTrendArrowRisingRapidly);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:2.5]).to.equal(CGMTrendArrowRising);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:1.5]).to.equal(CGMTrendArrowRisingSlightly);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:0]).to.equal(CGMTrendArrowFlat);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:-1.5]).to.equal(CGMTrendArrowFallingSlightly);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:-2.5]).to.equal(CGMTrendArrowFalling);
+        expect([UHNCGMTrendEstimator trendArrowForRateOfChange:-3.5]).to.equal(CGMTrendArrowFallingRapidly);
+    });
+
+    it(@"should prefer the sensor trend as rate of change", ^{
+        NSDictionary *measurementDetails = @{kCGMMeasurementKeyTrendInfo: @(1.5), kCGMMeasurementKeyDerivedTrendInfo: @(-1.5)};
+        expect([measurementDetails rateOfChange]).to.equal(@(1.5));
+
+        measurementDetails = @{kCGMMeasurementKeyDerivedTrendInfo: @(-1.5), kCGMMeasurementKeyTrendArrow: @(CGMTrendArrowFallingSlightly)};
+        expect([measurementDetails rateOfChange]).to.equal(@(-1.5));
+        expect([measurementDetails trendArrow]).to.equal(CGMTrendArrowFallingSlightly);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,172 @@
+//
+//  ChartRendererTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNTimeSeriesPlotView/UHNTimeSeriesPlotView.h>
+
+static void ChartRendererTestsCountPathElement(void *info, const CGPathElement *element)
+{
+    (*(NSUInteger*)info)++;
+}
+
+static NSUInteger ChartRendererTestsNumberOfPathElements(CGPathRef path)
+{
+    NSUInteger numberOfElements = 0;
+    CGPathApply(path, &numberOfElements, ChartRendererTestsCountPathElement);
+    return numberOfElements;
+}
+
+// the RGBA components of the pixel of an image at a point
+static void ChartRendererTestsGetPixel(UIImage *image, CGPoint point, uint8_t pixel[4])
+{
+    CGImageRef cgImage = image.CGImage;
+    CGFloat width = CGImageGetWidth(cgImage);
+    CGFloat height = CGImageGetHeight(cgImage);
+    CGFloat x = floor(point.x * image.scale);
+    CGFloat y = floor(point.y * image.scale);
+    
+    memset(pixel, 0, 4);
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(pixel, 1, 1, 8, 4, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+    CGContextDrawImage(context, CGRectMake(-x, y - height + 1, width, height), cgImage);
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+}
+
+SpecBegin(ChartRendererSpecs)
+
+describe(@"Offscreen chart rendering", ^{
+
+    __block UHNTimeSeriesChartRenderer *renderer;
+    __block UHNChartSeries *series;
+
+    beforeEach(^{
+        renderer = [[UHNTimeSeriesChartRenderer alloc] init];
+        renderer.size = CGSizeMake(320, 160);
+        renderer.xAxisMax = 24 * 60;
+        renderer.xMinorStep = 60;
+        renderer.xMajorStep = 6 * 60;
+        renderer.xAxisLabel = @"min";
+        renderer.yAxisMax = 400;
+        renderer.yMinorStep = 25;
+        renderer.yMajorStep = 100;
+        renderer.yAxisLabel = @"mg/dL";
+
+        // a day of 5 minute readings
+        double times[288], values[288];
+        for (NSUInteger index = 0; index < 288; index++) {
+            times[index] = index * 5;
+            values[index] = 150. + 50. * sin(index / 20.);
+        }
+        series = [UHNChartSeries lineWithValues: values atTimes: times count: 288];
+    });
+
+    it(@"should render a chart into an image", ^{
+        UIImage *image = [renderer imageWithSeries: @[series]];
+        expect(image.size.width).to.equal(320);
+        expect(image.size.height).to.equal(160);
+        expect(image.scale).to.equal(2);
+    });
+
+    it(@"should draw the series in the plot area", ^{
+        // a flat line at 200 mg/dL, half way up the plot area
+        double times[2] = {0, 24 * 60};
+        double values[2] = {200, 200};
+        UHNChartSeries *flatSeries = [UHNChartSeries lineWithValues: values atTimes: times count: 2];
+        flatSeries.color = [UIColor redColor];
+        flatSeries.lineWidth = 3;
+
+        UIImage *image = [renderer imageWithSeries: @[flatSeries]];
+        uint8_t pixel[4];
+        ChartRendererTestsGetPixel(image, CGPointMake(190, 70), pixel);
+        expect(pixel[0]).to.beGreaterThan(200);
+        expect(pixel[1]).to.beLessThan(50);
+        expect(pixel[2]).to.beLessThan(50);
+
+        // the white background between the grid lines
+        ChartRendererTestsGetPixel(image, CGPointMake(190, 100), pixel);
+        expect(pixel[0]).to.equal(255);
+        expect(pixel[1]).to.equal(255);
+        expect(pixel[2]).to.equal(255);
+    });
+
+    it(@"should render with the default steps", ^{
+        UHNTimeSeriesChartRenderer *defaultRenderer = [[UHNTimeSeriesChartRenderer alloc] init];
+        defaultRenderer.xAxisMax = 24 * 60;
+        defaultRenderer.yAxisMax = 400;
+        expect([defaultRenderer imageWithSeries: @[series]]).notTo.beNil();
+
+        UHNScaleLayoutKey key = {0};
+        key.max = 400;
+        key.size = CGSizeMake(40, 300);
+        key.contentScale = 2;
+        UHNScaleLayout *layout = [UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: @"%.0f" units: nil];
+        expect(layout.numberOfLabels).to.equal(1);
+        expect(CGPathIsEmpty(layout.tickPath)).to.beTruthy();
+    });
+
+    it(@"should not decimate a series with fewer data points than pixel columns", ^{
+        CGPathRef path = [renderer newPathForLine: series];
+        expect(ChartRendererTestsNumberOfPathElements(path)).to.equal(288);
+        CGPathRelease(path);
+    });
+
+    it(@"should render one PDF page per chart", ^{
+        NSData *data = [renderer PDFDataWithPages: @[@[series], @[series]]];
+        CGDataProviderRef provider = CGDataProviderCreateWithCFData((__bridge CFDataRef)data);
+        CGPDFDocumentRef document = CGPDFDocumentCreateWithProvider(provider);
+        expect(CGPDFDocumentGetNumberOfPages(document)).to.equal(2);
+        CGPDFDocumentRelease(document);
+        CGDataProviderRelease(provider);
+    });
+
+    it(@"should render many charts concurrently", ^{
+        NSMutableArray *charts = [NSMutableArray array];
+        for (NSUInteger index = 0; index < 14; index++) {
+            [charts addObject: @[series]];
+        }
+
+        __block NSArray *images = nil;
+        waitUntil(^(DoneCallback done) {
+            [renderer renderImagesWithCharts: charts completion: ^(NSArray *renderedImages) {
+                images = renderedImages;
+                done();
+            }];
+        });
+        expect(images.count).to.equal(14);
+        expect(images[13]).to.beKindOf([UIImage class]);
+    });
+
+    it(@"should decimate a long history", ^{
+        // 90 days of 5 minute readings
+        NSUInteger count = 90 * 288;
+        double *times = malloc(count * sizeof(double));
+        double *values = malloc(count * sizeof(double));
+        for (NSUInteger index = 0; index < count; index++) {
+            times[index] = index * 5;
+            values[index] = 150. + 100. * sin(index / 20.);
+        }
+        UHNChartSeries *history = [UHNChartSeries lineWithValues: values atTimes: times count: count];
+        free(times);
+        free(values);
+        renderer.xAxisMax = count * 5;
+
+        // a minimum and a maximum for each of the 560 pixel columns of the plot area
+        CGPathRef path = [renderer newPathForLine: history];
+        NSUInteger numberOfElements = ChartRendererTestsNumberOfPathElements(path);
+        expect(numberOfElements).to.beGreaterThan(0);
+        expect(numberOfElements).to.beLessThanOrEqualTo(2 * 560 + 2);
+
+        // which still reach the extremes of the readings, from 250 down to 50 mg/dL
+        CGRect bounds = CGPathGetBoundingBox(path);
+        expect(CGRectGetMinY(bounds)).to.beCloseToWithin(140 - 140 * 250 / 400., 0.5);
+        expect(CGRectGetMaxY(bounds)).to.beCloseToWithin(140 - 140 * 50 / 400., 0.5);
+        CGPathRelease(path);
+    });
+});
+
+SpecEnd
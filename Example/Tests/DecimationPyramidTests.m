@@ -0,0 +1,77 @@
+//
+//  DecimationPyramidTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNTimeSeriesPlotView/UHNDecimationPyramid.h>
+
+SpecBegin(DecimationPyramidSpecs)
+
+describe(@"Plot decimation pyramid", ^{
+
+    __block UHNDecimationPyramid *pyramid;
+
+    beforeEach(^{
+        pyramid = [[UHNDecimationPyramid alloc] initWithCapacity: 16];
+    });
+
+    it(@"should only have levels with at least two buckets", ^{
+        expect(pyramid.numberOfLevels).to.equal(3);
+        expect([[UHNDecimationPyramid alloc] initWithCapacity: 3].numberOfLevels).to.equal(0);
+    });
+
+    it(@"should keep the min and max of each bucket", ^{
+        double values[] = {5, 1, 7, 3, 2, 9, 4, 8};
+        [pyramid appendValues: values count: 8];
+
+        UHNMinMax minMax = [pyramid minMaxOfBucket: 0 atLevel: 1];
+        expect(minMax.minimum).to.equal(1);
+        expect(minMax.maximum).to.equal(5);
+
+        minMax = [pyramid minMaxOfBucket: 1 atLevel: 2];
+        expect(minMax.minimum).to.equal(2);
+        expect(minMax.maximum).to.equal(9);
+
+        minMax = [pyramid minMaxOfBucket: 0 atLevel: 3];
+        expect(minMax.minimum).to.equal(1);
+        expect(minMax.maximum).to.equal(9);
+    });
+
+    it(@"should update the newest bucket as data points are appended", ^{
+        double values[] = {5, 1, 7};
+        [pyramid appendValues: values count: 3];
+        UHNMinMax minMax = [pyramid minMaxOfBucket: 1 atLevel: 1];
+        expect(minMax.minimum).to.equal(7);
+        expect(minMax.maximum).to.equal(7);
+    });
+
+    it(@"should keep the buckets aligned when data points are skipped", ^{
+        double values[20];
+        for (NSUInteger index = 0; index < 20; index++) {
+            values[index] = index;
+        }
+        [pyramid appendValues: values count: 20];
+        expect(pyramid.numberOfValues).to.equal(20);
+
+        // data points 0 to 3 were skipped, so bucket 0 of level 3 starts at data point 4
+        UHNMinMax minMax = [pyramid minMaxOfBucket: 0 atLevel: 3];
+        expect(minMax.minimum).to.equal(4);
+        expect(minMax.maximum).to.equal(7);
+
+        minMax = [pyramid minMaxOfBucket: 2 atLevel: 3];
+        expect(minMax.minimum).to.equal(16);
+        expect(minMax.maximum).to.equal(19);
+    });
+
+    it(@"should choose the level from the data points per pixel", ^{
+        expect([pyramid levelForDataPointsPerPixel: 0.5]).to.equal(0);
+        expect([pyramid levelForDataPointsPerPixel: 2]).to.equal(1);
+        expect([pyramid levelForDataPointsPerPixel: 7]).to.equal(2);
+        expect([pyramid levelForDataPointsPerPixel: 1000]).to.equal(3);
+    });
+});
+
+SpecEnd
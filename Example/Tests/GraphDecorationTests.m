@@ -0,0 +1,81 @@
+//
+//  GraphDecorationTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNTimeSeriesPlotView/UHNTimeSeriesPlotView.h>
+
+SpecBegin(GraphDecorationSpecs)
+
+describe(@"Plot decorations", ^{
+
+    __block UHNScrollingTimeSeriesPlotView *plotView;
+
+    beforeEach(^{
+        plotView = [[UHNScrollingTimeSeriesPlotView alloc] initWithFrame: CGRectMake(0, 0, 320, 200)];
+        [plotView setupPlotWithXAxisMin: 0.
+                               xAxisMax: 60.
+                             xMinorStep: 5.
+                             xMajorStep: 15.
+                             xAxisLabel: @"min"
+                      xAxisFormatString: @"%.0f"
+                               yAxisMin: 0.
+                               yAxisMax: 400.
+                             yMinorStep: 25.
+                             yMajorStep: 100.
+                             yAxisLabel: @"mg/dL"
+                      yAxisFormatString: @"%.0f"
+                              gridColor: [UIColor whiteColor]
+                         gridFrameWidth: 1
+                          drawGridFrame: YES
+                      fadeGridLineEdges: NO
+                              lineColor: [UIColor whiteColor]
+                          lineHeadColor: [UIColor redColor]
+                           andLineWidth: 1];
+        plotView.samplingRateInHz = 1;
+        plotView.windowMaxSize = 60;
+    });
+
+    it(@"should draw all threshold bands as a single path", ^{
+        UHNThresholdBandDecoration *bands = [[UHNThresholdBandDecoration alloc] initWithFrame: plotView.bounds];
+        [bands addBandFromValue: 0 toValue: 70];
+        [bands addBandFromValue: 250 toValue: 500];
+        [plotView addDecoration: bands];
+        [bands layoutInGraph: plotView];
+
+        expect(bands.numberOfBands).to.equal(2);
+        CGPathRef path = ((CAShapeLayer*)bands.layer).path;
+        expect(path != NULL).to.beTruthy();
+        expect(CGPathIsEmpty(path)).to.beFalsy();
+
+        [bands removeAllBands];
+        [bands layoutInGraph: plotView];
+        expect(bands.numberOfBands).to.equal(0);
+        expect(CGPathIsEmpty(((CAShapeLayer*)bands.layer).path)).to.beTruthy();
+    });
+
+    it(@"should keep event markers until they are removed", ^{
+        UHNEventMarkerDecoration *markers = [[UHNEventMarkerDecoration alloc] initWithFrame: plotView.bounds];
+        [plotView addDecoration: markers];
+        for (NSUInteger time = 0; time < 100; time += 10) {
+            [markers addMarkerAtTime: time];
+        }
+        expect(markers.numberOfMarkers).to.equal(10);
+
+        [markers removeAllMarkers];
+        expect(markers.numberOfMarkers).to.equal(0);
+    });
+
+    it(@"should place times relative to the newest time-keyed data point", ^{
+        expect(isnan([plotView screenValueForTime: 0])).to.beTruthy();
+
+        [plotView addValue: 100 atTime: 0];
+        [plotView addValue: 110 atTime: 30];
+        expect([plotView screenValueForTime: 30]).to.beGreaterThan([plotView screenValueForTime: 0]);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,58 @@
+//
+//  ScaleLayoutTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNTimeSeriesPlotView/UHNTimeSeriesPlotView.h>
+
+SpecBegin(ScaleLayoutSpecs)
+
+describe(@"Scale layout cache", ^{
+
+    __block UHNScaleLayoutKey key;
+
+    beforeEach(^{
+        memset(&key, 0, sizeof(UHNScaleLayoutKey));
+        key.min = 0;
+        key.max = 400;
+        key.minorStep = 25;
+        key.majorStep = 100;
+        key.size = CGSizeMake(40, 200);
+        key.contentScale = 2;
+    });
+
+    it(@"should return a cached layout for the same axis, key and label format", ^{
+        UHNScaleLayout *layout = [UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: @"%.0f" units: @"mg/dL"];
+        expect([UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: @"%.0f" units: @"mg/dL"]).to.beIdenticalTo(layout);
+        expect([UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisX key: key formatString: @"%.0f" units: @"mg/dL"]).notTo.beIdenticalTo(layout);
+        expect([layout matchesKey: key formatString: @"%.0f" units: @"mg/dL"]).to.beTruthy();
+        expect([layout matchesKey: key formatString: @"%.1f" units: @"mg/dL"]).to.beFalsy();
+
+        key.max = 300;
+        expect([layout matchesKey: key formatString: @"%.0f" units: @"mg/dL"]).to.beFalsy();
+        expect([UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: @"%.0f" units: @"mg/dL"]).notTo.beIdenticalTo(layout);
+    });
+
+    it(@"should pre-render the labels and ticks", ^{
+        UHNScaleLayout *layout = [UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: @"%.0f" units: nil];
+
+        // 100, 200 and 300 at the major steps, and 400 at the maximum
+        expect(layout.numberOfLabels).to.equal(4);
+        expect(CGPathIsEmpty(layout.tickPath)).to.beFalsy();
+    });
+
+    it(@"should place grid lines at every step", ^{
+        CGPathRef path = [UHNScaleLayout newGridPathForAxis: UHNScaleLayoutAxisY key: key step: 100 length: 40];
+        CGRect bounds = CGPathGetBoundingBox(path);
+        CGPathRelease(path);
+
+        expect(bounds.origin.y).to.equal(UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, 300));
+        expect(CGRectGetMaxY(bounds)).to.equal(UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, 100));
+        expect(bounds.size.width).to.equal(40);
+    });
+});
+
+SpecEnd
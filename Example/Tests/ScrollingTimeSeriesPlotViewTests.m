@@ -0,0 +1,351 @@
+//
+//  ScrollingTimeSeriesPlotViewTests.m
+//  UHNCGMControllerTests
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import <UHNTimeSeriesPlotView/UHNTimeSeriesPlotView.h>
+
+static const NSUInteger kFullWindowNumberOfDataPoints = 10000;
+static const NSUInteger kNumberOfUpdates = 20;
+
+@interface CountingPlotView : UHNScrollingTimeSeriesPlotView
+@property (nonatomic, assign) NSUInteger numberOfPlotUpdates;
+@end
+
+@implementation CountingPlotView
+
+- (void)updatePlot
+{
+    self.numberOfPlotUpdates++;
+    [super updatePlot];
+}
+
+@end
+
+static void ScrollingPlotViewTestsCountPathElement(void *info, const CGPathElement *element)
+{
+    (*(NSUInteger*)info)++;
+}
+
+static NSUInteger ScrollingPlotViewTestsNumberOfPathElements(CGPathRef path)
+{
+    NSUInteger numberOfElements = 0;
+    CGPathApply(path, &numberOfElements, ScrollingPlotViewTestsCountPathElement);
+    return numberOfElements;
+}
+
+// the layers of the tiles of the cached history, oldest first
+static NSArray *ScrollingPlotViewTestsTileLayers(UHNScrollingTimeSeriesPlotView *plotView)
+{
+    NSMutableArray *tileLayers = [NSMutableArray array];
+    for (CALayer *layer in plotView.layer.sublayers) {
+        if (layer.delegate) {
+            continue;
+        }
+        for (CALayer *sublayer in layer.sublayers) {
+            if ([sublayer isKindOfClass: [CAShapeLayer class]]) {
+                [tileLayers addObject: sublayer];
+            }
+        }
+    }
+    return tileLayers;
+}
+
+// the number of tiles whose path was rebuilt since the paths of the tiles were taken, including the tiles added since
+static NSUInteger ScrollingPlotViewTestsNumberOfRebuiltTiles(UHNScrollingTimeSeriesPlotView *plotView, NSArray *tileLayers, NSArray *tilePaths)
+{
+    NSUInteger numberOfRebuiltTiles = 0;
+    for (CAShapeLayer *tileLayer in ScrollingPlotViewTestsTileLayers(plotView)) {
+        NSUInteger index = [tileLayers indexOfObjectIdenticalTo: tileLayer];
+        if (index == NSNotFound || (__bridge CGPathRef)tilePaths[index] != tileLayer.path) {
+            numberOfRebuiltTiles++;
+        }
+    }
+    return numberOfRebuiltTiles;
+}
+
+// the paths of the tiles, which are kept so their addresses are not reused by rebuilt paths
+static NSArray *ScrollingPlotViewTestsTilePaths(NSArray *tileLayers)
+{
+    NSMutableArray *tilePaths = [NSMutableArray arrayWithCapacity: tileLayers.count];
+    for (CAShapeLayer *tileLayer in tileLayers) {
+        [tilePaths addObject: (__bridge id)tileLayer.path];
+    }
+    return tilePaths;
+}
+
+// the number of pixels drawRect: draws in a transparent image of the plot view
+static NSUInteger ScrollingPlotViewTestsNumberOfDrawnPixels(UHNScrollingTimeSeriesPlotView *plotView)
+{
+    UIGraphicsBeginImageContextWithOptions(plotView.bounds.size, NO, 1);
+    [plotView drawRect: plotView.bounds];
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    
+    CGImageRef cgImage = image.CGImage;
+    CFDataRef data = CGDataProviderCopyData(CGImageGetDataProvider(cgImage));
+    const uint32_t *pixels = (const uint32_t*)CFDataGetBytePtr(data);
+    size_t pixelsPerRow = CGImageGetBytesPerRow(cgImage) / sizeof(uint32_t);
+    NSUInteger numberOfDrawnPixels = 0;
+    for (size_t y = 0; y < CGImageGetHeight(cgImage); y++) {
+        for (size_t x = 0; x < CGImageGetWidth(cgImage); x++) {
+            if (pixels[y * pixelsPerRow + x] != 0) {
+                numberOfDrawnPixels++;
+            }
+        }
+    }
+    CFRelease(data);
+    return numberOfDrawnPixels;
+}
+
+SpecBegin(ScrollingTimeSeriesPlotViewSpecs)
+
+describe(@"Scrolling time series plot view", ^{
+
+    __block UHNScrollingTimeSeriesPlotView *plotView;
+
+    beforeEach(^{
+        plotView = [[UHNScrollingTimeSeriesPlotView alloc] initWithFrame: CGRectMake(0, 0, 320, 200)];
+        [plotView setupPlotWithXAxisMin: 0.
+                               xAxisMax: 60.
+                             xMinorStep: 5.
+                             xMajorStep: 15.
+                             xAxisLabel: @"min"
+                      xAxisFormatString: @"%.0f"
+                               yAxisMin: 0.
+                               yAxisMax: 400.
+                             yMinorStep: 25.
+                             yMajorStep: 100.
+                             yAxisLabel: @"mg/dL"
+                      yAxisFormatString: @"%.0f"
+                              gridColor: [UIColor whiteColor]
+                         gridFrameWidth: 1
+                          drawGridFrame: YES
+                      fadeGridLineEdges: NO
+                              lineColor: [UIColor whiteColor]
+                          lineHeadColor: [UIColor redColor]
+                           andLineWidth: 1];
+        plotView.samplingRateInHz = 1;
+        plotView.windowMaxSize = 5;
+    });
+
+    it(@"should keep only the newest data points", ^{
+        double values[] = {1, 2, 3, 4, 5, 6, 7};
+        [plotView addValues: values count: 3];
+        expect(plotView.numberOfDataPoints).to.equal(3);
+
+        [plotView addValues: values + 3 count: 4];
+        expect(plotView.numberOfDataPoints).to.equal(5);
+        expect([plotView valueAtIndex: 0]).to.equal(3);
+        expect([plotView valueAtIndex: 4]).to.equal(7);
+        expect(isnan([plotView valueAtIndex: 5])).to.beTruthy();
+    });
+
+    it(@"should keep the newest data points when the window shrinks", ^{
+        [plotView addDataPoints: @[@1, @2, @3, @4, @5]];
+        plotView.windowMaxSize = 2;
+        expect(plotView.numberOfDataPoints).to.equal(2);
+        expect([plotView valueAtIndex: 0]).to.equal(4);
+        expect([plotView valueAtIndex: 1]).to.equal(5);
+    });
+
+    it(@"should remove all data points", ^{
+        [plotView addDataPoint: @1];
+        [plotView removeAllDataPoints];
+        expect(plotView.numberOfDataPoints).to.equal(0);
+    });
+
+    it(@"should coalesce plot updates until the next display refresh", ^{
+        CountingPlotView *countingPlotView = [[CountingPlotView alloc] initWithFrame: CGRectMake(0, 0, 320, 200)];
+        countingPlotView.windowMaxSize = 100;
+        for (NSUInteger index = 0; index < 100; index++) {
+            [countingPlotView addDataPoint: @(index)];
+        }
+
+        // the plot is not on screen, so nothing is updated until it is asked for
+        expect(countingPlotView.numberOfPlotUpdates).to.equal(0);
+        [countingPlotView updatePlot];
+        expect(countingPlotView.numberOfPlotUpdates).to.equal(1);
+    });
+
+    it(@"should sort time-keyed data points that arrive out of order", ^{
+        [plotView addValue: 100 atTime: 10];
+        [plotView addValue: 120 atTime: 20];
+        [plotView addValue: 110 atTime: 15];
+        [plotView addValue: 115 atTime: 15];
+
+        expect(plotView.numberOfTimedDataPoints).to.equal(3);
+        expect([plotView timeOfTimedDataPointAtIndex: 1]).to.equal(15);
+        expect([plotView valueOfTimedDataPointAtIndex: 1]).to.equal(115);
+        expect([plotView timeOfTimedDataPointAtIndex: 2]).to.equal(20);
+    });
+
+    it(@"should keep only the newest time-keyed data points", ^{
+        double times[] = {7, 1, 2, 3, 4, 5, 6};
+        double values[] = {70, 10, 20, 30, 40, 50, 60};
+        [plotView addValues: values atTimes: times count: 7];
+
+        expect(plotView.numberOfTimedDataPoints).to.equal(5);
+        expect([plotView timeOfTimedDataPointAtIndex: 0]).to.equal(3);
+        expect([plotView valueOfTimedDataPointAtIndex: 4]).to.equal(70);
+
+        [plotView addValue: 0 atTime: 0];
+        expect([plotView timeOfTimedDataPointAtIndex: 0]).to.equal(3);
+    });
+
+    it(@"should find the time-keyed data points in a time range", ^{
+        for (NSUInteger time = 0; time < 5; time++) {
+            [plotView addValue: 100 atTime: time * 5];
+        }
+        NSRange range = [plotView rangeOfTimedDataPointsFromTime: 3 toTime: 15];
+        expect(range.location).to.equal(1);
+        expect(range.length).to.equal(3);
+
+        range = [plotView rangeOfTimedDataPointsFromTime: 21 toTime: 30];
+        expect(range.length).to.equal(0);
+    });
+
+    it(@"should keep overlay series in their own slices of the shared storage", ^{
+        NSUInteger sensorSeries = [plotView addSeriesWithColor: [UIColor greenColor] lineWidth: 1 style: UHNPlotSeriesStyleLine capacity: 3];
+        NSUInteger calibrationSeries = [plotView addSeriesWithColor: [UIColor orangeColor] lineWidth: 1 style: UHNPlotSeriesStylePoints capacity: 2];
+        expect(plotView.numberOfSeries).to.equal(2);
+
+        for (NSUInteger time = 0; time < 10; time++) {
+            [plotView addValue: 100 + time atTime: time toSeries: sensorSeries];
+        }
+        [plotView addValue: 95 atTime: 7 toSeries: calibrationSeries];
+        [plotView addValue: 90 atTime: 2 toSeries: calibrationSeries];
+
+        expect([plotView numberOfDataPointsInSeries: sensorSeries]).to.equal(3);
+        expect([plotView timeOfDataPointAtIndex: 0 inSeries: sensorSeries]).to.equal(7);
+        expect([plotView valueOfDataPointAtIndex: 2 inSeries: sensorSeries]).to.equal(109);
+        expect([plotView numberOfDataPointsInSeries: calibrationSeries]).to.equal(2);
+        expect([plotView timeOfDataPointAtIndex: 0 inSeries: calibrationSeries]).to.equal(2);
+        expect(isnan([plotView valueOfDataPointAtIndex: 0 inSeries: 2])).to.beTruthy();
+
+        // the series share the time axis, with the newest time of all series at the right edge
+        expect([plotView screenValueForTime: 9]).to.equal(plotView.bounds.size.width - 20);
+
+        [plotView removeAllDataPoints];
+        expect(plotView.numberOfSeries).to.equal(2);
+        expect([plotView numberOfDataPointsInSeries: sensorSeries]).to.equal(0);
+
+        [plotView removeAllSeries];
+        expect(plotView.numberOfSeries).to.equal(0);
+    });
+
+    it(@"should draw the main line alongside the overlay series", ^{
+        double values[] = {100, 200, 300, 200, 100};
+        [plotView addValues: values count: 5];
+        [plotView updatePlot];
+        NSUInteger numberOfLinePixels = ScrollingPlotViewTestsNumberOfDrawnPixels(plotView);
+        expect(numberOfLinePixels).to.beGreaterThan(0);
+
+        NSUInteger sensorSeries = [plotView addSeriesWithColor: [UIColor greenColor] lineWidth: 1 style: UHNPlotSeriesStyleLine capacity: 3];
+        expect(ScrollingPlotViewTestsNumberOfDrawnPixels(plotView)).to.equal(numberOfLinePixels);
+
+        [plotView addValue: 150 atTime: 0 toSeries: sensorSeries];
+        [plotView addValue: 250 atTime: 30 toSeries: sensorSeries];
+        expect(ScrollingPlotViewTestsNumberOfDrawnPixels(plotView)).to.beGreaterThan(numberOfLinePixels);
+    });
+
+    it(@"should keep caching the main line with overlay series", ^{
+        plotView.cachesRenderedHistory = YES;
+        plotView.windowMaxSize = 200;
+        [plotView addSeriesWithColor: [UIColor greenColor] lineWidth: 1 style: UHNPlotSeriesStyleLine capacity: 3];
+        double values[200];
+        for (NSUInteger index = 0; index < 200; index++) {
+            values[index] = index;
+        }
+        [plotView addValues: values count: 200];
+        [plotView updatePlot];
+
+        // 199 segments in tiles of 64
+        expect(ScrollingPlotViewTestsTileLayers(plotView).count).to.equal(4);
+    });
+
+    it(@"should draw a full window of data points", ^{
+        plotView.windowMaxSize = kFullWindowNumberOfDataPoints;
+        double *values = malloc(kFullWindowNumberOfDataPoints * sizeof(double));
+        for (NSUInteger index = 0; index < kFullWindowNumberOfDataPoints; index++) {
+            values[index] = 200. + 100. * sin(index / 50.);
+        }
+        [plotView addValues: values count: kFullWindowNumberOfDataPoints];
+        free(values);
+        [plotView updatePlot];
+        expect(plotView.numberOfDataPoints).to.equal(kFullWindowNumberOfDataPoints);
+
+        // each data point is drawn, as the window fits in the plot without decimation
+        CGPathRef path = [plotView newPathForDataPoints];
+        expect(ScrollingPlotViewTestsNumberOfPathElements(path)).to.equal(kFullWindowNumberOfDataPoints);
+        CGPathRelease(path);
+    });
+
+    it(@"should draw a decimated long history", ^{
+        // 90 days of 5 minute readings on an axis in minutes
+        NSUInteger numberOfDataPoints = 90 * 288;
+        plotView.xScale.max = @(90 * 24 * 60);
+        plotView.samplingRateInHz = 1. / 5.;
+        expect(plotView.windowMaxSize).to.equal(numberOfDataPoints);
+
+        double *values = malloc(numberOfDataPoints * sizeof(double));
+        for (NSUInteger index = 0; index < numberOfDataPoints; index++) {
+            values[index] = 150. + 100. * sin(index / 20.);
+        }
+        [plotView addValues: values count: numberOfDataPoints];
+        free(values);
+
+        [plotView updatePlot];
+        expect(plotView.numberOfDataPoints).to.equal(numberOfDataPoints);
+
+        // a minimum and a maximum per bucket, which covers at least half a pixel column, instead of a point per reading
+        CGPathRef path = [plotView newPathForDataPoints];
+        CGFloat pixelColumns = plotView.bounds.size.width * plotView.contentScaleFactor;
+        NSUInteger numberOfElements = ScrollingPlotViewTestsNumberOfPathElements(path);
+        expect(numberOfElements).to.beGreaterThan(0);
+        expect(numberOfElements).to.beLessThanOrEqualTo(4 * pixelColumns + 2);
+        expect(numberOfElements).to.beLessThan(numberOfDataPoints / 8);
+        CGPathRelease(path);
+    });
+
+    it(@"should only render the new data points when caching the history", ^{
+        plotView.cachesRenderedHistory = YES;
+        plotView.windowMaxSize = kFullWindowNumberOfDataPoints;
+        double *values = malloc(kFullWindowNumberOfDataPoints * sizeof(double));
+        for (NSUInteger index = 0; index < kFullWindowNumberOfDataPoints; index++) {
+            values[index] = 200. + 100. * sin(index / 50.);
+        }
+        [plotView addValues: values count: kFullWindowNumberOfDataPoints];
+        [plotView updatePlot];
+
+        // 9999 segments in tiles of 64
+        NSArray *tileLayers = ScrollingPlotViewTestsTileLayers(plotView);
+        expect(tileLayers.count).to.equal(157);
+
+        // the plot is not on screen, so its display link never fires and each update is asked for
+        for (NSUInteger frame = 0; frame < kNumberOfUpdates; frame++) {
+            NSArray *tilePaths = ScrollingPlotViewTestsTilePaths(tileLayers);
+            [plotView addValues: values + frame count: 1];
+            [plotView updatePlot];
+
+            // only the open newest tile is rebuilt
+            expect(ScrollingPlotViewTestsNumberOfRebuiltTiles(plotView, tileLayers, tilePaths)).to.equal(1);
+            expect([ScrollingPlotViewTestsTileLayers(plotView) lastObject]).to.beIdenticalTo([tileLayers lastObject]);
+        }
+
+        // filling the open tile and starting the next one drops the oldest tile, whose layer is reused for the new one
+        NSArray *tilePaths = ScrollingPlotViewTestsTilePaths(tileLayers);
+        [plotView addValues: values count: 64];
+        [plotView updatePlot];
+        expect(ScrollingPlotViewTestsTileLayers(plotView).count).to.equal(157);
+        expect(ScrollingPlotViewTestsNumberOfRebuiltTiles(plotView, tileLayers, tilePaths)).to.equal(2);
+        free(values);
+
+        expect(plotView.numberOfDataPoints).to.equal(kFullWindowNumberOfDataPoints);
+    });
+});
+
+SpecEnd
@@ -0,0 +1,76 @@
+//
+//  CGMPlotAdapter.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+@class UHNScrollingTimeSeriesPlotView;
+
+/**
+ Interval over which measurements are batched before they are pushed into the plot, in seconds
+ */
+#define kCGMPlotAdapterBatchInterval    (1. / 60.)
+
+/**
+ `CGMPlotAdapter` binds a plot view to the measurement stream of a `UHNCGMController`. Measurements are unboxed and batched on a private serial queue and pushed into the plot in bulk, so the main thread is only signalled to redraw. The plot is keyed by the measurement time offset, so backfilled records land where they belong.
+ 
+ The line head color follows the glucose level of the newest measurement and is only changed on the main thread when the level changes.
+ */
+@interface CGMPlotAdapter : NSObject
+
+/**
+ The plot view the measurements are pushed into
+ */
+@property(nonatomic,weak,readonly) UHNScrollingTimeSeriesPlotView *plotView;
+
+/**
+ Glucose levels (mg/dl) for the line head color. Below the hypo or above the hyper level the line head is red, below the patient low or above the patient high level it is yellow, otherwise it is blue
+ */
+@property(atomic,assign) float levelHypo;
+@property(atomic,assign) float levelHyper;
+@property(atomic,assign) float levelPatientLow;
+@property(atomic,assign) float levelPatientHigh;
+
+/**
+ Create an adapter for a plot view
+ 
+ @param plotView The plot view
+ 
+ @return The adapter
+ */
+- (instancetype)initWithPlotView:(UHNScrollingTimeSeriesPlotView*)plotView;
+
+/**
+ Add a measurement to the plot. Can be called from any thread, typically from `cgmController:measurementDetails:`
+ 
+ @param measurementDetails The measurement details dictionary reported by the `UHNCGMController`
+ */
+- (void)addMeasurementDetails:(NSDictionary*)measurementDetails;
+
+/**
+ Drop the measurements that have not been pushed into the plot yet and forget the newest measurement, e.g. when a new session is started
+ */
+- (void)reset;
+
+@end
@@ -0,0 +1,134 @@
+//
+//  CGMPlotAdapter.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 10/19/2026.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "CGMPlotAdapter.h"
+#import "UHNScrollingTimeSeriesPlotView.h"
+#import "NSDictionary+CGMExtensions.h"
+
+typedef NS_ENUM(NSInteger, CGMPlotAdapterLevel) {
+    CGMPlotAdapterLevelUnknown = -1,
+    CGMPlotAdapterLevelInRange,
+    CGMPlotAdapterLevelOutOfPatientRange,
+    CGMPlotAdapterLevelOutOfRange,
+};
+
+@interface CGMPlotAdapter ()
+{
+    // batch of measurements, only accessed on the queue
+    double *_times;
+    double *_values;
+    NSUInteger _count;
+    NSUInteger _capacity;
+}
+@property(nonatomic,weak,readwrite) UHNScrollingTimeSeriesPlotView *plotView;
+@property(nonatomic,strong) dispatch_queue_t queue;
+@property(nonatomic,assign) BOOL isFlushScheduled;
+@property(nonatomic,assign) double newestTimeOffset;
+@property(nonatomic,assign) CGMPlotAdapterLevel lineHeadLevel;
+@end
+
+@implementation CGMPlotAdapter
+
+#pragma mark - Initialization
+
+- (instancetype)initWithPlotView:(UHNScrollingTimeSeriesPlotView*)plotView;
+{
+    if ((self = [super init])) {
+        _plotView = plotView;
+        _queue = dispatch_queue_create("org.uhn.cgm.plotadapter", DISPATCH_QUEUE_SERIAL);
+        _newestTimeOffset = -INFINITY;
+        _lineHeadLevel = CGMPlotAdapterLevelUnknown;
+    }
+    return self;
+}
+
+- (void)dealloc;
+{
+    free(_times);
+    free(_values);
+}
+
+#pragma mark - Measurements
+
+- (void)addMeasurementDetails:(NSDictionary*)measurementDetails;
+{
+    dispatch_async(self.queue, ^{
+        NSNumber *glucoseValue = [measurementDetails glucoseValue];
+        NSNumber *timeOffset = [measurementDetails measurementTimeOffset];
+        if (!glucoseValue || !timeOffset) {
+            return;
+        }
+        
+        if (_count == _capacity) {
+            _capacity = MAX(2 * _capacity, 64);
+            _times = realloc(_times, _capacity * sizeof(double));
+            _values = realloc(_values, _capacity * sizeof(double));
+        }
+        _times[_count] = [timeOffset doubleValue];
+        _values[_count] = [glucoseValue doubleValue];
+        _count++;
+        
+        if (_times[_count - 1] >= self.newestTimeOffset) {
+            self.newestTimeOffset = _times[_count - 1];
+            [self updateLineHeadLevelForGlucoseValue:_values[_count - 1]];
+        }
+        
+        // measurements arriving together (e.g. stored records) are pushed as one batch
+        if (!self.isFlushScheduled) {
+            self.isFlushScheduled = YES;
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kCGMPlotAdapterBatchInterval * NSEC_PER_SEC)), self.queue, ^{
+                [self flush];
+            });
+        }
+    });
+}
+
+- (void)reset;
+{
+    dispatch_async(self.queue, ^{
+        _count = 0;
+        self.newestTimeOffset = -INFINITY;
+        self.lineHeadLevel = CGMPlotAdapterLevelUnknown;
+    });
+}
+
+#pragma mark - Private Methods
+
+- (void)flush;
+{
+    self.isFlushScheduled = NO;
+    [self.plotView enqueueValues:_values atTimes:_times count:_count];
+    _count = 0;
+}
+
+- (void)updateLineHeadLevelForGlucoseValue:(double)glucoseValue;
+{
+    CGMPlotAdapterLevel level = CGMPlotAdapterLevelInRange;
+    if (glucoseValue < self.levelHypo || glucoseValue > self.levelHyper) {
+        level = CGMPlotAdapterLevelOutOfRange;
+    } else if (glucoseValue < self.levelPatientLow || glucoseValue > self.levelPatientHigh) {
+        level = CGMPlotAdapterLevelOutOfPatientRange;
+    }
+    if (level == self.lineHeadLevel) {
+        return;
+    }
+    self.lineHeadLevel = level;
+    
+    UIColor *lineHeadColor = [UIColor blueColor];
+    if (level == CGMPlotAdapterLevelOutOfRange) {
+        lineHeadColor = [UIColor redColor];
+    } else if (level == CGMPlotAdapterLevelOutOfPatientRange) {
+        lineHeadColor = [UIColor yellowColor];
+    }
+    UHNScrollingTimeSeriesPlotView *plotView = self.plotView;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        plotView.lineHeadColor = lineHeadColor;
+    });
+}
+
+@end
@@ -9,6 +9,9 @@
 #import "ViewController.h"
 #import "UHNCGMController.h"
 #import "UHNScrollingTimeSeriesPlotView.h"
+#import "CGMPlotAdapter.h"
+#import "UHNThresholdBandDecoration.h"
+#import "UHNEventMarkerDecoration.h"
 #import "NHArrowView.h"
 #import "UHNDebug.h"
 #import "NSDictionary+CGMExtensions.h"
@@ -38,6 +41,11 @@
 @property(nonatomic,strong) IBOutlet UITextField *hypoThresholdTextField;
 @property(nonatomic,strong) IBOutlet UIActivityIndicatorView *messagingActivity;
 @property(nonatomic,strong) IBOutlet UHNScrollingTimeSeriesPlotView *plotView;
+@property(nonatomic,strong) CGMPlotAdapter *plotAdapter;
+@property(nonatomic,strong) UHNThresholdBandDecoration *outOfRangeBands;
+@property(nonatomic,strong) UHNThresholdBandDecoration *outOfPatientRangeBands;
+@property(nonatomic,strong) UHNEventMarkerDecoration *eventMarkers;
+@property(nonatomic,assign) NSUInteger calibrationSeries;
 @property(nonatomic,strong) IBOutlet NHArrowView *trendArrow;
 @property(nonatomic,assign) float tempPatientLowLevel;
 @property(nonatomic,assign) float tempPatientHighLevel;
@@ -47,6 +55,7 @@
 @property(nonatomic,assign) float tempRateIncreaseLevel;
 @property(nonatomic,assign) BOOL shouldStartNewSession;
 @property(nonatomic,assign) BOOL isHistoricalData;
+@property(nonatomic,assign) NSInteger newestTimeOffset;
 - (IBAction)connectButtonPressed:(id)sender;
 - (IBAction)startSessionButtonPressed:(id)sender;
 - (IBAction)dismissButtonPressed:(id)sender;
@@ -64,6 +73,7 @@
     self.runTimeLabel.text = kTimeLabelDefaultString;
     
     self.cgmController = [[UHNCGMController alloc] initWithDelegate: self];
+    self.newestTimeOffset = -1;
     self.dateFormatter = [[NSDateFormatter alloc] init];
     self.dateFormatter.dateStyle = NSDateFormatterShortStyle;
     self.dateFormatter.timeStyle = NSDateFormatterShortStyle;
@@ -91,6 +101,7 @@
     self.plotView.plotRefreshRateInHz = 1;
     self.plotView.samplingRateInHz = 1;
     self.plotView.windowMaxSize = 60;
+    self.plotView.maximumTimeGap = 5.;
     self.plotView.backgroundColor = [UIColor clearColor];
     
     // setup the temp ranges
@@ -101,6 +112,31 @@
     self.tempRateDecreaseLevel = -2.;
     self.tempRateIncreaseLevel = 2.;
     
+    // the plot is fed from the measurement stream off the main thread
+    self.plotAdapter = [[CGMPlotAdapter alloc] initWithPlotView: self.plotView];
+    self.plotAdapter.levelHypo = self.tempHypoValue;
+    self.plotAdapter.levelHyper = self.tempHyperValue;
+    self.plotAdapter.levelPatientLow = self.tempPatientLowLevel;
+    self.plotAdapter.levelPatientHigh = self.tempPatientHighLevel;
+    
+    // shade the ranges outside the alert levels and mark calibrations and sensor status events
+    self.outOfRangeBands = [[UHNThresholdBandDecoration alloc] initWithFrame: self.plotView.bounds];
+    self.outOfRangeBands.bandColor = [[UIColor redColor] colorWithAlphaComponent: 0.2];
+    [self.plotView addDecoration: self.outOfRangeBands];
+    self.outOfPatientRangeBands = [[UHNThresholdBandDecoration alloc] initWithFrame: self.plotView.bounds];
+    self.outOfPatientRangeBands.bandColor = [[UIColor yellowColor] colorWithAlphaComponent: 0.2];
+    [self.plotView addDecoration: self.outOfPatientRangeBands];
+    [self updateThresholdBands];
+    self.eventMarkers = [[UHNEventMarkerDecoration alloc] initWithFrame: self.plotView.bounds];
+    self.eventMarkers.markerColor = [UIColor grayColor];
+    [self.plotView addDecoration: self.eventMarkers];
+    
+    // overlay the fingerstick calibration values on the glucose trace
+    self.calibrationSeries = [self.plotView addSeriesWithColor: [UIColor orangeColor]
+                                                     lineWidth: 1.
+                                                         style: UHNPlotSeriesStylePoints
+                                                      capacity: 32];
+    
     // setup the trend arrow
     self.trendArrow.strokeColor = [UIColor clearColor];
     self.trendArrow.fillColor = [UIColor blueColor];
@@ -130,61 +166,79 @@
         float glucoseValueFloat = [glucoseValue floatValue];
         if (glucoseValueFloat < self.tempHypoValue || glucoseValueFloat > self.tempHyperValue) {
             self.glucoseValueLabel.textColor = [UIColor redColor];
-            self.plotView.lineHeadColor = [UIColor redColor];
         } else if (glucoseValueFloat < self.tempPatientLowLevel || glucoseValueFloat > self.tempPatientHighLevel) {
             self.glucoseValueLabel.textColor = [UIColor yellowColor];
-            self.plotView.lineHeadColor = [UIColor yellowColor];
         } else {
             self.glucoseValueLabel.textColor = [UIColor blueColor];
-            self.plotView.lineHeadColor = [UIColor blueColor];
         }
     } else {
         self.glucoseValueLabel.text = kGlucoseLabelDefaultString;
     }
 }
 
-- (void)updateTrendArrow: (NSNumber*)trendValue;
+- (void)updateThresholdBands;
+{
+    [self.outOfRangeBands removeAllBands];
+    [self.outOfRangeBands addBandFromValue: [self.plotView.yScale.min doubleValue] toValue: self.tempHypoValue];
+    [self.outOfRangeBands addBandFromValue: self.tempHyperValue toValue: [self.plotView.yScale.max doubleValue]];
+    [self.outOfRangeBands layoutInGraph: self.plotView];
+    
+    [self.outOfPatientRangeBands removeAllBands];
+    [self.outOfPatientRangeBands addBandFromValue: self.tempHypoValue toValue: self.tempPatientLowLevel];
+    [self.outOfPatientRangeBands addBandFromValue: self.tempPatientHighLevel toValue: self.tempHyperValue];
+    [self.outOfPatientRangeBands layoutInGraph: self.plotView];
+    
+    self.plotAdapter.levelHypo = self.tempHypoValue;
+    self.plotAdapter.levelHyper = self.tempHyperValue;
+    self.plotAdapter.levelPatientLow = self.tempPatientLowLevel;
+    self.plotAdapter.levelPatientHigh = self.tempPatientHighLevel;
+}
+
+- (void)updateTrendArrow: (CGMTrendArrowOption)trendArrow;
 {
     // trend arrow can be drawn at any degree, but only the following degrees are used
     //
-    // -90 = x >= severWarningValue
-    // -60 = moderateWarningValue <= x <= severWarningValue
-    // -30 = mildWarningValue <= x <= moderateWarningValue
-    // 0 = -1 * mildWarningValue < x < mildWarningValue
-    // 30 = -1 * moderateWarningValue < x <= -1 * mildWarningValue
-    // 60 = -1 * severWarningValue < x <= -1 * moderateWarningValue
-    // 90 = x <= -1 * severWarningValue
+    // -90 = rising rapidly
+    // -60 = rising
+    // -30 = rising slightly
+    // 0 = flat
+    // 30 = falling slightly
+    // 60 = falling
+    // 90 = falling rapidly
     //
-    float mildWarningValue = 2.;
-    float moderateWarningValue = 15.;
-    float severWarningValue = 25.;
-    
-    if (trendValue) {
+    if (trendArrow != CGMTrendArrowUnknown) {
         self.trendWarningLabel.hidden = YES;
         self.trendArrow.hidden = NO;
-        float value = [trendValue floatValue];
         CGFloat degrees = 0.;
-        if (value >= severWarningValue) {
-            degrees = -90;
-            self.trendArrow.fillColor = [UIColor redColor];
-        } else if (value >= moderateWarningValue && value < severWarningValue) {
-            degrees = -60;
-            self.trendArrow.fillColor = [UIColor yellowColor];
-        } else if (value >= mildWarningValue && value < moderateWarningValue) {
-            degrees = -30.;
-            self.trendArrow.fillColor = [UIColor blueColor];
-        } else if (value > -1 * mildWarningValue && value < mildWarningValue) {
-            degrees = 0.;
-            self.trendArrow.fillColor = [UIColor blueColor];
-        } else if (value <= -1 * mildWarningValue && value > -1 * moderateWarningValue) {
-            degrees = 30.;
-            self.trendArrow.fillColor = [UIColor blueColor];
-        } else if (value <= -1 * moderateWarningValue && value > -1 * severWarningValue) {
-            degrees = 60.;
-            self.trendArrow.fillColor = [UIColor yellowColor];
-        } else if (value <= -1 * severWarningValue) {
-            degrees = 90.;
-            self.trendArrow.fillColor = [UIColor redColor];
+        switch (trendArrow) {
+            case CGMTrendArrowRisingRapidly:
+                degrees = -90;
+                self.trendArrow.fillColor = [UIColor redColor];
+                break;
+            case CGMTrendArrowRising:
+                degrees = -60;
+                self.trendArrow.fillColor = [UIColor yellowColor];
+                break;
+            case CGMTrendArrowRisingSlightly:
+                degrees = -30.;
+                self.trendArrow.fillColor = [UIColor blueColor];
+                break;
+            case CGMTrendArrowFallingSlightly:
+                degrees = 30.;
+                self.trendArrow.fillColor = [UIColor blueColor];
+                break;
+            case CGMTrendArrowFalling:
+                degrees = 60.;
+                self.trendArrow.fillColor = [UIColor yellowColor];
+                break;
+            case CGMTrendArrowFallingRapidly:
+                degrees = 90.;
+                self.trendArrow.fillColor = [UIColor redColor];
+                break;
+            default:
+                degrees = 0.;
+                self.trendArrow.fillColor = [UIColor blueColor];
+                break;
         }
         [self.trendArrow animatedRotateToDegree: degrees];
     } else {
@@ -226,6 +280,9 @@
 {
     [self.cgmController stopSession];
     self.shouldStartNewSession = YES;
+    self.newestTimeOffset = -1;
+    [self.plotAdapter reset];
+    [self.eventMarkers removeAllMarkers];
     [self.plotView removeAllDataPoints];
 }
 
@@ -236,11 +293,8 @@
 
 - (IBAction)setHypoButtonPressed:(id)sender;
 {
-    shortFloat hypoValue;
-    hypoValue.exponent = 0;
-    hypoValue.mantissa = [self.hypoThresholdTextField.text integerValue];
     //TODO handle nil values
-    [self.cgmController setHyperLevel: hypoValue];
+    [self.cgmController setHypoLevelValue: [self.hypoThresholdTextField.text floatValue]];
 }
 
 #pragma mark - CGM Profile Delegate Methods
@@ -288,20 +342,27 @@
 - (void) cgmController: (UHNCGMController*)controller measurementDetails: (NSDictionary*)measurementDetails;
 {
     NSNumber *glucoseValue = [measurementDetails glucoseValue];
-    NSNumber *trendValue = [measurementDetails trendValue];
     
-    if (!self.isHistoricalData) {
+    // stored records, e.g. of a gap reconciled by the controller, are older than the newest measurement
+    NSInteger timeOffset = [[measurementDetails measurementTimeOffset] integerValue];
+    BOOL isNewestMeasurement = timeOffset > self.newestTimeOffset;
+    self.newestTimeOffset = MAX(self.newestTimeOffset, timeOffset);
+    
+    if (!self.isHistoricalData && isNewestMeasurement) {
         // display the current value
         [self updateGlucoseValueDisplay: glucoseValue];
         
         // update the current trend arrow
-        [self updateTrendArrow: trendValue];
+        [self updateTrendArrow: [measurementDetails trendArrow]];
     }
     
-    // update the plot
-    [self.plotView addDataPoint: glucoseValue];
+    // update the plot, placing backfilled records by their time offset
+    [self.plotAdapter addMeasurementDetails: measurementDetails];
+    if ([measurementDetails hasSessionStopped] || [measurementDetails didSensorMalfunction] || [measurementDetails isCalibrationRequired]) {
+        [self.eventMarkers addMarkerAtTime: [[measurementDetails measurementTimeOffset] doubleValue]];
+    }
     
-    if ([measurementDetails hasExceededLevelHypo]) {
+    if (!self.isHistoricalData && isNewestMeasurement && [measurementDetails hasExceededLevelHypo]) {
         UIAlertView *alert = [[UIAlertView alloc] initWithTitle: @"CGM Alert"
                                                         message: @"Hypo level exceeded"
                                                        delegate: nil
@@ -331,9 +392,42 @@
         [self.cgmController sendCurrentTime];
     } else if (opCode == CGMCPOpCodeAlertLevelHypoSet) {
         self.tempHypoValue = [self.hypoThresholdTextField.text floatValue];
+        [self updateThresholdBands];
     }
 }
 
+- (void) cgmController: (UHNCGMController*)controller didGetAlertLevelHypo: (NSNumber*)hypoLevel;
+{
+    self.tempHypoValue = [hypoLevel floatValue];
+    [self updateThresholdBands];
+}
+
+- (void) cgmController: (UHNCGMController*)controller didGetAlertLevelHyper: (NSNumber*)hyperLevel;
+{
+    self.tempHyperValue = [hyperLevel floatValue];
+    [self updateThresholdBands];
+}
+
+- (void) cgmController: (UHNCGMController*)controller didGetPatientAlertLevelLow: (NSNumber*)lowLevel;
+{
+    self.tempPatientLowLevel = [lowLevel floatValue];
+    [self updateThresholdBands];
+}
+
+- (void) cgmController: (UHNCGMController*)controller didGetPatientAlertLevelHigh: (NSNumber*)highLevel;
+{
+    self.tempPatientHighLevel = [highLevel floatValue];
+    [self updateThresholdBands];
+}
+
+- (void) cgmController: (UHNCGMController*)controller didGetCalibrationDetails: (NSDictionary*)calibrationDetails;
+{
+    [self.eventMarkers addMarkerAtTime: [calibrationDetails[kCGMKeyTimeOffset] doubleValue]];
+    [self.plotView addValue: [calibrationDetails[kCGMCalibrationKeyValue] doubleValue]
+                     atTime: [calibrationDetails[kCGMKeyTimeOffset] doubleValue]
+                   toSeries: self.calibrationSeries];
+}
+
 - (void) cgmController: (UHNCGMController*)controller RACPOperation: (RACPOpCode)opCode failed: (RACPResponseCode)responseCode;
 {
     if (opCode == RACPOpCodeStoredRecordsReport) {
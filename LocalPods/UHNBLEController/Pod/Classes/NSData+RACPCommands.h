@@ -26,8 +26,41 @@
 #import <Foundation/Foundation.h>
 #import "UHNRACPConstants.h"
 
+///-----------------------
+/// @name Command Encoding
+///-----------------------
+/**
+ A record access control point command encoded in a fixed-size buffer, which is usually on the stack. The operands are written in little endian byte order.
+ */
+typedef struct RACPCommandBuffer {
+    uint8_t bytes[kRACPCommandMaxLength];
+    NSUInteger length;
+} RACPCommandBuffer;
+
+/**
+ Encode a command with a single time offset operand, patching the operand into a copy of the command template
+ 
+ @param command The buffer to encode into
+ @param opCode The op code of the command
+ @param operatorValue The operator, either `RACPOperatorLessThanEqualTo` or `RACPOperatorGreaterThanEqualTo`
+ @param timeOffset The time offset operand
+ */
+void RACPCommandEncodeTimeOffset(RACPCommandBuffer *command, RACPOpCode opCode, RACPOperator operatorValue, uint16_t timeOffset);
+
+/**
+ Encode a command with a range of time offsets, patching the operands into a copy of the command template
+ 
+ @param command The buffer to encode into
+ @param opCode The op code of the command
+ @param minTimeOffset The first time offset of the range
+ @param maxTimeOffset The last time offset of the range
+ */
+void RACPCommandEncodeTimeOffsetRange(RACPCommandBuffer *command, RACPOpCode opCode, uint16_t minTimeOffset, uint16_t maxTimeOffset);
+
 /**
  `NSData+RACPCommands` constructs record access control point commands and returns a cooresponding `NSData` object
+ 
+ Commands without an operand are immutable, so they are encoded once and the same `NSData` object is returned for every call. Commands with operands are encoded on the stack and copied once into the returned `NSData` object
  */
 @interface NSData (RACPCommands)
 
@@ -61,14 +94,14 @@
 + (NSData*)reportStoredRecordsGreaterThanOrEqualToTimeOffset: (uint16_t)timeOffset;
 
 /**
- Command for reporting stored records between a max and min time offset
+ Command for reporting stored records between a min and max time offset
  
- @param maxTimeOffset The max time offset to report records less than or equal to.
  @param minTimeOffset The min time offset to report records greater than or equal to.
+ @param maxTimeOffset The max time offset to report records less than or equal to.
  
  @return The command as a `NSData` object
  */
-+ (NSData*)reportStoredRecordsBetween: (uint16_t)maxTimeOffset and: (uint16_t)minTimeOffset;
++ (NSData*)reportStoredRecordsBetween: (uint16_t)minTimeOffset and: (uint16_t)maxTimeOffset;
 
 /**
  Command for reporting the first stored record
@@ -203,4 +236,14 @@
  */
 + (NSData*)abortOperation;
 
+/**
+ Copies an encoded command
+ 
+ @param command The encoded command
+ 
+ @return The command as a `NSData` object
+ 
+ */
++ (NSData*)dataWithRACPCommand: (const RACPCommandBuffer*)command;
+
 @end
@@ -8,6 +8,36 @@
 
 #import "NSData+RACPCommands.h"
 
+// templates for the commands with operands
+static const uint8_t kRACPTimeOffsetTemplate[] = {0, 0, RACPFilterTypeTimeOffset, 0, 0};
+static const uint8_t kRACPTimeOffsetRangeTemplate[] = {0, RACPOperatorWithinRange, RACPFilterTypeTimeOffset, 0, 0, 0, 0};
+
+// commands without an operand, indexed by op code and operator
+#define kRACPOpCodeCount        (RACPOpCodeResponse + 1)
+#define kRACPOperatorCount      (RACPOperatorRecordLast + 1)
+static NSData *fixedCommands[kRACPOpCodeCount][kRACPOperatorCount];
+
+void RACPCommandEncodeTimeOffset(RACPCommandBuffer *command, RACPOpCode opCode, RACPOperator operatorValue, uint16_t timeOffset)
+{
+    memcpy(command->bytes, kRACPTimeOffsetTemplate, sizeof(kRACPTimeOffsetTemplate));
+    command->bytes[0] = opCode;
+    command->bytes[1] = operatorValue;
+    command->bytes[3] = timeOffset & 0xFF;
+    command->bytes[4] = timeOffset >> 8;
+    command->length = sizeof(kRACPTimeOffsetTemplate);
+}
+
+void RACPCommandEncodeTimeOffsetRange(RACPCommandBuffer *command, RACPOpCode opCode, uint16_t minTimeOffset, uint16_t maxTimeOffset)
+{
+    memcpy(command->bytes, kRACPTimeOffsetRangeTemplate, sizeof(kRACPTimeOffsetRangeTemplate));
+    command->bytes[0] = opCode;
+    command->bytes[3] = minTimeOffset & 0xFF;
+    command->bytes[4] = minTimeOffset >> 8;
+    command->bytes[5] = maxTimeOffset & 0xFF;
+    command->bytes[6] = maxTimeOffset >> 8;
+    command->length = sizeof(kRACPTimeOffsetRangeTemplate);
+}
+
 @implementation NSData (RACPCommands)
 
 #pragma mark - Report records methods
@@ -110,39 +140,67 @@
 
 + (NSData*)abortOperation;
 {
-    return [NSData dataWithBytes:(char[]){RACPOpCodeAbortOperation, RACPOperatorNull} length: 2];
+    return [self fixedCommandWithOpCode: RACPOpCodeAbortOperation operator: RACPOperatorNull];
+}
+
++ (NSData*)dataWithRACPCommand:(const RACPCommandBuffer*)command;
+{
+    return [NSData dataWithBytes: command->bytes length: command->length];
 }
 
 #pragma mark - Private methods
 
++ (NSData*)fixedCommandWithOpCode:(RACPOpCode)opCode operator:(RACPOperator)operatorValue;
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (uint8_t code = 0; code < kRACPOpCodeCount; code++) {
+            for (uint8_t operand = 0; operand < kRACPOperatorCount; operand++) {
+                uint8_t bytes[] = {code, operand};
+                fixedCommands[code][operand] = [NSData dataWithBytes: bytes length: sizeof(bytes)];
+            }
+        }
+    });
+    return fixedCommands[opCode][operatorValue];
+}
+
 + (NSData*)allStoredRecordsWithOpCode:(RACPOpCode)opCode;
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorRecordsAll} length: 2];
+    return [self fixedCommandWithOpCode: opCode operator: RACPOperatorRecordsAll];
 }
 
 + (NSData*)storedRecordsLessThanEqualTo:(uint16_t)operand opCode:(RACPOpCode)opCode filter:(RACPFilterType)filter;
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorLessThanEqualTo, filter, operand, (operand >> 8)} length: 5];
+    RACPCommandBuffer command;
+    RACPCommandEncodeTimeOffset(&command, opCode, RACPOperatorLessThanEqualTo, operand);
+    command.bytes[2] = filter;
+    return [self dataWithRACPCommand: &command];
 }
 
 + (NSData*)storedRecordsGreaterThanEqualTo:(uint16_t)operand opCode:(RACPOpCode)opCode filter:(RACPFilterType)filter;
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorGreaterThanEqualTo, filter, operand, (operand >> 8)} length: 5];
+    RACPCommandBuffer command;
+    RACPCommandEncodeTimeOffset(&command, opCode, RACPOperatorGreaterThanEqualTo, operand);
+    command.bytes[2] = filter;
+    return [self dataWithRACPCommand: &command];
 }
 
 + (NSData*)storedRecordsBetween:(uint16_t)minOperand and:(uint16_t)maxOperand opCode:(RACPOpCode)opCode filter:(RACPFilterType)filter
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorWithinRange, filter, minOperand, (minOperand >> 8), maxOperand, (maxOperand >> 8)} length: 7];
+    RACPCommandBuffer command;
+    RACPCommandEncodeTimeOffsetRange(&command, opCode, minOperand, maxOperand);
+    command.bytes[2] = filter;
+    return [self dataWithRACPCommand: &command];
 }
 
 + (NSData*)firstStoredRecordWithOpCode:(RACPOpCode)opCode;
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorRecordFirst} length: 2];
+    return [self fixedCommandWithOpCode: opCode operator: RACPOperatorRecordFirst];
 }
 
 + (NSData*)lastStoredRecordWithOpCode:(RACPOpCode)opCode;
 {
-    return [NSData dataWithBytes: (char[]){opCode, RACPOperatorRecordLast} length: 2];
+    return [self fixedCommandWithOpCode: opCode operator: RACPOperatorRecordLast];
 }
 
 @end
@@ -35,6 +35,11 @@
 #define kRACPResponseFieldRangeRequestOpCode    (NSRange){2,1}
 #define kRACPResponseFieldRangeResponseValue    (NSRange){3,1}
 
+/**
+ Record access control point command sizes. The longest command is an op code, operator and filter type followed by a range of two 16 bit operands
+ */
+#define kRACPCommandMaxLength                   7
+
 ///----------------
 /// @name RACP Keys
 ///----------------
@@ -0,0 +1,108 @@
+//
+//  UHNChartSeries.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+/**
+ How a chart series is drawn
+ */
+typedef NS_ENUM(NSUInteger, UHNChartSeriesStyle) {
+    /** A line through the values */
+    UHNChartSeriesStyleLine,
+    /** A filled band between the low and high values, such as a percentile range of a rollup */
+    UHNChartSeriesStyleBand
+};
+
+/**
+ `UHNChartSeries` is a time-keyed series of values drawn by `UHNTimeSeriesChartRenderer`. The values are copied when the series is created, so a series can be rendered on any thread while its source keeps changing.
+ 
+ The times of the data points must be in ascending order, in the units of the x axis of the chart.
+ */
+@interface UHNChartSeries : NSObject
+
+/**
+ How the series is drawn
+ */
+@property (nonatomic, readonly) UHNChartSeriesStyle style;
+
+/**
+ The number of data points
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ The times of the data points
+ */
+@property (nonatomic, readonly) const double *times;
+
+/**
+ The values of a line, or the low values of a band
+ */
+@property (nonatomic, readonly) const double *values;
+
+/**
+ The high values of a band, or NULL for a line
+ */
+@property (nonatomic, readonly) const double *highValues;
+
+/**
+ The color of the line or band. Defaults to black.
+ */
+@property (nonatomic, strong) UIColor *color;
+
+/**
+ The width of the line. Defaults to 1.
+ */
+@property (nonatomic, assign) CGFloat lineWidth;
+
+/**
+ The largest time between consecutive data points that are joined, as the `maximumTimeGap` of `UHNScrollingTimeSeriesPlotView`. Defaults to 0, which always joins them.
+ */
+@property (nonatomic, assign) double maximumTimeGap;
+
+/**
+ Create a line series
+ 
+ @param values The values of the data points
+ @param times The times of the data points, in ascending order
+ @param count The number of data points
+ 
+ @return The series
+ */
++ (instancetype)lineWithValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count;
+
+/**
+ Create a band series
+ 
+ @param lowValues The low values of the data points
+ @param highValues The high values of the data points
+ @param times The times of the data points, in ascending order
+ @param count The number of data points
+ 
+ @return The series
+ */
++ (instancetype)bandWithLowValues: (const double*)lowValues highValues: (const double*)highValues atTimes: (const double*)times count: (NSUInteger)count;
+
+@end
@@ -0,0 +1,80 @@
+//
+//  UHNChartSeries.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNChartSeries.h"
+
+@interface UHNChartSeries ()
+{
+    double *_times;
+    double *_values;
+    double *_highValues;
+}
+@property (nonatomic, readwrite) UHNChartSeriesStyle style;
+@property (nonatomic, readwrite) NSUInteger count;
+@end
+
+@implementation UHNChartSeries
+
+#pragma mark - Lifecycle Methods
+
++ (instancetype)lineWithValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count
+{
+    return [[self alloc] initWithStyle: UHNChartSeriesStyleLine values: values highValues: NULL times: times count: count];
+}
+
++ (instancetype)bandWithLowValues: (const double*)lowValues highValues: (const double*)highValues atTimes: (const double*)times count: (NSUInteger)count
+{
+    return [[self alloc] initWithStyle: UHNChartSeriesStyleBand values: lowValues highValues: highValues times: times count: count];
+}
+
+- (instancetype)initWithStyle: (UHNChartSeriesStyle)style values: (const double*)values highValues: (const double*)highValues times: (const double*)times count: (NSUInteger)count
+{
+    if (self = [super init])
+    {
+        self.style = style;
+        self.count = count;
+        self.color = [UIColor blackColor];
+        self.lineWidth = 1;
+        _times = malloc(MAX(count, 1) * sizeof(double));
+        _values = malloc(MAX(count, 1) * sizeof(double));
+        memcpy(_times, times, count * sizeof(double));
+        memcpy(_values, values, count * sizeof(double));
+        if (highValues)
+        {
+            _highValues = malloc(MAX(count, 1) * sizeof(double));
+            memcpy(_highValues, highValues, count * sizeof(double));
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_times);
+    free(_values);
+    free(_highValues);
+}
+
+#pragma mark - Data Point Methods
+
+- (const double*)times
+{
+    return _times;
+}
+
+- (const double*)values
+{
+    return _values;
+}
+
+- (const double*)highValues
+{
+    return _highValues;
+}
+
+@end
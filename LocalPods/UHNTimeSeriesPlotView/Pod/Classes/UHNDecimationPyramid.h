@@ -0,0 +1,108 @@
+//
+//  UHNDecimationPyramid.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+/**
+ The maximum number of decimation levels. The coarsest level holds buckets of 2^16 data points.
+ */
+#define kUHNDecimationPyramidMaxLevels  16
+
+/**
+ The minimum and maximum value of a bucket of data points
+ */
+typedef struct UHNMinMax {
+    double minimum;
+    double maximum;
+} UHNMinMax;
+
+/**
+ `UHNDecimationPyramid` keeps the minimum and maximum value of buckets of consecutive data points at several levels of detail, so a plot can draw a long history with one vertical segment per pixel column instead of one segment per data point.
+ 
+ Level 0 is the raw data, which is not stored by the pyramid. Level `n` holds buckets of 2^n data points, where bucket `b` covers the data points with index `b << n` to `((b + 1) << n) - 1`. Data points are indexed from the first data point appended, so the buckets stay aligned while the oldest data points are dropped.
+ 
+ Each level is a ring buffer holding enough buckets for the capacity, so appending is allocation-free and costs one update per level.
+ */
+@interface UHNDecimationPyramid : NSObject
+
+/**
+ The number of most recent data points covered by the pyramid
+ */
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/**
+ The number of levels above the raw data
+ */
+@property (nonatomic, readonly) NSUInteger numberOfLevels;
+
+/**
+ The index the next appended data point will have, which is the number of data points appended since the pyramid was reset
+ */
+@property (nonatomic, readonly) NSUInteger numberOfValues;
+
+/**
+ Create a pyramid
+ 
+ @param capacity The number of most recent data points covered by the pyramid
+ 
+ @return The pyramid
+ */
+- (instancetype)initWithCapacity: (NSUInteger)capacity;
+
+/**
+ Append data points, ordered from oldest to newest
+ 
+ @param values The values of the data points
+ @param count The number of values
+ */
+- (void)appendValues: (const double*)values count: (NSUInteger)count;
+
+/**
+ Remove all data points
+ 
+ @param index The index of the next appended data point
+ */
+- (void)resetWithStartIndex: (NSUInteger)index;
+
+/**
+ The coarsest level whose buckets do not hold more data points than would be drawn in one pixel column
+ 
+ @param dataPointsPerPixel The number of data points drawn in one pixel column
+ 
+ @return The level, or 0 if the raw data should be drawn
+ */
+- (NSUInteger)levelForDataPointsPerPixel: (double)dataPointsPerPixel;
+
+/**
+ The minimum and maximum value of a bucket. Only the buckets of the `capacity` most recent data points are available, and the newest bucket only covers the data points appended so far.
+ 
+ @param bucket The index of the bucket
+ @param level The level of the bucket, from 1 to `numberOfLevels`
+ 
+ @return The minimum and maximum value of the bucket
+ */
+- (UHNMinMax)minMaxOfBucket: (NSUInteger)bucket atLevel: (NSUInteger)level;
+
+@end
@@ -0,0 +1,124 @@
+//
+//  UHNDecimationPyramid.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNDecimationPyramid.h"
+
+@interface UHNDecimationPyramid ()
+{
+    // buckets of all the levels in one allocation, level n starts at _levelOffsets[n - 1]
+    UHNMinMax *_buckets;
+    NSUInteger _levelOffsets[kUHNDecimationPyramidMaxLevels];
+    NSUInteger _levelCapacities[kUHNDecimationPyramidMaxLevels];
+    
+    // a bucket started before this index was not filled, so it starts anew with the data point at this index
+    NSUInteger _startIndex;
+}
+@property (nonatomic, readwrite) NSUInteger capacity;
+@property (nonatomic, readwrite) NSUInteger numberOfLevels;
+@property (nonatomic, readwrite) NSUInteger numberOfValues;
+@end
+
+@implementation UHNDecimationPyramid
+
+#pragma mark - Lifecycle Methods
+
+- (instancetype)init
+{
+    return [self initWithCapacity: 0];
+}
+
+- (instancetype)initWithCapacity: (NSUInteger)capacity
+{
+    if (self = [super init])
+    {
+        _capacity = capacity;
+        
+        // only levels with at least two buckets are useful for drawing
+        NSUInteger totalNumberOfBuckets = 0;
+        while (_numberOfLevels < kUHNDecimationPyramidMaxLevels && (capacity >> (_numberOfLevels + 1)) >= 2)
+        {
+            _levelOffsets[_numberOfLevels] = totalNumberOfBuckets;
+            // one extra bucket for the partially filled newest bucket and one for the partially dropped oldest bucket
+            _levelCapacities[_numberOfLevels] = (capacity >> (_numberOfLevels + 1)) + 2;
+            totalNumberOfBuckets += _levelCapacities[_numberOfLevels];
+            _numberOfLevels++;
+        }
+        _buckets = totalNumberOfBuckets > 0 ? malloc(totalNumberOfBuckets * sizeof(UHNMinMax)) : NULL;
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_buckets);
+}
+
+#pragma mark - Data Point Methods
+
+- (void)appendValues: (const double*)values count: (NSUInteger)count
+{
+    // data points that will be dropped right away are skipped
+    if (count > _capacity)
+    {
+        NSUInteger skippedCount = count - _capacity;
+        values += skippedCount;
+        count = _capacity;
+        _numberOfValues += skippedCount;
+        _startIndex = _numberOfValues;
+    }
+    
+    for (NSUInteger valueIndex = 0; valueIndex < count; valueIndex++)
+    {
+        double value = values[valueIndex];
+        NSUInteger index = _numberOfValues++;
+        for (NSUInteger level = 1; level <= _numberOfLevels; level++)
+        {
+            NSUInteger bucketIndex = index >> level;
+            UHNMinMax *bucket = &_buckets[_levelOffsets[level - 1] + bucketIndex % _levelCapacities[level - 1]];
+            if ((index & ((1 << level) - 1)) == 0 || index == _startIndex)
+            {
+                bucket->minimum = value;
+                bucket->maximum = value;
+            }
+            else
+            {
+                bucket->minimum = MIN(bucket->minimum, value);
+                bucket->maximum = MAX(bucket->maximum, value);
+            }
+        }
+    }
+}
+
+- (void)resetWithStartIndex: (NSUInteger)index
+{
+    _numberOfValues = index;
+    _startIndex = index;
+}
+
+#pragma mark - Level Methods
+
+- (NSUInteger)levelForDataPointsPerPixel: (double)dataPointsPerPixel
+{
+    NSUInteger level = 0;
+    while (level < _numberOfLevels && (double)(1 << (level + 1)) <= dataPointsPerPixel)
+    {
+        level++;
+    }
+    return level;
+}
+
+- (UHNMinMax)minMaxOfBucket: (NSUInteger)bucket atLevel: (NSUInteger)level
+{
+    if (level == 0 || level > _numberOfLevels)
+    {
+        return (UHNMinMax){NAN, NAN};
+    }
+    return _buckets[_levelOffsets[level - 1] + bucket % _levelCapacities[level - 1]];
+}
+
+@end
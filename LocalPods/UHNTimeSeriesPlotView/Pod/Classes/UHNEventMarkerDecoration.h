@@ -0,0 +1,64 @@
+//
+//  UHNEventMarkerDecoration.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import "UHNGraphDecoration.h"
+
+/**
+ `UHNEventMarkerDecoration` marks events, e.g. calibrations and sensor status changes, with vertical lines at their time on a plot of time-keyed data points. All the markers of a decoration share one color and are drawn as a single path by a shape layer.
+ 
+ The path is built in time coordinates and only rebuilt when the markers, the time scale or the height of the graph change. As the plot scrolls, the layer holding the path is moved instead. Use one decoration per color.
+ 
+ The graph must respond to `screenValueForTime:`, as `UHNScrollingTimeSeriesPlotView` does.
+ */
+@interface UHNEventMarkerDecoration : UHNGraphDecoration
+
+/**
+ The color of the markers. Default is the white color
+ */
+@property (nonatomic, strong) UIColor *markerColor;
+
+/**
+ The line width of the markers. Default value is 1
+ */
+@property (nonatomic, assign) CGFloat markerWidth;
+
+/**
+ Add a marker
+ 
+ @param time The time of the event, in the units of the x-axis of the graph
+ */
+- (void)addMarkerAtTime: (double)time;
+
+/**
+ Remove all the markers
+ */
+- (void)removeAllMarkers;
+
+/**
+ The number of markers
+ */
+@property (nonatomic, readonly) NSUInteger numberOfMarkers;
+
+@end
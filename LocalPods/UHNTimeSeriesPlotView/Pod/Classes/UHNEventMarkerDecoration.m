@@ -0,0 +1,138 @@
+//
+//  UHNEventMarkerDecoration.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNEventMarkerDecoration.h"
+#import "UHNGraphView.h"
+#import <QuartzCore/QuartzCore.h>
+
+@protocol UHNTimeScaledGraph <NSObject>
+- (CGFloat)screenValueForTime: (double)time;
+@end
+
+@interface UHNEventMarkerDecoration ()
+{
+    double *_markerTimes;
+    NSUInteger _markersCapacity;
+    
+    // the markers are drawn at x = time * _layoutTimeScale in this layer, which is moved to scroll them
+    CAShapeLayer *_markersLayer;
+    CGFloat _layoutTimeScale;
+    CGFloat _layoutHeight;
+    BOOL _needsPathUpdate;
+}
+@property (nonatomic, readwrite) NSUInteger numberOfMarkers;
+@end
+
+@implementation UHNEventMarkerDecoration
+
+#pragma mark - Lifecycle Methods
+
+- (instancetype)initWithFrame:(CGRect)frame
+{
+    if (self = [super initWithFrame: frame])
+    {
+        self.userInteractionEnabled = NO;
+        self.backgroundColor = [UIColor clearColor];
+        self.clipsToBounds = YES;
+        
+        _markersLayer = [CAShapeLayer layer];
+        _markersLayer.anchorPoint = CGPointZero;
+        _markersLayer.fillColor = nil;
+        [self.layer addSublayer: _markersLayer];
+        
+        self.markerColor = [UIColor whiteColor];
+        self.markerWidth = 1;
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_markerTimes);
+}
+
+#pragma mark - Marker Methods
+
+- (void)setMarkerColor:(UIColor *)markerColor
+{
+    _markerColor = markerColor;
+    _markersLayer.strokeColor = [markerColor CGColor];
+}
+
+- (void)setMarkerWidth:(CGFloat)markerWidth
+{
+    _markerWidth = markerWidth;
+    _markersLayer.lineWidth = markerWidth;
+}
+
+- (void)addMarkerAtTime: (double)time
+{
+    if (self.numberOfMarkers == _markersCapacity)
+    {
+        _markersCapacity = MAX(2 * _markersCapacity, 16);
+        _markerTimes = realloc(_markerTimes, _markersCapacity * sizeof(double));
+    }
+    _markerTimes[self.numberOfMarkers] = time;
+    self.numberOfMarkers++;
+    _needsPathUpdate = YES;
+}
+
+- (void)removeAllMarkers
+{
+    self.numberOfMarkers = 0;
+    _needsPathUpdate = YES;
+}
+
+#pragma mark - Layout Methods
+
+- (void)layoutInGraph: (UHNGraphView *)graph
+{
+    self.frame = graph.bounds;
+    if (![graph respondsToSelector: @selector(screenValueForTime:)])
+    {
+        return;
+    }
+    
+    id<UHNTimeScaledGraph> timeScaledGraph = (id<UHNTimeScaledGraph>)graph;
+    CGFloat origin = [timeScaledGraph screenValueForTime: 0];
+    CGFloat timeScale = [timeScaledGraph screenValueForTime: 1] - origin;
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions: YES];
+    
+    // nothing is plotted yet
+    _markersLayer.hidden = isnan(origin);
+    if (isnan(origin))
+    {
+        [CATransaction commit];
+        return;
+    }
+    
+    CGFloat height = graph.bounds.size.height;
+    if (_needsPathUpdate || timeScale != _layoutTimeScale || height != _layoutHeight)
+    {
+        _layoutTimeScale = timeScale;
+        _layoutHeight = height;
+        _needsPathUpdate = NO;
+        
+        CGMutablePathRef path = CGPathCreateMutable();
+        for (NSUInteger index = 0; index < self.numberOfMarkers; index++)
+        {
+            CGFloat x = timeScale * _markerTimes[index];
+            CGPathMoveToPoint(path, NULL, x, 0);
+            CGPathAddLineToPoint(path, NULL, x, height);
+        }
+        _markersLayer.path = path;
+        CGPathRelease(path);
+    }
+    _markersLayer.position = CGPointMake(origin, 0);
+    
+    [CATransaction commit];
+}
+
+@end
@@ -0,0 +1,134 @@
+//
+//  UHNScaleLayout.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+/**
+ The axis of a scale layout
+ */
+typedef NS_ENUM(NSUInteger, UHNScaleLayoutAxis) {
+    /** A horizontal scale, with labels along its bottom edge and tick marks along its top edge */
+    UHNScaleLayoutAxisX,
+    /** A vertical scale, with labels centered and tick marks along its right edge */
+    UHNScaleLayoutAxisY
+};
+
+/**
+ The values a scale layout depends on, besides the label text formatting
+ */
+typedef struct UHNScaleLayoutKey {
+    double min;
+    double max;
+    double minorStep;
+    double majorStep;
+    CGSize size;
+    CGFloat contentScale;
+} UHNScaleLayoutKey;
+
+/**
+ The screen position of a domain value along a scale, as `UHNXRealScale` and `UHNYRealScale` map it
+ 
+ @param key The key of the scale
+ @param axis The axis of the scale
+ @param value The domain value
+ 
+ @return The x position for the x axis, or the y position for the y axis, from the origin of the scale
+ */
+static inline CGFloat UHNScaleLayoutPosition(UHNScaleLayoutKey key, UHNScaleLayoutAxis axis, double value)
+{
+    if (axis == UHNScaleLayoutAxisX)
+    {
+        return key.size.width * (value - key.min) / (key.max - key.min);
+    }
+    return key.size.height - key.size.height * (value - key.min) / (key.max - key.min);
+}
+
+/**
+ `UHNScaleLayout` is the laid out ticks and labels of an axis scale: a single path of tick marks and pre-rendered label images with their positions.
+ 
+ A layout is built once for an axis, a (min, max, steps, size) key and a label format, and kept in a shared cache so scales can redraw, or switch between ranges they have shown before, by stroking the path and drawing the images instead of formatting and laying out text again. Layouts are immutable once built, and can be built and drawn on any thread, so offscreen renderers share them with the scale views.
+ */
+@interface UHNScaleLayout : NSObject
+
+/**
+ The key the layout was built for
+ */
+@property (nonatomic, readonly) UHNScaleLayoutKey key;
+
+/**
+ The path of the tick marks, in the coordinates of the scale
+ */
+@property (nonatomic, readonly) CGPathRef tickPath;
+
+/**
+ The number of labels
+ */
+@property (nonatomic, readonly) NSUInteger numberOfLabels;
+
+/**
+ The layout of a scale, from the cache or laid out and cached if needed
+ 
+ @param axis The axis of the scale
+ @param key The key of the layout
+ @param formatString The format string of the labels
+ @param units The units label, or nil
+ 
+ @return The layout
+ */
++ (UHNScaleLayout*)layoutForAxis: (UHNScaleLayoutAxis)axis key: (UHNScaleLayoutKey)key formatString: (NSString*)formatString units: (NSString*)units;
+
+/**
+ Create a path of grid lines at every step of a scale, between but not at its ends, at the positions `UHNGraphGridLines` draws them. This is not used by `UHNGraphGridLines` itself.
+ 
+ @param axis The axis of the scale. Grid lines of the x axis are vertical.
+ @param key The key of the scale
+ @param step The step between grid lines
+ @param length The length of the grid lines
+ 
+ @return The path, which the caller must release
+ */
++ (CGPathRef)newGridPathForAxis: (UHNScaleLayoutAxis)axis key: (UHNScaleLayoutKey)key step: (double)step length: (CGFloat)length;
+
+/**
+ Whether the layout was built for a key and label format
+ 
+ @param key The key
+ @param formatString The format string of the labels
+ @param units The units label
+ 
+ @return YES if the layout can be drawn for the key and label format
+ */
+- (BOOL)matchesKey: (UHNScaleLayoutKey)key formatString: (NSString*)formatString units: (NSString*)units;
+
+/**
+ Draw the labels and stroke the tick marks
+ 
+ @param context The context to draw in
+ @param tickColor The stroke color of the tick marks
+ @param tickWidth The line width of the tick marks
+ */
+- (void)drawInContext: (CGContextRef)context tickColor: (UIColor*)tickColor tickWidth: (CGFloat)tickWidth;
+
+@end
@@ -0,0 +1,258 @@
+//
+//  UHNScaleLayout.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNScaleLayout.h"
+
+// number of layouts kept across all scales
+static const NSUInteger kUHNScaleLayoutCacheCountLimit = 32;
+
+@interface UHNScaleLayout ()
+{
+    CGMutablePathRef _tickPath;
+    NSMutableArray *_labelImages;
+    CGRect *_labelRects;
+    NSUInteger _labelsCapacity;
+}
+@property (nonatomic, readwrite) UHNScaleLayoutKey key;
+@property (nonatomic, copy) NSString *formatString;
+@property (nonatomic, copy) NSString *units;
+@end
+
+@implementation UHNScaleLayout
+
+#pragma mark - Cache Methods
+
++ (NSCache*)sharedCache
+{
+    static NSCache *cache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [[NSCache alloc] init];
+        cache.countLimit = kUHNScaleLayoutCacheCountLimit;
+    });
+    return cache;
+}
+
++ (UHNScaleLayout*)layoutForAxis: (UHNScaleLayoutAxis)axis key: (UHNScaleLayoutKey)key formatString: (NSString*)formatString units: (NSString*)units
+{
+    NSArray *cacheKey = @[@(axis),
+                          [NSValue valueWithBytes: &key objCType: @encode(UHNScaleLayoutKey)],
+                          formatString ?: @"",
+                          units ?: @""];
+    UHNScaleLayout *layout = [[self sharedCache] objectForKey: cacheKey];
+    if (!layout)
+    {
+        // the layout is only cached once it is complete, so other threads never draw a partial layout
+        layout = [[UHNScaleLayout alloc] initWithKey: key formatString: formatString units: units];
+        if (axis == UHNScaleLayoutAxisX)
+        {
+            [layout layoutXScale];
+        }
+        else
+        {
+            [layout layoutYScale];
+        }
+        [[self sharedCache] setObject: layout forKey: cacheKey];
+    }
+    return layout;
+}
+
++ (CGPathRef)newGridPathForAxis: (UHNScaleLayoutAxis)axis key: (UHNScaleLayoutKey)key step: (double)step length: (CGFloat)length
+{
+    CGMutablePathRef path = CGPathCreateMutable();
+    if (step <= 0)
+    {
+        return path;
+    }
+    for (double value = key.min + step; value < key.max; value += step)
+    {
+        CGFloat position = UHNScaleLayoutPosition(key, axis, value);
+        if (axis == UHNScaleLayoutAxisX)
+        {
+            CGPathMoveToPoint(path, NULL, position, 0);
+            CGPathAddLineToPoint(path, NULL, position, length);
+        }
+        else
+        {
+            CGPathMoveToPoint(path, NULL, 0, position);
+            CGPathAddLineToPoint(path, NULL, length, position);
+        }
+    }
+    return path;
+}
+
+#pragma mark - Lifecycle Methods
+
+- (instancetype)initWithKey: (UHNScaleLayoutKey)key formatString: (NSString*)formatString units: (NSString*)units
+{
+    if (self = [super init])
+    {
+        self.key = key;
+        self.formatString = formatString;
+        self.units = units;
+        _tickPath = CGPathCreateMutable();
+        _labelImages = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    CGPathRelease(_tickPath);
+    free(_labelRects);
+}
+
+- (BOOL)matchesKey: (UHNScaleLayoutKey)key formatString: (NSString*)formatString units: (NSString*)units
+{
+    return (memcmp(&key, &_key, sizeof(UHNScaleLayoutKey)) == 0 &&
+            (formatString == self.formatString || [formatString isEqualToString: self.formatString]) &&
+            (units == self.units || [units isEqualToString: self.units]));
+}
+
+#pragma mark - Layout Methods
+
+- (CGPathRef)tickPath
+{
+    return _tickPath;
+}
+
+- (NSUInteger)numberOfLabels
+{
+    return _labelImages.count;
+}
+
+- (NSDictionary*)labelAttributesWithAlignment: (NSTextAlignment)alignment
+{
+    NSMutableParagraphStyle *paragraphStyle = [[NSParagraphStyle defaultParagraphStyle] mutableCopy];
+    paragraphStyle.lineBreakMode = NSLineBreakByClipping;
+    paragraphStyle.alignment = alignment;
+    return @{ NSFontAttributeName: [UIFont systemFontOfSize: [UIFont smallSystemFontSize]],
+              NSParagraphStyleAttributeName: paragraphStyle };
+}
+
+- (void)layoutXScale
+{
+    UHNScaleLayoutKey key = self.key;
+    CGFloat labelY = key.size.height - [UIFont smallSystemFontSize] - 3;
+    
+    if (self.units)
+    {
+        [self addLabel: self.units
+                inRect: CGRectMake(UHNScaleLayoutPosition(key, UHNScaleLayoutAxisX, key.min) + 3, labelY, 50, 0)
+        withAttributes: [self labelAttributesWithAlignment: NSTextAlignmentLeft]];
+    }
+    
+    NSDictionary *attributes = [self labelAttributesWithAlignment: NSTextAlignmentCenter];
+    if (key.majorStep > 0)
+    {
+        for (float value = (float)key.min + (float)key.majorStep; value <= (float)key.max - (float)key.majorStep; value += (float)key.majorStep)
+        {
+            [self addLabel: [NSString stringWithFormat: self.formatString, value]
+                    inRect: CGRectMake(UHNScaleLayoutPosition(key, UHNScaleLayoutAxisX, value) - 25, labelY, 50, 0)
+            withAttributes: attributes];
+        }
+    }
+    
+    [self addLabel: [NSString stringWithFormat: self.formatString, (float)key.max]
+            inRect: CGRectMake(UHNScaleLayoutPosition(key, UHNScaleLayoutAxisX, key.max) - 53, labelY, 50, 0)
+    withAttributes: [self labelAttributesWithAlignment: NSTextAlignmentRight]];
+    
+    if (key.minorStep > 0)
+    {
+        for (CGFloat value = (float)key.min + (float)key.minorStep; value < (float)key.max; value += (float)key.minorStep)
+        {
+            CGFloat x = UHNScaleLayoutPosition(key, UHNScaleLayoutAxisX, value);
+            [self addTickFromPoint: CGPointMake(x, 1) toPoint: CGPointMake(x, 5)];
+        }
+    }
+}
+
+- (void)layoutYScale
+{
+    UHNScaleLayoutKey key = self.key;
+    NSDictionary *attributes = [self labelAttributesWithAlignment: NSTextAlignmentCenter];
+    
+    if (self.units)
+    {
+        [self addLabel: self.units
+                inRect: CGRectMake(0, UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, key.min) - [UIFont smallSystemFontSize], key.size.width, 0)
+        withAttributes: attributes];
+    }
+    
+    if (key.majorStep > 0)
+    {
+        for (float value = (float)key.min + (float)key.majorStep; value <= (float)key.max - (float)key.majorStep; value += (float)key.majorStep)
+        {
+            [self addLabel: [NSString stringWithFormat: self.formatString, value]
+                    inRect: CGRectMake(0, UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, value) - [UIFont smallSystemFontSize]/2, key.size.width, 0)
+            withAttributes: attributes];
+        }
+    }
+    
+    [self addLabel: [NSString stringWithFormat: self.formatString, (float)key.max]
+            inRect: CGRectMake(0, UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, key.max) - [UIFont smallSystemFontSize]/4, key.size.width, 0)
+    withAttributes: attributes];
+    
+    if (key.minorStep > 0)
+    {
+        for (CGFloat value = (float)key.min + (float)key.minorStep; value <= (float)key.max; value += (float)key.minorStep)
+        {
+            CGFloat y = UHNScaleLayoutPosition(key, UHNScaleLayoutAxisY, value);
+            [self addTickFromPoint: CGPointMake(key.size.width, y) toPoint: CGPointMake(key.size.width - 5, y)];
+        }
+    }
+}
+
+- (void)addTickFromPoint: (CGPoint)start toPoint: (CGPoint)end
+{
+    CGPathMoveToPoint(_tickPath, NULL, start.x, start.y);
+    CGPathAddLineToPoint(_tickPath, NULL, end.x, end.y);
+}
+
+- (void)addLabel: (NSString*)text inRect: (CGRect)rect withAttributes: (NSDictionary*)attributes
+{
+    // labels are a single line, so only the width of the rect is used
+    UIFont *font = attributes[NSFontAttributeName];
+    CGSize size = CGSizeMake(rect.size.width, ceil(font.lineHeight));
+    if (!text || size.width <= 0 || size.height <= 0)
+    {
+        return;
+    }
+    
+    UIGraphicsBeginImageContextWithOptions(size, NO, self.key.contentScale);
+    [text drawInRect: CGRectMake(0, 0, size.width, size.height) withAttributes: attributes];
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    
+    if (_labelImages.count == _labelsCapacity)
+    {
+        _labelsCapacity = MAX(2 * _labelsCapacity, 8);
+        _labelRects = realloc(_labelRects, _labelsCapacity * sizeof(CGRect));
+    }
+    _labelRects[_labelImages.count] = CGRectMake(rect.origin.x, rect.origin.y, size.width, size.height);
+    [_labelImages addObject: image];
+}
+
+#pragma mark - Drawing Methods
+
+- (void)drawInContext: (CGContextRef)context tickColor: (UIColor*)tickColor tickWidth: (CGFloat)tickWidth
+{
+    UIGraphicsPushContext(context);
+    for (NSUInteger index = 0; index < _labelImages.count; index++)
+    {
+        [_labelImages[index] drawInRect: _labelRects[index]];
+    }
+    UIGraphicsPopContext();
+    
+    CGContextSetStrokeColorWithColor(context, [tickColor CGColor]);
+    CGContextSetLineWidth(context, tickWidth);
+    CGContextAddPath(context, _tickPath);
+    CGContextStrokePath(context);
+}
+
+@end
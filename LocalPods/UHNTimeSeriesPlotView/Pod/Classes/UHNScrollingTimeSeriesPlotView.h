@@ -0,0 +1,352 @@
+//
+//  UHNScrollingTimeSeriesPlotView.h
+//  Monashee
+//
+//  Created by Nathaniel Hamming on 12-03-01.
+//  Copyright (c) 2015 UHN. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import "UHNGraphView.h"
+
+/**
+ How an overlay series is drawn
+ */
+typedef NS_ENUM(NSUInteger, UHNPlotSeriesStyle) {
+    /** A line through the data points, broken over gaps longer than `maximumTimeGap` */
+    UHNPlotSeriesStyleLine,
+    /** A dot at each data point, e.g. for fingerstick calibration values */
+    UHNPlotSeriesStylePoints
+};
+
+/**
+ `UHNScrollingTimeSeriesPlotView` is a dynamic time series plot capable of displaying data collected in real-time. It is a subclass of the UHNGraphView with convenience methods for adding/removing data points, setting refresh of the plot (when the data is being collected faster then the UI can handle. This would present data points in blocks), etc.
+ 
+ Construction of the plot view is a large setup method with a variety of parameters. This implementation is indented that the plot is constructed once with all relevant details. For the parameters that are can be updated dynamically, additional convenience methods or class properties are provided.
+ 
+ This plot view can be using in conjunction with the UHNGraphGridView, if a grid is desired with the plot. As well, the axes can be visualized with UHNXRealScale and UHNYRealScale views. All these classes are provided as part of this cocoapod.
+ 
+ Future development of this cocoapod is to include a UIScrollView container for the plot, such that the user can pause the plot refresh and scroll back to view historical data. Currently this feature is partially implemented.
+ */
+@interface UHNScrollingTimeSeriesPlotView : UHNGraphView
+
+/**
+ The color of the line plotted. Default is the white color
+ */
+@property (nonatomic, strong) UIColor *lineColor;
+
+/**
+ The color of the line head. The line head color is a circular gradient from the specified color with alpha of 1 fading to an alpha of 0.
+ */
+@property (nonatomic, strong) UIColor *lineHeadColor;
+
+/**
+ The width of the line plotted. Default value is 1.
+ */
+@property (nonatomic, assign) CGFloat lineWidth;
+
+/**
+ The refresh rate of the plot in Hz. If this slower than the sampling rate, the plot will refresh with blocks of data. Making this value faster than the sampling rate is not appropriate, as the plot would refresh without any additional data. Refreshes are synchronised with the display and skipped when no data points were added. Default value is 1 Hz.
+ */
+@property (nonatomic, assign) double plotRefreshRateInHz;
+
+/**
+ The sampling rate of the collected data in Hz. This value is needed to appropriately visualize the data points on a time-based scale. Default value is 1 Hz.
+ */
+@property (nonatomic, assign) double samplingRateInHz;
+
+/**
+ The max size of the data point window, which indicates how many data points should be stored in memory before being dropped. When a UIScrollView container is used and the max window size is greater than the x-axis range, the plot view will extend past the UIScrollView frame and allow for historical viewing of data. The data points are stored in a fixed-capacity ring buffer of this size.
+ 
+ When the x-axis range shows more than one data point per pixel column, the plot draws the minimum and maximum of each bucket of data points at the level of detail that fits the range, so a long history is drawn in roughly constant time.
+ */
+@property (nonatomic, assign) NSInteger windowMaxSize;
+
+/**
+ Specifies if the rendered history is cached. When enabled, the plotted line is kept in layers holding tiles of line segments: an update only builds the segments of the new data points and scrolls by moving the layers, so the cost of an update scales with the number of new data points instead of the window size. Only the data points added by index are cached; time-keyed data points are always drawn by `drawRect:`. The plot view is not extended for historical viewing in this mode. Default value is NO.
+ */
+@property (nonatomic, assign) BOOL cachesRenderedHistory;
+
+/**
+ Allows for manual plot updates. This method could be linked to a timer or specific actions. The plot is updated immediately
+ */
+- (void)updatePlot;
+
+/**
+ Marks the plot as changed. The plot is updated once on the next display refresh, no matter how many changes were made, and not at all while it is hidden or off screen. Adding data points calls this method
+ */
+- (void)setNeedsPlotUpdate;
+
+/**
+ Generate random data to be plotted. This should be used as a visual test to ensure the plot view is acting correctly.
+ 
+ @param on Specifies is data generation should be on
+ */
+- (void)generateRandomData: (BOOL)on;
+
+/**
+ Add a single data point to the plot.
+ 
+ @param dataPoint The data point to be added to the plot
+ */
+- (void)addDataPoint: (NSNumber*)dataPoint;
+
+/**
+ Add an array of data points to the plot. The data in the array should be ordered from oldest to newest. The array must contain NSNumber objects.
+ 
+ @param dataPoints Array of the data points (NSNumber) to be added to the plot.
+ */
+- (void)addDataPoints: (NSArray *)dataPoints;
+
+/**
+ Add a C array of values to the plot without boxing them. The values should be ordered from oldest to newest. Only the newest `windowMaxSize` values are kept, so appending does not allocate memory.
+ 
+ @param values The values to be added to the plot
+ @param count The number of values
+ */
+- (void)addValues: (const double*)values count: (NSUInteger)count;
+
+/**
+ The number of data points currently stored, which is at most `windowMaxSize`
+ */
+@property (nonatomic, readonly) NSUInteger numberOfDataPoints;
+
+/**
+ The value of a stored data point
+ 
+ @param index The index of the data point, where 0 is the oldest
+ 
+ @return The value of the data point, or NAN if the index is out of range
+ */
+- (double)valueAtIndex: (NSUInteger)index;
+
+/**
+ Create the path `drawRect:` strokes the data points added by index along, with the newest data point at the right edge. When the x-axis range shows more than one data point per pixel column, the path runs through the minimum and maximum of each bucket of the decimation level that fits the range instead of through each data point. Time-keyed data points are not decimated.
+ 
+ @return The path in the coordinates of the view, which the caller must release
+ */
+- (CGPathRef)newPathForDataPoints;
+
+/**
+ Add a data point at a time. Time-keyed data points are positioned by their time on the x-axis instead of by their index and the sampling rate, so irregular sampling, gaps and data points that arrive out of order (e.g. backfilled records) are plotted where they belong. The newest time is plotted at the right edge of the plot. When the plot holds time-keyed data points, these are plotted instead of the data points added by index.
+ 
+ At most `windowMaxSize` time-keyed data points are kept, dropping the oldest. Adding a data point at a time that is already stored replaces its value.
+ 
+ @param value The value of the data point
+ @param time The time of the data point, in the units of the x-axis (e.g. the CGM time offset in minutes)
+ */
+- (void)addValue: (double)value atTime: (double)time;
+
+/**
+ Add a C array of time-keyed data points, in any order
+ 
+ @param values The values of the data points
+ @param times The times of the data points, in the units of the x-axis
+ @param count The number of data points
+ */
+- (void)addValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count;
+
+/**
+ Enqueue time-keyed data points from any thread. The data points are copied into a pending buffer and merged into the plot on the main thread by the next plot update, which is requested once per batch, so a stream of data points can be prepared off the main thread without touching the UI for every data point.
+ 
+ @param values The values of the data points
+ @param times The times of the data points, in the units of the x-axis
+ @param count The number of data points
+ */
+- (void)enqueueValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count;
+
+/**
+ The maximum time between two consecutive time-keyed data points that are connected by the line, in the units of the x-axis. The line is broken over longer gaps. Default value is 0, which always connects the data points.
+ */
+@property (nonatomic, assign) double maximumTimeGap;
+
+/**
+ The screen position of a time on the x-axis, as the time-keyed data points are plotted
+ 
+ @param time The time, in the units of the x-axis
+ 
+ @return The x screen position, or NAN if no time-keyed data points are plotted
+ */
+- (CGFloat)screenValueForTime: (double)time;
+
+/**
+ The number of time-keyed data points currently stored
+ */
+@property (nonatomic, readonly) NSUInteger numberOfTimedDataPoints;
+
+/**
+ The time of a stored time-keyed data point
+ 
+ @param index The index of the data point, in ascending order of time
+ 
+ @return The time of the data point, or NAN if the index is out of range
+ */
+- (double)timeOfTimedDataPointAtIndex: (NSUInteger)index;
+
+/**
+ The value of a stored time-keyed data point
+ 
+ @param index The index of the data point, in ascending order of time
+ 
+ @return The value of the data point, or NAN if the index is out of range
+ */
+- (double)valueOfTimedDataPointAtIndex: (NSUInteger)index;
+
+/**
+ The indexes of the time-keyed data points within a time range, found by binary search
+ 
+ @param startTime The start of the time range, inclusive
+ @param endTime The end of the time range, inclusive
+ 
+ @return The range of indexes
+ */
+- (NSRange)rangeOfTimedDataPointsFromTime: (double)startTime toTime: (double)endTime;
+
+/**
+ Add an overlay series of time-keyed data points, e.g. a second sensor or the calibration values, plotted on the same axes as the main line. All series share one pass over the scales and one grid, and their data points are held in contiguous storage shared by the series.
+ 
+ The series are plotted on the time axis of the time-keyed data points, with the newest time of all series at the right edge, and drawn over the main line in the order they were added. A main line of data points added by index has no time axis, so it is drawn as usual and the series are plotted with their newest data point at the right edge next to its newest data point. When `cachesRenderedHistory` is enabled, the cached main line is drawn over the series.
+ 
+ @param color The color of the series
+ @param lineWidth The width of the line, or of the outline of the dots
+ @param style How the series is drawn
+ @param capacity The number of most recent data points kept for the series
+ 
+ @return The index of the series
+ */
+- (NSUInteger)addSeriesWithColor: (UIColor*)color lineWidth: (CGFloat)lineWidth style: (UHNPlotSeriesStyle)style capacity: (NSUInteger)capacity;
+
+/**
+ Add a data point to an overlay series, in any order. Adding a data point at a time that is already stored replaces its value.
+ 
+ @param value The value of the data point
+ @param time The time of the data point, in the units of the x-axis
+ @param series The index of the series
+ */
+- (void)addValue: (double)value atTime: (double)time toSeries: (NSUInteger)series;
+
+/**
+ The number of overlay series
+ */
+@property (nonatomic, readonly) NSUInteger numberOfSeries;
+
+/**
+ The number of data points currently stored in an overlay series
+ 
+ @param series The index of the series
+ 
+ @return The number of data points, or 0 if there is no such series
+ */
+- (NSUInteger)numberOfDataPointsInSeries: (NSUInteger)series;
+
+/**
+ The time of a data point of an overlay series
+ 
+ @param index The index of the data point, in ascending order of time
+ @param series The index of the series
+ 
+ @return The time of the data point, or NAN if the index is out of range
+ */
+- (double)timeOfDataPointAtIndex: (NSUInteger)index inSeries: (NSUInteger)series;
+
+/**
+ The value of a data point of an overlay series
+ 
+ @param index The index of the data point, in ascending order of time
+ @param series The index of the series
+ 
+ @return The value of the data point, or NAN if the index is out of range
+ */
+- (double)valueOfDataPointAtIndex: (NSUInteger)index inSeries: (NSUInteger)series;
+
+/**
+ Remove the overlay series and their data points
+ */
+- (void)removeAllSeries;
+
+/**
+ First clear the plot and then plot the data in the array. The data in the array should be ordered from oldest to newest. The array must contain NSNumber objects.
+ 
+ @param data Array of the data points (NSNumber) to be added to the plot.
+ */
+- (void)plotData: (NSArray*)data;
+
+/**
+ Remove all the data points from the plot, including those of the overlay series, which are kept.
+ */
+- (void)removeAllDataPoints;
+
+/**
+ Used to set an independent refresh cycle for the plot, based on the plot refresh rate. This should be used when the data collected is too fast for the UI.
+ 
+ @param refresh Specifies if the plot should run indepent refresh cycle
+ */
+- (void)shouldRefresh: (BOOL)refresh;
+
+/** 
+ Hides the plot
+ 
+ @param hidden Specifies if the plot should be hidden
+ */
+- (void)hidePlot: (BOOL)hidden;
+
+/**
+ Construction of the plot view. This method should be called after the plot view has been instantiated. It includes all relevant details of the plot to be visualized and present data.
+ 
+ @param xMin The minimum value of the x-axis range
+ @param xMax The maximum value of the x-axis range
+ @param xMinorStep The minor step of the x-axis and used to visual x-axis minor ticks on the graph grid
+ @param xMajorStep The major step of the x-axis and used to visual x-axis major ticks on the graph grid
+ @param xLabel The unit label for the x-axis
+ @param xFormatString The format string for presenting the x-axis major tick value on the graph grid
+ @param yMin The minimum value of the y-axis range
+ @param yMax The maximum value of the y-axis range
+ @param yMinorStep The minor step of the y-axis and used to visual y-axis minor ticks on the graph grid
+ @param yMajorStep The major step of the y-axis and used to visual y-axis major ticks on the graph grid
+ @param yLabel The unit label for the y-axis
+ @param yFormatString The format string for presenting the y-axis major tick value on the graph grid
+ @param gridColor The color of the graph grid lines
+ @param gridFrameWidth The line width of the graph grid frame
+ @param drawGridFrame Specifies if the frame of the graph grid shoul be drawn
+ @param fadeGridLineEdges Specifies if the graph grid lines tips should be faded
+ @param lineColor Specifies the color of the line plotted
+ @param lineHeadColor Specifies the color of the line head. The line head is a circular gradient that fades from an alpha of 1 to 0
+ @param lineWidth The width of the line plotted
+ */
+- (void)setupPlotWithXAxisMin: (CGFloat)xMin
+                     xAxisMax: (CGFloat)xMax
+                   xMinorStep: (CGFloat)xMinorStep
+                   xMajorStep: (CGFloat)xMajorStep
+                   xAxisLabel: (NSString*)xLabel
+            xAxisFormatString: (NSString*)xFormatString
+                     yAxisMin: (CGFloat)yMin 
+                     yAxisMax: (CGFloat)yMax
+                   yMinorStep: (CGFloat)yMinorStep
+                   yMajorStep: (CGFloat)yMajorStep
+                   yAxisLabel: (NSString*)yLabel
+            yAxisFormatString: (NSString*)yFormatString
+                    gridColor: (UIColor*)gridColor
+               gridFrameWidth: (CGFloat)gridFrameWidth
+                drawGridFrame: (BOOL)drawGridFrame
+            fadeGridLineEdges: (BOOL)fadeGridLineEdges
+                    lineColor: (UIColor*)lineColor 
+                lineHeadColor: (UIColor*)lineHeadColor
+                 andLineWidth: (CGFloat)lineWidth;
+
+@end
@@ -0,0 +1,1300 @@
+//
+//  UHNScrollingTimeSeriesPlotView.m
+//  Monashee
+//
+//  Created by Nathaniel Hamming on 12-03-01.
+//  Copyright (c) 2015 UHN. All rights reserved.
+//
+
+#import "UHNScrollingTimeSeriesPlotView.h"
+#import "UHNGraphScaleDataSource.h"
+#import "UHNXRealScale.h"
+#import "UHNYRealScale.h"
+#import "UHNGraphGridLines.h"
+#import "UHNDecimationPyramid.h"
+#import "UHNGraphDecoration.h"
+#import <QuartzCore/QuartzCore.h>
+#import <pthread.h>
+
+// number of line segments stored in each cached tile of the rendered history
+static const NSUInteger kUHNPlotSegmentsPerTile = 64;
+
+// diameter of the line head
+static const CGFloat kUHNPlotLineHeadDiameter = 20.;
+
+// diameter of the dots of a series drawn with UHNPlotSeriesStylePoints
+static const CGFloat kUHNPlotSeriesPointDiameter = 6.;
+
+static inline BOOL UHNObjectsEqual(id a, id b)
+{
+    return a == b || [a isEqual: b];
+}
+
+// an overlay series, stored in [offset + start, offset + start + count) of the shared series buffers, whose slice is twice its capacity
+typedef struct UHNPlotSeries {
+    NSUInteger offset;
+    NSUInteger capacity;
+    NSUInteger start;
+    NSUInteger count;
+    CGColorRef color;
+    CGFloat lineWidth;
+    UHNPlotSeriesStyle style;
+} UHNPlotSeries;
+
+// binary search for the first of count sorted times at or after a time
+static NSUInteger UHNIndexOfFirstTimeAtOrAfter(const double *times, NSUInteger count, double time)
+{
+    NSUInteger low = 0;
+    NSUInteger high = count;
+    while (low < high)
+    {
+        NSUInteger middle = (low + high) / 2;
+        if (times[middle] < time)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// insert a data point into sorted time-keyed buffers of twice the capacity, holding the data points in [*start, *start + *count)
+static void UHNInsertTimedValue(double *times, double *values, NSUInteger capacity, NSUInteger *start, NSUInteger *count, double time, double value)
+{
+    if (capacity == 0)
+    {
+        return;
+    }
+    
+    // a full window drops the oldest data point, so an older one would be dropped right away
+    if (*count == capacity && time < times[*start])
+    {
+        return;
+    }
+    
+    NSUInteger position = UHNIndexOfFirstTimeAtOrAfter(times + *start, *count, time);
+    if (position < *count && times[*start + position] == time)
+    {
+        values[*start + position] = value;
+        return;
+    }
+    
+    if (*count == capacity)
+    {
+        (*start)++;
+        (*count)--;
+        position--;
+    }
+    
+    // move the data points to the front once the end of the buffers is reached, which is amortized over the window
+    if (*start + *count == 2 * capacity)
+    {
+        memmove(times, times + *start, *count * sizeof(double));
+        memmove(values, values + *start, *count * sizeof(double));
+        *start = 0;
+    }
+    
+    // data points usually arrive in order, so this rarely moves anything
+    NSUInteger insertIndex = *start + position;
+    memmove(times + insertIndex + 1, times + insertIndex, (*count - position) * sizeof(double));
+    memmove(values + insertIndex + 1, values + insertIndex, (*count - position) * sizeof(double));
+    times[insertIndex] = time;
+    values[insertIndex] = value;
+    (*count)++;
+}
+
+@interface UHNScrollingTimeSeriesPlotView() <UIScrollViewDelegate>
+{
+    // ring buffer of the data points, sized by the window max size
+    double *_samples;
+    NSUInteger _samplesCapacity;
+    NSUInteger _samplesStart;
+    NSUInteger _samplesCount;
+    
+    // min/max of the data points at several levels of detail, sized like the ring buffer
+    UHNDecimationPyramid *_decimationPyramid;
+    
+    // time-keyed data points sorted by time, in [_timedStart, _timedStart + _timedCount) of buffers twice the window max size
+    double *_timedTimes;
+    double *_timedValues;
+    NSUInteger _timedCapacity;
+    NSUInteger _timedStart;
+    NSUInteger _timedCount;
+    
+    // time-keyed data points enqueued from any thread, merged on the main thread by the next plot update
+    pthread_mutex_t _pendingLock;
+    double *_pendingTimes;
+    double *_pendingValues;
+    NSUInteger _pendingCapacity;
+    NSUInteger _pendingCount;
+    BOOL _pendingUpdateScheduled;
+    
+    // overlay series, whose data points share one pair of contiguous buffers
+    UHNPlotSeries *_series;
+    NSUInteger _numberOfSeries;
+    double *_seriesTimes;
+    double *_seriesValues;
+    NSUInteger _seriesStorageSize;
+    
+    // radial gradient of the line head, rebuilt when the line head color changes
+    CGGradientRef _lineHeadGradient;
+    
+    // number of data points added since the plot was cleared, used as the index of the newest data point
+    NSUInteger _totalNumberOfDataPoints;
+    
+    // cached rendering of the history: tiles of line segments in sample coordinates, scrolled by moving the layer
+    CALayer *_historyLayer;
+    CALayer *_lineHeadLayer;
+    NSMutableArray *_tileLayers;
+    NSMutableArray *_reusableTileLayers;
+    NSUInteger _firstTileIndex;
+    NSUInteger _renderedNumberOfDataPoints;
+}
+@property (nonatomic, strong) IBOutlet UIScrollView *container;
+@property (nonatomic, strong) NSTimer *dataGeneratorTimer;
+@property (nonatomic, strong) CADisplayLink *displayLink;
+@property (nonatomic, assign) BOOL isRefreshing;
+@property (nonatomic, assign) BOOL needsPlotUpdate;
+@property (nonatomic, assign) CGFloat xOffsetPerSample;
+@property (nonatomic, assign) CGFloat yOffsetPerUnit;
+@property (nonatomic, assign) CGFloat yOffsetForZeroLine;
+@property (nonatomic, assign) NSInteger dataMaxSize;
+- (void)addRandomDataPoint;
+@end
+
+@implementation UHNScrollingTimeSeriesPlotView
+
+#pragma mark - Lifecycle Methods
+
+- (instancetype)init
+{
+    [NSException raise:NSInvalidArgumentException
+                format:@"%s: Use %@ instead", __PRETTY_FUNCTION__, NSStringFromSelector(@selector(initWithFrame:))];
+    return nil;
+}
+
+- (instancetype)initWithFrame:(CGRect)frame
+{
+    if (self = [super initWithFrame: frame])
+    {
+        [self setDefaults];
+    }
+    return self;
+}
+
+- (id)initWithCoder:(NSCoder *)aDecoder 
+{
+    self = [super initWithCoder: aDecoder];
+    if (self) 
+    {
+        [self setDefaults];
+    }
+    return self;    
+}
+
+- (void)dealloc
+{
+    free(_samples);
+    free(_timedTimes);
+    free(_timedValues);
+    free(_pendingTimes);
+    free(_pendingValues);
+    for (NSUInteger index = 0; index < _numberOfSeries; index++)
+    {
+        CGColorRelease(_series[index].color);
+    }
+    free(_series);
+    free(_seriesTimes);
+    free(_seriesValues);
+    pthread_mutex_destroy(&_pendingLock);
+    CGGradientRelease(_lineHeadGradient);
+}
+
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+    if (self.cachesRenderedHistory && !CGRectEqualToRect(_historyLayer.bounds, self.layer.bounds))
+    {
+        [self invalidateRenderedHistory];
+        [self renderHistory];
+    }
+}
+
+- (void)setDefaults;
+{
+    pthread_mutex_init(&_pendingLock, NULL);
+    
+    //Load defaults
+    self.plotRefreshRateInHz = 1;
+    self.samplingRateInHz = 1;
+    self.lineWidth = 1;
+    self.lineColor = [UIColor whiteColor];
+}
+
+- (void)setupPlotWithXAxisMin: (CGFloat)xMin
+                     xAxisMax: (CGFloat)xMax
+                   xMinorStep: (CGFloat)xMinorStep
+                   xMajorStep: (CGFloat)xMajorStep
+                   xAxisLabel: (NSString*)xLabel
+            xAxisFormatString: (NSString*)xFormatString
+                     yAxisMin: (CGFloat)yMin 
+                     yAxisMax: (CGFloat)yMax
+                   yMinorStep: (CGFloat)yMinorStep
+                   yMajorStep: (CGFloat)yMajorStep
+                   yAxisLabel: (NSString*)yLabel
+            yAxisFormatString: (NSString*)yFormatString
+                    gridColor: (UIColor*)gridColor
+               gridFrameWidth: (CGFloat)gridFrameWidth
+                drawGridFrame: (BOOL)drawGridFrame
+            fadeGridLineEdges: (BOOL)fadeGridLineEdges
+                    lineColor: (UIColor*)color 
+                lineHeadColor: (UIColor*)headColor
+                 andLineWidth: (CGFloat)lineWidth
+{
+    self.lineColor = color;
+    self.lineHeadColor = headColor;
+    self.lineWidth = lineWidth;
+    
+    // Setup x-axis
+    if (!self.xScale) 
+    {
+        self.xScale = [[UHNXRealScale alloc] initWithFrame: self.frame];
+    }
+    BOOL scalesChanged = [self setupScale: self.xScale
+                                  withMin: [NSNumber numberWithDouble: xMin]
+                                      max: [NSNumber numberWithDouble: xMax]
+                                minorStep: [NSNumber numberWithFloat: xMinorStep]
+                                majorStep: [NSNumber numberWithFloat: xMajorStep]
+                                    label: xLabel
+                             formatString: xFormatString
+                                tickColor: gridColor];
+    
+    // Setup y-axis    
+    if (!self.yScale) 
+    {
+        self.yScale = [[UHNYRealScale alloc] initWithFrame: self.frame];
+    }
+    scalesChanged |= [self setupScale: self.yScale
+                              withMin: [NSNumber numberWithDouble: yMin]
+                                  max: [NSNumber numberWithDouble: yMax]
+                            minorStep: [NSNumber numberWithFloat: yMinorStep]
+                            majorStep: [NSNumber numberWithFloat: yMajorStep]
+                                label: yLabel
+                         formatString: yFormatString
+                            tickColor: gridColor];
+    
+    //Setup Grid, which is only redrawn when it or the scales changed
+    UIColor *gridLineColor = [gridColor colorWithAlphaComponent: 0.8];
+    BOOL gridChanged = (self.grid.drawsFrame != drawGridFrame ||
+                        self.grid.fadeGridLineEdges != fadeGridLineEdges ||
+                        self.grid.frameLineWidth != gridFrameWidth ||
+                        !UHNObjectsEqual(self.grid.frameColor, gridColor) ||
+                        !UHNObjectsEqual(self.grid.gridLineColor, gridLineColor) ||
+                        self.grid.xMinorScaleLineWidth != 1 ||
+                        self.grid.xMajorScaleLineWidth != 3);
+    self.grid.drawsFrame = drawGridFrame;
+    self.grid.fadeGridLineEdges = fadeGridLineEdges;
+    self.grid.frameLineWidth = gridFrameWidth;
+    self.grid.frameColor = gridColor;
+    
+    self.grid.gridLineColor = gridLineColor;
+    self.grid.xMinorScaleLineWidth = 1;
+    self.grid.xMajorScaleLineWidth = 3;
+    if (scalesChanged || gridChanged)
+    {
+        [self.grid setNeedsDisplay];
+    }
+}
+
+- (BOOL)setupScale: (UIView<UHNGraphScaleDataSource>*)scale
+           withMin: (NSNumber*)min
+               max: (NSNumber*)max
+         minorStep: (NSNumber*)minorStep
+         majorStep: (NSNumber*)majorStep
+             label: (NSString*)label
+      formatString: (NSString*)formatString
+         tickColor: (UIColor*)tickColor
+{
+    // setting up the same scale again keeps its drawing, otherwise it redraws from its cached layout for the new range
+    BOOL changed = (!UHNObjectsEqual(scale.min, min) ||
+                    !UHNObjectsEqual(scale.max, max) ||
+                    !UHNObjectsEqual(scale.minorStep, minorStep) ||
+                    !UHNObjectsEqual(scale.majorStep, majorStep) ||
+                    !UHNObjectsEqual(scale.units, label) ||
+                    !UHNObjectsEqual(scale.formatString, formatString) ||
+                    !UHNObjectsEqual(scale.tickColor, tickColor));
+    scale.min = min;
+    scale.max = max;
+    scale.minorStep = minorStep;
+    scale.majorStep = majorStep;
+    scale.formatString = formatString;
+    scale.units = label;
+    scale.tickColor = tickColor;
+    if (changed)
+    {
+        [scale setNeedsDisplay];
+    }
+    return changed;
+}
+
+#pragma mark - Data Point methods
+
+- (void)generateRandomData: (BOOL)on
+{
+    if (on) 
+    {
+        [self addRandomDataPoint];
+        self.dataGeneratorTimer = [NSTimer scheduledTimerWithTimeInterval: 1.0/self.samplingRateInHz 
+                                                                   target: self 
+                                                                 selector: @selector(addRandomDataPoint) 
+                                                                 userInfo: nil 
+                                                                  repeats: YES];   
+    }
+    else 
+    {
+        [self.dataGeneratorTimer invalidate];
+    }
+}
+
+- (void)addRandomDataPoint
+{
+    NSNumber *randomValue = [NSNumber numberWithInteger: (arc4random() % ([self.yScale.max integerValue] - [self.yScale.min integerValue]) + [self.yScale.min integerValue])];
+    [self addDataPoint: randomValue];
+}
+
+- (void)addDataPoint: (NSNumber*)dataPoint
+{
+    [self addDataPoints: @[dataPoint]];
+}
+
+- (void)addDataPoints:(NSArray *)someDataPoints
+{
+    for (NSNumber *dataPoint in someDataPoints)
+    {
+        double value = [dataPoint doubleValue];
+        [self appendValues: &value count: 1];
+    }
+    [self setNeedsPlotUpdate];
+}
+
+- (void)addValues: (const double*)values count: (NSUInteger)count
+{
+    [self appendValues: values count: count];
+    [self setNeedsPlotUpdate];
+}
+
+- (void)appendValues: (const double*)values count: (NSUInteger)count
+{
+    if (_samplesCapacity == 0 || count == 0)
+    {
+        return;
+    }
+    [_decimationPyramid appendValues: values count: count];
+    _totalNumberOfDataPoints += count;
+    
+    // only the newest values that fit in the window are kept
+    if (count >= _samplesCapacity)
+    {
+        memcpy(_samples, values + (count - _samplesCapacity), _samplesCapacity * sizeof(double));
+        _samplesStart = 0;
+        _samplesCount = _samplesCapacity;
+        return;
+    }
+    
+    NSUInteger end = (_samplesStart + _samplesCount) % _samplesCapacity;
+    NSUInteger firstPart = MIN(count, _samplesCapacity - end);
+    memcpy(_samples + end, values, firstPart * sizeof(double));
+    memcpy(_samples, values + firstPart, (count - firstPart) * sizeof(double));
+    
+    NSUInteger newCount = _samplesCount + count;
+    if (newCount > _samplesCapacity)
+    {
+        _samplesStart = (_samplesStart + (newCount - _samplesCapacity)) % _samplesCapacity;
+        newCount = _samplesCapacity;
+    }
+    _samplesCount = newCount;
+}
+
+- (NSUInteger)numberOfDataPoints
+{
+    return _samplesCount;
+}
+
+- (double)valueAtIndex: (NSUInteger)index
+{
+    if (index >= _samplesCount)
+    {
+        return NAN;
+    }
+    return _samples[(_samplesStart + index) % _samplesCapacity];
+}
+
+- (void)setWindowMaxSize:(NSInteger)windowMaxSize
+{
+    _windowMaxSize = windowMaxSize;
+    NSUInteger capacity = (NSUInteger)MAX(windowMaxSize, 0);
+    if (capacity == _samplesCapacity)
+    {
+        return;
+    }
+    
+    // keep the newest data points in order, starting at the front of the new buffer
+    double *samples = capacity > 0 ? malloc(capacity * sizeof(double)) : NULL;
+    NSUInteger count = MIN(_samplesCount, capacity);
+    for (NSUInteger index = 0; index < count; index++)
+    {
+        samples[index] = [self valueAtIndex: _samplesCount - count + index];
+    }
+    free(_samples);
+    _samples = samples;
+    _samplesCapacity = capacity;
+    _samplesStart = 0;
+    _samplesCount = count;
+    
+    _decimationPyramid = [[UHNDecimationPyramid alloc] initWithCapacity: capacity];
+    [_decimationPyramid resetWithStartIndex: _totalNumberOfDataPoints - count];
+    [_decimationPyramid appendValues: _samples count: count];
+    
+    [self resizeTimedDataPointsToCapacity: capacity];
+    [self invalidateRenderedHistory];
+}
+
+- (void)plotData: (NSArray*)data
+{
+    [self removeAllDataPoints];
+    [self addDataPoints: data];
+}
+
+- (void)setSamplingRateInHz:(double)aSamplingRateInHz
+{
+    _samplingRateInHz = aSamplingRateInHz;
+    self.xOffsetPerSample = [self.xScale screenValueForDomain: [NSNumber numberWithDouble: (1 / self.samplingRateInHz)]];
+//    NSLog(@"x offset per sample (%f sec/sample) in pixels: %f", (1/self.samplingRateInHz), self.xOffsetPerSample);
+    self.yOffsetPerUnit = [self.yScale screenValueForDomain: [NSNumber numberWithDouble: [self.yScale.max doubleValue] - 1]];
+//    NSLog(@"y offset for 1 unit: %f", self.yOffsetPerUnit);
+    self.yOffsetForZeroLine = [self.yScale screenValueForDomain: [NSNumber numberWithInt: 0]];
+//    NSLog(@"y offset for 0 line: %f", self.yOffsetForZeroLine);
+    
+    [self invalidateRenderedHistory];
+    self.windowMaxSize = _samplingRateInHz * [self.xScale.max doubleValue];
+//    NSLog(@"array max size %ld", (long)self.windowMaxSize);
+//    NSLog(@"refresh rate: %f secs (%f samples/refresh)", 1/self.plotRefreshRateInHz, self.samplingRateInHz/self.plotRefreshRateInHz);
+    
+    // only store 4 windows of data
+    self.dataMaxSize = 4 * self.windowMaxSize;
+}
+
+#pragma mark - Time-Keyed Data Point methods
+
+- (void)addValue: (double)value atTime: (double)time
+{
+    [self insertValue: value atTime: time];
+    [self setNeedsPlotUpdate];
+}
+
+- (void)addValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count
+{
+    for (NSUInteger index = 0; index < count; index++)
+    {
+        [self insertValue: values[index] atTime: times[index]];
+    }
+    [self setNeedsPlotUpdate];
+}
+
+- (void)enqueueValues: (const double*)values atTimes: (const double*)times count: (NSUInteger)count
+{
+    if (count == 0)
+    {
+        return;
+    }
+    
+    pthread_mutex_lock(&_pendingLock);
+    if (_pendingCount + count > _pendingCapacity)
+    {
+        _pendingCapacity = MAX(2 * _pendingCapacity, _pendingCount + count);
+        _pendingTimes = realloc(_pendingTimes, _pendingCapacity * sizeof(double));
+        _pendingValues = realloc(_pendingValues, _pendingCapacity * sizeof(double));
+    }
+    memcpy(_pendingTimes + _pendingCount, times, count * sizeof(double));
+    memcpy(_pendingValues + _pendingCount, values, count * sizeof(double));
+    _pendingCount += count;
+    BOOL shouldScheduleUpdate = !_pendingUpdateScheduled;
+    _pendingUpdateScheduled = YES;
+    pthread_mutex_unlock(&_pendingLock);
+    
+    // the main thread is only signalled once per batch
+    if (shouldScheduleUpdate)
+    {
+        __weak typeof(self) weakSelf = self;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakSelf setNeedsPlotUpdate];
+        });
+    }
+}
+
+- (void)mergePendingDataPoints
+{
+    pthread_mutex_lock(&_pendingLock);
+    for (NSUInteger index = 0; index < _pendingCount; index++)
+    {
+        [self insertValue: _pendingValues[index] atTime: _pendingTimes[index]];
+    }
+    _pendingCount = 0;
+    _pendingUpdateScheduled = NO;
+    pthread_mutex_unlock(&_pendingLock);
+}
+
+- (void)insertValue: (double)value atTime: (double)time
+{
+    UHNInsertTimedValue(_timedTimes, _timedValues, _timedCapacity, &_timedStart, &_timedCount, time, value);
+}
+
+- (NSUInteger)indexOfFirstTimedDataPointAtOrAfterTime: (double)time
+{
+    return UHNIndexOfFirstTimeAtOrAfter(_timedTimes + _timedStart, _timedCount, time);
+}
+
+- (NSRange)rangeOfTimedDataPointsFromTime: (double)startTime toTime: (double)endTime
+{
+    NSUInteger firstIndex = [self indexOfFirstTimedDataPointAtOrAfterTime: startTime];
+    NSUInteger endIndex = [self indexOfFirstTimedDataPointAtOrAfterTime: nextafter(endTime, INFINITY)];
+    return NSMakeRange(firstIndex, MAX(endIndex, firstIndex) - firstIndex);
+}
+
+- (NSUInteger)numberOfTimedDataPoints
+{
+    return _timedCount;
+}
+
+- (double)timeOfTimedDataPointAtIndex: (NSUInteger)index
+{
+    return index < _timedCount ? _timedTimes[_timedStart + index] : NAN;
+}
+
+- (double)valueOfTimedDataPointAtIndex: (NSUInteger)index
+{
+    return index < _timedCount ? _timedValues[_timedStart + index] : NAN;
+}
+
+- (void)resizeTimedDataPointsToCapacity: (NSUInteger)capacity
+{
+    // keep the newest data points, starting at the front of the new buffers
+    NSUInteger count = MIN(_timedCount, capacity);
+    double *times = capacity > 0 ? malloc(2 * capacity * sizeof(double)) : NULL;
+    double *values = capacity > 0 ? malloc(2 * capacity * sizeof(double)) : NULL;
+    if (count > 0)
+    {
+        memcpy(times, _timedTimes + _timedStart + _timedCount - count, count * sizeof(double));
+        memcpy(values, _timedValues + _timedStart + _timedCount - count, count * sizeof(double));
+    }
+    free(_timedTimes);
+    free(_timedValues);
+    _timedTimes = times;
+    _timedValues = values;
+    _timedCapacity = capacity;
+    _timedStart = 0;
+    _timedCount = count;
+}
+
+#pragma mark - Overlay Series methods
+
+- (NSUInteger)addSeriesWithColor: (UIColor*)color lineWidth: (CGFloat)lineWidth style: (UHNPlotSeriesStyle)style capacity: (NSUInteger)capacity
+{
+    // each series gets a slice of twice its capacity at the end of the shared buffers
+    _series = realloc(_series, (_numberOfSeries + 1) * sizeof(UHNPlotSeries));
+    _seriesTimes = realloc(_seriesTimes, (_seriesStorageSize + 2 * capacity) * sizeof(double));
+    _seriesValues = realloc(_seriesValues, (_seriesStorageSize + 2 * capacity) * sizeof(double));
+    
+    UHNPlotSeries *series = &_series[_numberOfSeries];
+    series->offset = _seriesStorageSize;
+    series->capacity = capacity;
+    series->start = 0;
+    series->count = 0;
+    series->color = CGColorRetain([color CGColor]);
+    series->lineWidth = lineWidth;
+    series->style = style;
+    _seriesStorageSize += 2 * capacity;
+    return _numberOfSeries++;
+}
+
+- (void)addValue: (double)value atTime: (double)time toSeries: (NSUInteger)seriesIndex
+{
+    if (seriesIndex >= _numberOfSeries)
+    {
+        return;
+    }
+    UHNPlotSeries *series = &_series[seriesIndex];
+    UHNInsertTimedValue(_seriesTimes + series->offset, _seriesValues + series->offset, series->capacity, &series->start, &series->count, time, value);
+    [self setNeedsPlotUpdate];
+}
+
+- (NSUInteger)numberOfSeries
+{
+    return _numberOfSeries;
+}
+
+- (NSUInteger)numberOfDataPointsInSeries: (NSUInteger)seriesIndex
+{
+    return seriesIndex < _numberOfSeries ? _series[seriesIndex].count : 0;
+}
+
+- (double)timeOfDataPointAtIndex: (NSUInteger)index inSeries: (NSUInteger)seriesIndex
+{
+    if (index >= [self numberOfDataPointsInSeries: seriesIndex])
+    {
+        return NAN;
+    }
+    return _seriesTimes[_series[seriesIndex].offset + _series[seriesIndex].start + index];
+}
+
+- (double)valueOfDataPointAtIndex: (NSUInteger)index inSeries: (NSUInteger)seriesIndex
+{
+    if (index >= [self numberOfDataPointsInSeries: seriesIndex])
+    {
+        return NAN;
+    }
+    return _seriesValues[_series[seriesIndex].offset + _series[seriesIndex].start + index];
+}
+
+- (void)removeAllSeries
+{
+    for (NSUInteger index = 0; index < _numberOfSeries; index++)
+    {
+        CGColorRelease(_series[index].color);
+    }
+    free(_series);
+    free(_seriesTimes);
+    free(_seriesValues);
+    _series = NULL;
+    _seriesTimes = NULL;
+    _seriesValues = NULL;
+    _numberOfSeries = 0;
+    _seriesStorageSize = 0;
+    [self setNeedsDisplay];
+}
+
+- (double)newestTime
+{
+    // the time axis is shared by the time-keyed data points and the overlay series
+    double newestTime = _timedCount > 0 ? _timedTimes[_timedStart + _timedCount - 1] : -INFINITY;
+    for (NSUInteger index = 0; index < _numberOfSeries; index++)
+    {
+        UHNPlotSeries series = _series[index];
+        if (series.count > 0)
+        {
+            newestTime = MAX(newestTime, _seriesTimes[series.offset + series.start + series.count - 1]);
+        }
+    }
+    return isinf(newestTime) ? NAN : newestTime;
+}
+
+#pragma mark - Ploting Methods
+
+- (void)setLineHeadColor:(UIColor *)lineHeadColor
+{
+    _lineHeadColor = lineHeadColor;
+    CGGradientRelease(_lineHeadGradient);
+    _lineHeadGradient = NULL;
+    
+    CGFloat redComponent, greenComponent, blueComponent, alphaComponent;
+    if ([lineHeadColor getRed: &redComponent green: &greenComponent blue: &blueComponent alpha: &alphaComponent])
+    {
+        CGColorSpaceRef myColorspace=CGColorSpaceCreateDeviceRGB();
+        size_t num_locations = 2;
+        CGFloat components[8] = { redComponent, greenComponent, blueComponent, 0.7, redComponent, greenComponent, blueComponent, 0.1};
+        _lineHeadGradient = CGGradientCreateWithColorComponents(myColorspace, components, nil, num_locations);
+        CGColorSpaceRelease(myColorspace);
+    }
+    _lineHeadLayer.contents = (id)[[self lineHeadImage] CGImage];
+}
+
+- (void)setLineColor:(UIColor *)lineColor
+{
+    _lineColor = lineColor;
+    for (CAShapeLayer *tileLayer in _tileLayers)
+    {
+        tileLayer.strokeColor = [lineColor CGColor];
+    }
+}
+
+- (void)setLineWidth:(CGFloat)lineWidth
+{
+    _lineWidth = lineWidth;
+    for (CAShapeLayer *tileLayer in _tileLayers)
+    {
+        tileLayer.lineWidth = lineWidth;
+    }
+}
+
+- (UIImage*)lineHeadImage
+{
+    if (!_lineHeadGradient)
+    {
+        return nil;
+    }
+    CGFloat radius = kUHNPlotLineHeadDiameter / 2.;
+    UIGraphicsBeginImageContextWithOptions(CGSizeMake(kUHNPlotLineHeadDiameter, kUHNPlotLineHeadDiameter), NO, 0);
+    CGContextDrawRadialGradient(UIGraphicsGetCurrentContext(), _lineHeadGradient, CGPointMake(radius, radius), 0, CGPointMake(radius, radius), radius, kCGGradientDrawsBeforeStartLocation);
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
+}
+
+- (void)hidePlot: (BOOL)hidden
+{
+    self.hidden = hidden;
+    self.container.hidden = hidden;
+    self.grid.hidden = hidden;
+    self.yScale.hidden = hidden;
+    self.xScale.hidden = hidden;
+    [self scheduleDisplayLink];
+}
+
+- (void)shouldRefresh: (BOOL)refresh
+{
+    self.isRefreshing = refresh;
+    if (refresh)
+    {
+        [self setNeedsPlotUpdate];
+    }
+    else
+    {
+        [self updatePlot];
+    }
+    
+    self.container.scrollEnabled = !refresh;
+}
+
+- (void)setPlotRefreshRateInHz:(double)plotRefreshRateInHz
+{
+    _plotRefreshRateInHz = plotRefreshRateInHz;
+    [self scheduleDisplayLink];
+}
+
+- (void)setNeedsPlotUpdate
+{
+    self.needsPlotUpdate = YES;
+    [self scheduleDisplayLink];
+}
+
+- (void)didMoveToWindow
+{
+    [super didMoveToWindow];
+    
+    // the display link retains the plot view, so it only exists while the plot is on screen
+    if (!self.window)
+    {
+        [self.displayLink invalidate];
+        self.displayLink = nil;
+    }
+    [self scheduleDisplayLink];
+}
+
+- (void)scheduleDisplayLink
+{
+    BOOL shouldRun = self.needsPlotUpdate && self.window && !self.hidden;
+    if (shouldRun && !self.displayLink)
+    {
+        self.displayLink = [CADisplayLink displayLinkWithTarget: self selector: @selector(displayLinkDidFire:)];
+        [self.displayLink addToRunLoop: [NSRunLoop mainRunLoop] forMode: NSRunLoopCommonModes];
+    }
+    
+    // while refreshing, updates are limited to the plot refresh rate; otherwise they are coalesced to one per frame
+    NSInteger frameInterval = 1;
+    if (self.isRefreshing && self.plotRefreshRateInHz > 0)
+    {
+        frameInterval = MAX(1, lround(60. / self.plotRefreshRateInHz));
+    }
+    self.displayLink.frameInterval = frameInterval;
+    self.displayLink.paused = !shouldRun;
+}
+
+- (void)displayLinkDidFire: (CADisplayLink*)displayLink
+{
+    if (self.needsPlotUpdate)
+    {
+        [self updatePlot];
+    }
+    
+    // nothing changed since the last update, so stop until the next change
+    displayLink.paused = YES;
+}
+
+- (void)updatePlot
+{
+    self.needsPlotUpdate = NO;
+    [self mergePendingDataPoints];
+    
+    // decorations that follow the data, e.g. event markers, scroll with it
+    for (UHNGraphDecoration *decoration in self.decorations)
+    {
+        [decoration layoutInGraph: self];
+    }
+    
+    if (self.cachesRenderedHistory && _timedCount == 0)
+    {
+        [self renderHistory];
+        
+        // the overlay series are still drawn by drawRect:, under the cached main line
+        if (_numberOfSeries > 0)
+        {
+            [self setNeedsDisplay];
+        }
+        return;
+    }
+    
+    if (!self.isRefreshing) 
+    {
+        // trying extending the width at end of collection
+        if ((NSInteger)_samplesCount > self.windowMaxSize) 
+        {
+            NSInteger numberOfOffScreenSamplesToDraw = _samplesCount - self.windowMaxSize;
+            CGFloat xOffset = (self.xOffsetPerSample * numberOfOffScreenSamplesToDraw);
+            CGRect frame = self.frame;
+            frame.size.width = frame.size.width + xOffset;
+            self.frame = frame;
+            self.container.contentSize = self.bounds.size;
+            [self.container setContentOffset: CGPointMake(xOffset, 0) animated: NO];            
+        }
+    }
+    [self setNeedsDisplay];
+}
+
+- (void)removeAllDataPoints
+{
+    _samplesStart = 0;
+    _samplesCount = 0;
+    _totalNumberOfDataPoints = 0;
+    [_decimationPyramid resetWithStartIndex: 0];
+    _timedStart = 0;
+    _timedCount = 0;
+    for (NSUInteger index = 0; index < _numberOfSeries; index++)
+    {
+        _series[index].start = 0;
+        _series[index].count = 0;
+    }
+    pthread_mutex_lock(&_pendingLock);
+    _pendingCount = 0;
+    pthread_mutex_unlock(&_pendingLock);
+    [self invalidateRenderedHistory];
+    [self renderHistory];
+    self.container.contentSize = self.bounds.size;
+    [self.container setContentOffset: CGPointMake(0, 0) animated: NO];
+    [self setNeedsDisplay];
+}
+
+- (void) drawRect : (CGRect) rect
+{
+    [super drawRect : rect];
+    CGContextRef context = UIGraphicsGetCurrentContext ();
+    if (_timedCount > 0)
+    {
+        [self drawTimedDataPointsInContext: context];
+        return;
+    }
+    
+    if (_samplesCount > 1 && !self.cachesRenderedHistory) {
+        CGContextSetLineWidth (context, self.lineWidth);
+        CGContextSetStrokeColorWithColor(context, [self.lineColor CGColor]);
+        CGPathRef path = [self newPathForDataPoints];
+        CGPoint lineHead = CGPathGetCurrentPoint(path);
+        CGContextAddPath(context, path);
+        CGContextStrokePath(context);
+        CGPathRelease(path);
+        
+        // draw line head with radial gradient
+        if (_lineHeadGradient)
+        {
+            CGContextDrawRadialGradient(context, _lineHeadGradient, lineHead, 0, lineHead, 10, kCGGradientDrawsBeforeStartLocation);
+        }
+    }
+    else
+    {
+        CGContextSetFillColorWithColor(context, [[UIColor clearColor] CGColor]);
+        CGContextFillRect(context, rect);
+    }
+    
+    // the data points added by index have no time, so the overlay series are drawn on their own time axis, with their newest data point at the right edge like the newest sample
+    [self drawOverlaySeriesInContext: context];
+}
+
+- (CGPathRef)newPathForDataPoints
+{
+    CGMutablePathRef path = CGPathCreateMutable();
+    NSInteger numberOfDataPoints = _samplesCount;
+    if (numberOfDataPoints < 1)
+    {
+        return path;
+    }
+    
+    // the ring buffer never holds more than the window, so all of its data points are drawn
+    NSInteger indexCounter = 0;
+    
+    // hoist the scale out of the loop and walk the ring buffer directly
+    CGFloat yOrigin = self.bounds.origin.y + self.yOffsetForZeroLine;
+    CGFloat yOffsetPerUnit = self.yOffsetPerUnit;
+    CGFloat xOffsetPerSample = self.xOffsetPerSample;
+    CGFloat xEnd = self.bounds.size.width - 20;
+    NSUInteger sampleIndex = (_samplesStart + indexCounter) % _samplesCapacity;
+    BOOL isFirstPoint = YES;
+    
+    // when several data points fall in one pixel column, draw the min/max of the coarsest fitting level instead
+    NSUInteger level = 0;
+    if (xOffsetPerSample > 0)
+    {
+        level = [_decimationPyramid levelForDataPointsPerPixel: 1. / (xOffsetPerSample * self.contentScaleFactor)];
+    }
+    if (level > 0)
+    {
+        NSUInteger firstIndex = _totalNumberOfDataPoints - numberOfDataPoints + indexCounter;
+        NSUInteger firstBucket = (firstIndex + (1 << level) - 1) >> level;
+        NSUInteger lastBucket = (_totalNumberOfDataPoints - 1) >> level;
+        for (NSUInteger bucket = firstBucket; bucket <= lastBucket; bucket++)
+        {
+            UHNMinMax minMax = [_decimationPyramid minMaxOfBucket: bucket atLevel: level];
+            CGFloat xValue = xEnd - (xOffsetPerSample * (_totalNumberOfDataPoints - (bucket << level)));
+            if (isFirstPoint)
+            {
+                CGPathMoveToPoint(path, NULL, xValue, yOrigin - (yOffsetPerUnit * minMax.minimum));
+                isFirstPoint = NO;
+            }
+            else
+            {
+                CGPathAddLineToPoint(path, NULL, xValue, yOrigin - (yOffsetPerUnit * minMax.minimum));
+            }
+            CGPathAddLineToPoint(path, NULL, xValue, yOrigin - (yOffsetPerUnit * minMax.maximum));
+        }
+        
+        // finish the line at the newest data point, where the line head is drawn
+        indexCounter = numberOfDataPoints - 1;
+        sampleIndex = (_samplesStart + indexCounter) % _samplesCapacity;
+    }
+    
+    for (; indexCounter < numberOfDataPoints; indexCounter++) 
+    {
+        CGFloat xValue = xEnd - (xOffsetPerSample * (numberOfDataPoints - indexCounter));
+        CGFloat yValue = yOrigin - (yOffsetPerUnit * _samples[sampleIndex]);
+        if (++sampleIndex == _samplesCapacity)
+        {
+            sampleIndex = 0;
+        }
+        
+        if (isFirstPoint)
+        {
+            CGPathMoveToPoint(path, NULL, xValue, yValue);
+            isFirstPoint = NO;
+        }
+        else
+        {
+            CGPathAddLineToPoint(path, NULL, xValue, yValue);
+        }
+    }
+    return path;
+}
+
+- (CGFloat)xOffsetPerTimeUnit
+{
+    // map time to screen through the x-axis
+    double xRange = [self.xScale.max doubleValue] - [self.xScale.min doubleValue];
+    if (xRange <= 0)
+    {
+        return 0;
+    }
+    return ([self.xScale screenValueForDomain: self.xScale.max] - [self.xScale screenValueForDomain: self.xScale.min]) / xRange;
+}
+
+- (CGFloat)screenValueForTime: (double)time
+{
+    CGFloat xOffsetPerUnit = [self xOffsetPerTimeUnit];
+    double newestTime = [self newestTime];
+    if (isnan(newestTime) || xOffsetPerUnit <= 0)
+    {
+        return NAN;
+    }
+    return self.bounds.size.width - 20 - (xOffsetPerUnit * (newestTime - time));
+}
+
+- (void)drawTimedDataPointsInContext: (CGContextRef)context
+{
+    // one pass over the scales is shared by the main line and the overlay series, with the newest data point at the right edge
+    CGFloat xOffsetPerUnit = [self xOffsetPerTimeUnit];
+    double newestTime = [self newestTime];
+    if (xOffsetPerUnit <= 0 || isnan(newestTime))
+    {
+        return;
+    }
+    CGFloat xEnd = self.bounds.size.width - 20;
+    double oldestVisibleTime = newestTime - xEnd / xOffsetPerUnit;
+    
+    if (_timedCount > 0)
+    {
+        CGPoint lineHead = [self drawTimes: _timedTimes + _timedStart
+                                    values: _timedValues + _timedStart
+                                     count: _timedCount
+                                 lineColor: [self.lineColor CGColor]
+                                 lineWidth: self.lineWidth
+                                     style: UHNPlotSeriesStyleLine
+                         oldestVisibleTime: oldestVisibleTime
+                                newestTime: newestTime
+                            xOffsetPerUnit: xOffsetPerUnit
+                                 inContext: context];
+        if (_lineHeadGradient && !isnan(lineHead.x))
+        {
+            CGContextDrawRadialGradient(context, _lineHeadGradient, lineHead, 0, lineHead, 10, kCGGradientDrawsBeforeStartLocation);
+        }
+    }
+    [self drawOverlaySeriesInContext: context];
+}
+
+- (void)drawOverlaySeriesInContext: (CGContextRef)context
+{
+    CGFloat xOffsetPerUnit = [self xOffsetPerTimeUnit];
+    double newestTime = [self newestTime];
+    if (xOffsetPerUnit <= 0 || isnan(newestTime))
+    {
+        return;
+    }
+    double oldestVisibleTime = newestTime - (self.bounds.size.width - 20) / xOffsetPerUnit;
+    
+    for (NSUInteger index = 0; index < _numberOfSeries; index++)
+    {
+        UHNPlotSeries series = _series[index];
+        [self drawTimes: _seriesTimes + series.offset + series.start
+                 values: _seriesValues + series.offset + series.start
+                  count: series.count
+              lineColor: series.color
+              lineWidth: series.lineWidth
+                  style: series.style
+      oldestVisibleTime: oldestVisibleTime
+             newestTime: newestTime
+         xOffsetPerUnit: xOffsetPerUnit
+              inContext: context];
+    }
+}
+
+- (CGPoint)drawTimes: (const double*)times
+              values: (const double*)values
+               count: (NSUInteger)count
+           lineColor: (CGColorRef)lineColor
+           lineWidth: (CGFloat)lineWidth
+               style: (UHNPlotSeriesStyle)style
+   oldestVisibleTime: (double)oldestVisibleTime
+          newestTime: (double)newestTime
+      xOffsetPerUnit: (CGFloat)xOffsetPerUnit
+           inContext: (CGContextRef)context
+{
+    // only the visible slice is touched, plus the data point before it so the line enters from the left edge
+    NSUInteger index = UHNIndexOfFirstTimeAtOrAfter(times, count, oldestVisibleTime);
+    if (index > 0)
+    {
+        index--;
+    }
+    
+    CGContextSetLineWidth (context, lineWidth);
+    CGContextSetStrokeColorWithColor(context, lineColor);
+    CGFloat xEnd = self.bounds.size.width - 20;
+    CGFloat yOrigin = self.bounds.origin.y + self.yOffsetForZeroLine;
+    CGFloat yOffsetPerUnit = self.yOffsetPerUnit;
+    CGPoint currentPoint = CGPointMake(NAN, NAN);
+    double previousTime = NAN;
+    for (; index < count; index++)
+    {
+        double time = times[index];
+        currentPoint.x = xEnd - (xOffsetPerUnit * (newestTime - time));
+        currentPoint.y = yOrigin - (yOffsetPerUnit * values[index]);
+        
+        if (style == UHNPlotSeriesStylePoints)
+        {
+            CGContextAddEllipseInRect(context, CGRectMake(currentPoint.x - kUHNPlotSeriesPointDiameter / 2, currentPoint.y - kUHNPlotSeriesPointDiameter / 2, kUHNPlotSeriesPointDiameter, kUHNPlotSeriesPointDiameter));
+        }
+        else if (isnan(previousTime) || (self.maximumTimeGap > 0 && time - previousTime > self.maximumTimeGap))
+        {
+            // break the line where data is missing instead of bridging the gap
+            CGContextMoveToPoint(context, currentPoint.x, currentPoint.y);
+        }
+        else
+        {
+            CGContextAddLineToPoint(context, currentPoint.x, currentPoint.y);
+        }
+        previousTime = time;
+    }
+    
+    if (style == UHNPlotSeriesStylePoints)
+    {
+        CGContextSetFillColorWithColor(context, lineColor);
+        CGContextDrawPath(context, kCGPathFillStroke);
+    }
+    else
+    {
+        CGContextStrokePath(context);
+    }
+    return currentPoint;
+}
+
+#pragma mark - Cached Rendering Methods
+
+- (void)setCachesRenderedHistory:(BOOL)cachesRenderedHistory
+{
+    if (_cachesRenderedHistory == cachesRenderedHistory)
+    {
+        return;
+    }
+    _cachesRenderedHistory = cachesRenderedHistory;
+    
+    if (cachesRenderedHistory)
+    {
+        _historyLayer = [CALayer layer];
+        _historyLayer.anchorPoint = CGPointZero;
+        _lineHeadLayer = [CALayer layer];
+        _lineHeadLayer.bounds = CGRectMake(0, 0, kUHNPlotLineHeadDiameter, kUHNPlotLineHeadDiameter);
+        _lineHeadLayer.contents = (id)[[self lineHeadImage] CGImage];
+        _tileLayers = [NSMutableArray array];
+        _reusableTileLayers = [NSMutableArray array];
+        self.clipsToBounds = YES;
+        [self.layer addSublayer: _historyLayer];
+        [self.layer addSublayer: _lineHeadLayer];
+        [self invalidateRenderedHistory];
+        [self renderHistory];
+    }
+    else
+    {
+        [_historyLayer removeFromSuperlayer];
+        [_lineHeadLayer removeFromSuperlayer];
+        _historyLayer = nil;
+        _lineHeadLayer = nil;
+        _tileLayers = nil;
+        _reusableTileLayers = nil;
+    }
+    [self setNeedsDisplay];
+}
+
+- (void)invalidateRenderedHistory
+{
+    for (CAShapeLayer *tileLayer in _tileLayers)
+    {
+        [tileLayer removeFromSuperlayer];
+        [_reusableTileLayers addObject: tileLayer];
+    }
+    [_tileLayers removeAllObjects];
+    _renderedNumberOfDataPoints = 0;
+}
+
+- (void)renderHistory
+{
+    if (!_historyLayer)
+    {
+        return;
+    }
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions: YES];
+    
+    _historyLayer.bounds = self.layer.bounds;
+    
+    NSUInteger oldestIndex = _totalNumberOfDataPoints - _samplesCount;
+    if (_samplesCount < 2)
+    {
+        [self invalidateRenderedHistory];
+        _lineHeadLayer.hidden = YES;
+        [CATransaction commit];
+        return;
+    }
+    
+    // drop the tiles that have scrolled out of the stored window
+    NSUInteger oldestTileIndex = oldestIndex / kUHNPlotSegmentsPerTile;
+    while (_tileLayers.count && _firstTileIndex < oldestTileIndex)
+    {
+        CAShapeLayer *tileLayer = _tileLayers[0];
+        [tileLayer removeFromSuperlayer];
+        [_reusableTileLayers addObject: tileLayer];
+        [_tileLayers removeObjectAtIndex: 0];
+        _firstTileIndex++;
+    }
+    if (!_tileLayers.count)
+    {
+        _firstTileIndex = oldestTileIndex;
+        _renderedNumberOfDataPoints = 0;
+    }
+    
+    // only the tile that was still open at the last render and the tiles after it are (re)built
+    NSUInteger newestTileIndex = (_totalNumberOfDataPoints - 2) / kUHNPlotSegmentsPerTile;
+    NSUInteger tileIndex = _firstTileIndex;
+    if (_renderedNumberOfDataPoints > 1)
+    {
+        tileIndex = MAX(tileIndex, (_renderedNumberOfDataPoints - 2) / kUHNPlotSegmentsPerTile);
+    }
+    for (; tileIndex <= newestTileIndex; tileIndex++)
+    {
+        NSUInteger arrayIndex = tileIndex - _firstTileIndex;
+        CAShapeLayer *tileLayer = arrayIndex < _tileLayers.count ? _tileLayers[arrayIndex] : [self dequeueTileLayer];
+        CGPathRef path = [self newPathForTileAtIndex: tileIndex oldestIndex: oldestIndex];
+        tileLayer.path = path;
+        CGPathRelease(path);
+    }
+    _renderedNumberOfDataPoints = _totalNumberOfDataPoints;
+    
+    // scroll the history so the newest data point is at the right edge
+    CGFloat xEnd = self.bounds.size.width - 20;
+    _historyLayer.position = CGPointMake(xEnd - self.xOffsetPerSample * _totalNumberOfDataPoints, 0);
+    
+    double newestValue = [self valueAtIndex: _samplesCount - 1];
+    _lineHeadLayer.hidden = NO;
+    _lineHeadLayer.position = CGPointMake(xEnd - self.xOffsetPerSample, self.bounds.origin.y + self.yOffsetForZeroLine - (self.yOffsetPerUnit * newestValue));
+    
+    [CATransaction commit];
+}
+
+- (CAShapeLayer*)dequeueTileLayer
+{
+    CAShapeLayer *tileLayer = [_reusableTileLayers lastObject];
+    if (tileLayer)
+    {
+        [_reusableTileLayers removeLastObject];
+    }
+    else
+    {
+        tileLayer = [CAShapeLayer layer];
+        tileLayer.fillColor = nil;
+        tileLayer.lineJoin = kCALineJoinRound;
+    }
+    tileLayer.strokeColor = [self.lineColor CGColor];
+    tileLayer.lineWidth = self.lineWidth;
+    [_tileLayers addObject: tileLayer];
+    [_historyLayer addSublayer: tileLayer];
+    return tileLayer;
+}
+
+- (CGPathRef)newPathForTileAtIndex: (NSUInteger)tileIndex oldestIndex: (NSUInteger)oldestIndex CF_RETURNS_RETAINED
+{
+    // a tile holds the segments starting at its data points, so neighbouring tiles share their end points
+    NSUInteger firstIndex = MAX(tileIndex * kUHNPlotSegmentsPerTile, oldestIndex);
+    NSUInteger lastIndex = MIN((tileIndex + 1) * kUHNPlotSegmentsPerTile, _totalNumberOfDataPoints - 1);
+    
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGFloat yOrigin = self.bounds.origin.y + self.yOffsetForZeroLine;
+    for (NSUInteger index = firstIndex; index <= lastIndex; index++)
+    {
+        CGFloat xValue = self.xOffsetPerSample * index;
+        CGFloat yValue = yOrigin - (self.yOffsetPerUnit * [self valueAtIndex: index - oldestIndex]);
+        if (index == firstIndex)
+        {
+            CGPathMoveToPoint(path, NULL, xValue, yValue);
+        }
+        else
+        {
+            CGPathAddLineToPoint(path, NULL, xValue, yValue);
+        }
+    }
+    return path;
+}
+
+#pragma mark - UIScrollView Delegate Methods
+
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView
+{
+}
+
+@end
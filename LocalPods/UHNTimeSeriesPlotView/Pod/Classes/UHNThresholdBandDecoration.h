@@ -0,0 +1,58 @@
+//
+//  UHNThresholdBandDecoration.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import "UHNGraphDecoration.h"
+
+/**
+ `UHNThresholdBandDecoration` shades horizontal bands of the y-axis, e.g. the glucose ranges outside the alert levels of a CGM sensor. All the bands of a decoration share one color and are drawn as a single path by a shape layer.
+ 
+ The path is only rebuilt when the bands, the y-axis range or the size of the graph change, so laying out the decoration with every plot update is cheap. Use one decoration per color.
+ */
+@interface UHNThresholdBandDecoration : UHNGraphDecoration
+
+/**
+ The fill color of the bands. Default is red with an alpha of 0.2
+ */
+@property (nonatomic, strong) UIColor *bandColor;
+
+/**
+ Add a band
+ 
+ @param lowValue The lower value of the band, in the units of the y-axis
+ @param highValue The upper value of the band, in the units of the y-axis
+ */
+- (void)addBandFromValue: (double)lowValue toValue: (double)highValue;
+
+/**
+ Remove all the bands
+ */
+- (void)removeAllBands;
+
+/**
+ The number of bands
+ */
+@property (nonatomic, readonly) NSUInteger numberOfBands;
+
+@end
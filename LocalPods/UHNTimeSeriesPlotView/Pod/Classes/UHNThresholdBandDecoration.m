@@ -0,0 +1,120 @@
+//
+//  UHNThresholdBandDecoration.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNThresholdBandDecoration.h"
+#import "UHNGraphView.h"
+#import "UHNYRealScale.h"
+#import <QuartzCore/QuartzCore.h>
+
+typedef struct UHNBand {
+    double lowValue;
+    double highValue;
+} UHNBand;
+
+@interface UHNThresholdBandDecoration ()
+{
+    UHNBand *_bands;
+    NSUInteger _bandsCapacity;
+    
+    // the geometry is built for this y-axis range and size
+    double _layoutMin;
+    double _layoutMax;
+    CGSize _layoutSize;
+    BOOL _needsPathUpdate;
+}
+@property (nonatomic, readwrite) NSUInteger numberOfBands;
+@end
+
+@implementation UHNThresholdBandDecoration
+
+#pragma mark - Lifecycle Methods
+
++ (Class)layerClass
+{
+    return [CAShapeLayer class];
+}
+
+- (instancetype)initWithFrame:(CGRect)frame
+{
+    if (self = [super initWithFrame: frame])
+    {
+        self.userInteractionEnabled = NO;
+        self.backgroundColor = [UIColor clearColor];
+        self.bandColor = [[UIColor redColor] colorWithAlphaComponent: 0.2];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_bands);
+}
+
+#pragma mark - Band Methods
+
+- (void)setBandColor:(UIColor *)bandColor
+{
+    _bandColor = bandColor;
+    ((CAShapeLayer*)self.layer).fillColor = [bandColor CGColor];
+}
+
+- (void)addBandFromValue: (double)lowValue toValue: (double)highValue
+{
+    if (self.numberOfBands == _bandsCapacity)
+    {
+        _bandsCapacity = MAX(2 * _bandsCapacity, 4);
+        _bands = realloc(_bands, _bandsCapacity * sizeof(UHNBand));
+    }
+    _bands[self.numberOfBands].lowValue = MIN(lowValue, highValue);
+    _bands[self.numberOfBands].highValue = MAX(lowValue, highValue);
+    self.numberOfBands++;
+    _needsPathUpdate = YES;
+}
+
+- (void)removeAllBands
+{
+    self.numberOfBands = 0;
+    _needsPathUpdate = YES;
+}
+
+#pragma mark - Layout Methods
+
+- (void)layoutInGraph: (UHNGraphView *)graph
+{
+    self.frame = graph.bounds;
+    
+    double min = [graph.yScale.min doubleValue];
+    double max = [graph.yScale.max doubleValue];
+    if (!_needsPathUpdate && min == _layoutMin && max == _layoutMax && CGSizeEqualToSize(graph.bounds.size, _layoutSize))
+    {
+        return;
+    }
+    _layoutMin = min;
+    _layoutMax = max;
+    _layoutSize = graph.bounds.size;
+    _needsPathUpdate = NO;
+    
+    CGMutablePathRef path = CGPathCreateMutable();
+    for (NSUInteger index = 0; index < self.numberOfBands; index++)
+    {
+        CGFloat top = [graph.yScale screenValueForDomain: @(MIN(_bands[index].highValue, max))];
+        CGFloat bottom = [graph.yScale screenValueForDomain: @(MAX(_bands[index].lowValue, min))];
+        if (bottom > top)
+        {
+            CGPathAddRect(path, NULL, CGRectMake(0, top, _layoutSize.width, bottom - top));
+        }
+    }
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions: YES];
+    ((CAShapeLayer*)self.layer).path = path;
+    [CATransaction commit];
+    CGPathRelease(path);
+}
+
+@end
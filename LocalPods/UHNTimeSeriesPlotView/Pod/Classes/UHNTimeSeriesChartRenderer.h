@@ -0,0 +1,161 @@
+//
+//  UHNTimeSeriesChartRenderer.h
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <UIKit/UIKit.h>
+
+@class UHNChartSeries;
+
+/**
+ `UHNTimeSeriesChartRenderer` draws charts of time series into images or PDF pages without a view hierarchy, for example for daily summary reports.
+ 
+ The axes are laid out with the same `UHNScaleLayout` as `UHNXRealScale` and `UHNYRealScale`. The grid lines are stroked from `newGridPathForAxis:key:step:length:`, which follows the placement of `UHNGraphGridLines` but does not share its drawing code, so the two must be kept in step. Line series with more data points than pixel columns are decimated to the minimum and maximum of each pixel column, so long histories render in time proportional to their length without drawing a segment per data point.
+ 
+ Rendering only uses the renderer and the series passed in, so it can run on any thread. The asynchronous methods render a copy of the renderer on a background queue, so the renderer can be changed while they run, and batches render their charts concurrently.
+ */
+@interface UHNTimeSeriesChartRenderer : NSObject <NSCopying>
+
+///-----------------------------
+/// @name Chart Size
+///-----------------------------
+
+/**
+ The size of the chart in points, including the axes. Defaults to 640 x 320.
+ */
+@property (nonatomic, assign) CGSize size;
+
+/**
+ The scale of the rendered images. Defaults to 2.
+ */
+@property (nonatomic, assign) CGFloat contentScale;
+
+/**
+ The width of the y axis to the left of the plot area. Defaults to 40.
+ */
+@property (nonatomic, assign) CGFloat yAxisWidth;
+
+/**
+ The height of the x axis below the plot area. Defaults to 20.
+ */
+@property (nonatomic, assign) CGFloat xAxisHeight;
+
+/**
+ The background color of the chart, or nil for a transparent background. Defaults to white.
+ */
+@property (nonatomic, strong) UIColor *backgroundColor;
+
+///-----------------------------
+/// @name Axes
+///-----------------------------
+
+@property (nonatomic, assign) double xAxisMin;
+@property (nonatomic, assign) double xAxisMax;
+@property (nonatomic, assign) double xMinorStep;
+@property (nonatomic, assign) double xMajorStep;
+@property (nonatomic, copy) NSString *xAxisLabel;
+@property (nonatomic, copy) NSString *xAxisFormatString;
+
+@property (nonatomic, assign) double yAxisMin;
+@property (nonatomic, assign) double yAxisMax;
+@property (nonatomic, assign) double yMinorStep;
+@property (nonatomic, assign) double yMajorStep;
+@property (nonatomic, copy) NSString *yAxisLabel;
+@property (nonatomic, copy) NSString *yAxisFormatString;
+
+/**
+ The color of the tick marks. Defaults to dark gray.
+ */
+@property (nonatomic, strong) UIColor *tickColor;
+
+///-----------------------------
+/// @name Grid
+///-----------------------------
+
+/**
+ The color of the grid frame. The grid lines are drawn in this color at 0.8 alpha, as `setupPlotWithXAxisMin:...` sets up the grid of the plot view. Defaults to light gray.
+ */
+@property (nonatomic, strong) UIColor *gridColor;
+@property (nonatomic, assign) BOOL drawsGridFrame;
+@property (nonatomic, assign) CGFloat gridFrameWidth;
+@property (nonatomic, assign) CGFloat xMinorScaleLineWidth;
+@property (nonatomic, assign) CGFloat xMajorScaleLineWidth;
+@property (nonatomic, assign) CGFloat yMinorScaleLineWidth;
+@property (nonatomic, assign) CGFloat yMajorScaleLineWidth;
+
+///-----------------------------
+/// @name Rendering
+///-----------------------------
+
+/**
+ Draw a chart into a context, such as a bitmap or PDF context, with the chart's origin at the origin of the context
+ 
+ @param series The series to draw, from back to front
+ @param context The context to draw in
+ */
+- (void)drawSeries: (NSArray*)series inContext: (CGContextRef)context;
+
+/**
+ Create the path a line series is stroked along, decimated to the minimum and maximum of each pixel column if it has more than two data points per column
+ 
+ @param series The line series
+ 
+ @return The path in the coordinates of the chart, which the caller must release
+ */
+- (CGPathRef)newPathForLine: (UHNChartSeries*)series;
+
+/**
+ Render a chart into an image
+ 
+ @param series The series to draw, from back to front
+ 
+ @return The image
+ */
+- (UIImage*)imageWithSeries: (NSArray*)series;
+
+/**
+ Render charts into a PDF document, one chart per page
+ 
+ @param pages The series of each page
+ 
+ @return The PDF document
+ */
+- (NSData*)PDFDataWithPages: (NSArray*)pages;
+
+/**
+ Render charts into images concurrently on background queues
+ 
+ @param charts The series of each chart
+ @param completion Called on the main queue with the images, in the order of the charts
+ */
+- (void)renderImagesWithCharts: (NSArray*)charts completion: (void (^)(NSArray *images))completion;
+
+/**
+ Render charts into a PDF document on a background queue
+ 
+ @param pages The series of each page
+ @param completion Called on the main queue with the PDF document
+ */
+- (void)renderPDFDataWithPages: (NSArray*)pages completion: (void (^)(NSData *data))completion;
+
+@end
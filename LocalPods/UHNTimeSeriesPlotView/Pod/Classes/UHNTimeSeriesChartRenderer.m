@@ -0,0 +1,388 @@
+//
+//  UHNTimeSeriesChartRenderer.m
+//  UHNTimeSeriesPlotView
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNTimeSeriesChartRenderer.h"
+#import "UHNChartSeries.h"
+#import "UHNScaleLayout.h"
+
+@implementation UHNTimeSeriesChartRenderer
+
+#pragma mark - Lifecycle Methods
+
+- (instancetype)init
+{
+    if (self = [super init])
+    {
+        self.size = CGSizeMake(640, 320);
+        self.contentScale = 2;
+        self.yAxisWidth = 40;
+        self.xAxisHeight = 20;
+        self.backgroundColor = [UIColor whiteColor];
+        self.xAxisMax = 1;
+        self.yAxisMax = 1;
+        self.xAxisFormatString = @"%.0f";
+        self.yAxisFormatString = @"%.0f";
+        self.tickColor = [UIColor darkGrayColor];
+        self.gridColor = [UIColor lightGrayColor];
+        self.gridFrameWidth = 1;
+        self.xMinorScaleLineWidth = 1;
+        self.xMajorScaleLineWidth = 3;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    UHNTimeSeriesChartRenderer *copy = [[[self class] allocWithZone: zone] init];
+    copy.size = self.size;
+    copy.contentScale = self.contentScale;
+    copy.yAxisWidth = self.yAxisWidth;
+    copy.xAxisHeight = self.xAxisHeight;
+    copy.backgroundColor = self.backgroundColor;
+    copy.xAxisMin = self.xAxisMin;
+    copy.xAxisMax = self.xAxisMax;
+    copy.xMinorStep = self.xMinorStep;
+    copy.xMajorStep = self.xMajorStep;
+    copy.xAxisLabel = self.xAxisLabel;
+    copy.xAxisFormatString = self.xAxisFormatString;
+    copy.yAxisMin = self.yAxisMin;
+    copy.yAxisMax = self.yAxisMax;
+    copy.yMinorStep = self.yMinorStep;
+    copy.yMajorStep = self.yMajorStep;
+    copy.yAxisLabel = self.yAxisLabel;
+    copy.yAxisFormatString = self.yAxisFormatString;
+    copy.tickColor = self.tickColor;
+    copy.gridColor = self.gridColor;
+    copy.drawsGridFrame = self.drawsGridFrame;
+    copy.gridFrameWidth = self.gridFrameWidth;
+    copy.xMinorScaleLineWidth = self.xMinorScaleLineWidth;
+    copy.xMajorScaleLineWidth = self.xMajorScaleLineWidth;
+    copy.yMinorScaleLineWidth = self.yMinorScaleLineWidth;
+    copy.yMajorScaleLineWidth = self.yMajorScaleLineWidth;
+    return copy;
+}
+
+#pragma mark - Layout Methods
+
+- (CGRect)plotRect
+{
+    return CGRectMake(self.yAxisWidth, 0, MAX(self.size.width - self.yAxisWidth, 0), MAX(self.size.height - self.xAxisHeight, 0));
+}
+
+- (UHNScaleLayoutKey)xScaleKey
+{
+    UHNScaleLayoutKey key = {0};
+    key.min = self.xAxisMin;
+    key.max = self.xAxisMax;
+    key.minorStep = self.xMinorStep;
+    key.majorStep = self.xMajorStep;
+    key.size = CGSizeMake([self plotRect].size.width, self.xAxisHeight);
+    key.contentScale = self.contentScale;
+    return key;
+}
+
+- (UHNScaleLayoutKey)yScaleKey
+{
+    UHNScaleLayoutKey key = {0};
+    key.min = self.yAxisMin;
+    key.max = self.yAxisMax;
+    key.minorStep = self.yMinorStep;
+    key.majorStep = self.yMajorStep;
+    key.size = CGSizeMake(self.yAxisWidth, [self plotRect].size.height);
+    key.contentScale = self.contentScale;
+    return key;
+}
+
+#pragma mark - Drawing Methods
+
+- (void)drawSeries: (NSArray*)series inContext: (CGContextRef)context
+{
+    if (self.xAxisMax <= self.xAxisMin || self.yAxisMax <= self.yAxisMin)
+    {
+        return;
+    }
+    CGRect plotRect = [self plotRect];
+    UHNScaleLayoutKey xKey = [self xScaleKey];
+    UHNScaleLayoutKey yKey = [self yScaleKey];
+    
+    CGContextSaveGState(context);
+    if (self.backgroundColor)
+    {
+        CGContextSetFillColorWithColor(context, [self.backgroundColor CGColor]);
+        CGContextFillRect(context, CGRectMake(0, 0, self.size.width, self.size.height));
+    }
+    
+    // grid
+    CGContextSaveGState(context);
+    CGContextTranslateCTM(context, plotRect.origin.x, plotRect.origin.y);
+    CGContextSetStrokeColorWithColor(context, [[self.gridColor colorWithAlphaComponent: 0.8] CGColor]);
+    [self strokeGridForAxis: UHNScaleLayoutAxisX key: xKey step: self.xMinorStep lineWidth: self.xMinorScaleLineWidth length: plotRect.size.height inContext: context];
+    [self strokeGridForAxis: UHNScaleLayoutAxisX key: xKey step: self.xMajorStep lineWidth: self.xMajorScaleLineWidth length: plotRect.size.height inContext: context];
+    [self strokeGridForAxis: UHNScaleLayoutAxisY key: yKey step: self.yMinorStep lineWidth: self.yMinorScaleLineWidth length: plotRect.size.width inContext: context];
+    [self strokeGridForAxis: UHNScaleLayoutAxisY key: yKey step: self.yMajorStep lineWidth: self.yMajorScaleLineWidth length: plotRect.size.width inContext: context];
+    CGContextRestoreGState(context);
+    if (self.drawsGridFrame)
+    {
+        CGContextSetLineWidth(context, self.gridFrameWidth);
+        CGContextSetStrokeColorWithColor(context, [self.gridColor CGColor]);
+        CGContextStrokeRect(context, plotRect);
+    }
+    
+    // series, clipped to the plot area
+    CGContextSaveGState(context);
+    CGContextClipToRect(context, plotRect);
+    for (UHNChartSeries *aSeries in series)
+    {
+        if (aSeries.style == UHNChartSeriesStyleBand)
+        {
+            [self fillBand: aSeries xKey: xKey yKey: yKey origin: plotRect.origin inContext: context];
+        }
+        else
+        {
+            [self strokeLine: aSeries xKey: xKey yKey: yKey origin: plotRect.origin inContext: context];
+        }
+    }
+    CGContextRestoreGState(context);
+    
+    // axes
+    CGContextSaveGState(context);
+    [[UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: yKey formatString: self.yAxisFormatString units: self.yAxisLabel] drawInContext: context tickColor: self.tickColor tickWidth: 2.0];
+    CGContextTranslateCTM(context, plotRect.origin.x, CGRectGetMaxY(plotRect));
+    [[UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisX key: xKey formatString: self.xAxisFormatString units: self.xAxisLabel] drawInContext: context tickColor: self.tickColor tickWidth: 2.0];
+    CGContextRestoreGState(context);
+    
+    CGContextRestoreGState(context);
+}
+
+- (void)strokeGridForAxis: (UHNScaleLayoutAxis)axis key: (UHNScaleLayoutKey)key step: (double)step lineWidth: (CGFloat)lineWidth length: (CGFloat)length inContext: (CGContextRef)context
+{
+    if (lineWidth <= 0 || step <= 0)
+    {
+        return;
+    }
+    CGPathRef path = [UHNScaleLayout newGridPathForAxis: axis key: key step: step length: length];
+    CGContextSetLineWidth(context, lineWidth);
+    CGContextAddPath(context, path);
+    CGContextStrokePath(context);
+    CGPathRelease(path);
+}
+
+- (void)strokeLine: (UHNChartSeries*)series xKey: (UHNScaleLayoutKey)xKey yKey: (UHNScaleLayoutKey)yKey origin: (CGPoint)origin inContext: (CGContextRef)context
+{
+    CGPathRef path = [self newPathForLine: series xKey: xKey yKey: yKey origin: origin];
+    CGContextSetStrokeColorWithColor(context, [series.color CGColor]);
+    CGContextSetLineWidth(context, series.lineWidth);
+    CGContextSetLineJoin(context, kCGLineJoinRound);
+    CGContextAddPath(context, path);
+    CGContextStrokePath(context);
+    CGPathRelease(path);
+}
+
+- (CGPathRef)newPathForLine: (UHNChartSeries*)series
+{
+    CGRect plotRect = [self plotRect];
+    return [self newPathForLine: series xKey: [self xScaleKey] yKey: [self yScaleKey] origin: plotRect.origin];
+}
+
+- (CGPathRef)newPathForLine: (UHNChartSeries*)series xKey: (UHNScaleLayoutKey)xKey yKey: (UHNScaleLayoutKey)yKey origin: (CGPoint)origin
+{
+    const double *times = series.times;
+    const double *values = series.values;
+    double maximumTimeGap = series.maximumTimeGap;
+    NSUInteger count = series.count;
+    
+    // only the data points on the x axis are drawn, plus one on either side so the line enters and leaves the plot area
+    NSUInteger first = 0;
+    while (first + 1 < count && times[first + 1] < xKey.min)
+    {
+        first++;
+    }
+    NSUInteger last = count;
+    while (last > first + 1 && times[last - 2] > xKey.max)
+    {
+        last--;
+    }
+    
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGFloat pixelColumns = xKey.size.width * xKey.contentScale;
+    if (last - first > 2 * pixelColumns)
+    {
+        // decimate to the minimum and maximum of each pixel column
+        NSInteger column = NSIntegerMin;
+        double minimum = 0, maximum = 0;
+        BOOL startsSegment = YES;
+        for (NSUInteger index = first; index <= last; index++)
+        {
+            NSInteger dataPointColumn = (index < last) ? (NSInteger)floor(UHNScaleLayoutPosition(xKey, UHNScaleLayoutAxisX, times[index]) * xKey.contentScale) : NSIntegerMax;
+            BOOL isGap = (index < last && index > first && maximumTimeGap > 0 && times[index] - times[index - 1] > maximumTimeGap);
+            if ((dataPointColumn != column || isGap) && column != NSIntegerMin)
+            {
+                CGFloat x = origin.x + (column + 0.5) / xKey.contentScale;
+                CGFloat yMinimum = origin.y + UHNScaleLayoutPosition(yKey, UHNScaleLayoutAxisY, minimum);
+                CGFloat yMaximum = origin.y + UHNScaleLayoutPosition(yKey, UHNScaleLayoutAxisY, maximum);
+                if (startsSegment)
+                {
+                    CGPathMoveToPoint(path, NULL, x, yMinimum);
+                    startsSegment = NO;
+                }
+                else
+                {
+                    CGPathAddLineToPoint(path, NULL, x, yMinimum);
+                }
+                CGPathAddLineToPoint(path, NULL, x, yMaximum);
+                column = NSIntegerMin;
+            }
+            if (index == last)
+            {
+                break;
+            }
+            if (isGap)
+            {
+                startsSegment = YES;
+            }
+            if (column == NSIntegerMin)
+            {
+                column = dataPointColumn;
+                minimum = maximum = values[index];
+            }
+            else
+            {
+                minimum = MIN(minimum, values[index]);
+                maximum = MAX(maximum, values[index]);
+            }
+        }
+    }
+    else
+    {
+        for (NSUInteger index = first; index < last; index++)
+        {
+            CGFloat x = origin.x + UHNScaleLayoutPosition(xKey, UHNScaleLayoutAxisX, times[index]);
+            CGFloat y = origin.y + UHNScaleLayoutPosition(yKey, UHNScaleLayoutAxisY, values[index]);
+            if (index == first || (maximumTimeGap > 0 && times[index] - times[index - 1] > maximumTimeGap))
+            {
+                CGPathMoveToPoint(path, NULL, x, y);
+            }
+            else
+            {
+                CGPathAddLineToPoint(path, NULL, x, y);
+            }
+        }
+    }
+    return path;
+}
+
+- (void)fillBand: (UHNChartSeries*)series xKey: (UHNScaleLayoutKey)xKey yKey: (UHNScaleLayoutKey)yKey origin: (CGPoint)origin inContext: (CGContextRef)context
+{
+    const double *times = series.times;
+    const double *lowValues = series.values;
+    const double *highValues = series.highValues;
+    double maximumTimeGap = series.maximumTimeGap;
+    NSUInteger count = series.count;
+    
+    // each run of data points without a gap is one polygon, along the high values and back along the low values
+    CGMutablePathRef path = CGPathCreateMutable();
+    NSUInteger start = 0;
+    for (NSUInteger index = 1; index <= count; index++)
+    {
+        if (index < count && !(maximumTimeGap > 0 && times[index] - times[index - 1] > maximumTimeGap))
+        {
+            continue;
+        }
+        for (NSUInteger forward = start; forward < index; forward++)
+        {
+            CGFloat x = origin.x + UHNScaleLayoutPosition(xKey, UHNScaleLayoutAxisX, times[forward]);
+            CGFloat y = origin.y + UHNScaleLayoutPosition(yKey, UHNScaleLayoutAxisY, highValues[forward]);
+            if (forward == start)
+            {
+                CGPathMoveToPoint(path, NULL, x, y);
+            }
+            else
+            {
+                CGPathAddLineToPoint(path, NULL, x, y);
+            }
+        }
+        for (NSUInteger backward = index; backward > start; backward--)
+        {
+            CGFloat x = origin.x + UHNScaleLayoutPosition(xKey, UHNScaleLayoutAxisX, times[backward - 1]);
+            CGFloat y = origin.y + UHNScaleLayoutPosition(yKey, UHNScaleLayoutAxisY, lowValues[backward - 1]);
+            CGPathAddLineToPoint(path, NULL, x, y);
+        }
+        CGPathCloseSubpath(path);
+        start = index;
+    }
+    
+    CGContextSetFillColorWithColor(context, [series.color CGColor]);
+    CGContextAddPath(context, path);
+    CGContextFillPath(context);
+    CGPathRelease(path);
+}
+
+#pragma mark - Rendering Methods
+
+- (UIImage*)imageWithSeries: (NSArray*)series
+{
+    BOOL opaque = (self.backgroundColor && CGColorGetAlpha([self.backgroundColor CGColor]) == 1);
+    UIGraphicsBeginImageContextWithOptions(self.size, opaque, self.contentScale);
+    [self drawSeries: series inContext: UIGraphicsGetCurrentContext()];
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
+}
+
+- (NSData*)PDFDataWithPages: (NSArray*)pages
+{
+    NSMutableData *data = [NSMutableData data];
+    UIGraphicsBeginPDFContextToData(data, CGRectMake(0, 0, self.size.width, self.size.height), nil);
+    for (NSArray *series in pages)
+    {
+        UIGraphicsBeginPDFPage();
+        [self drawSeries: series inContext: UIGraphicsGetCurrentContext()];
+    }
+    UIGraphicsEndPDFContext();
+    return data;
+}
+
+- (void)renderImagesWithCharts: (NSArray*)charts completion: (void (^)(NSArray *images))completion
+{
+    UHNTimeSeriesChartRenderer *renderer = [self copy];
+    NSArray *chartsCopy = [charts copy];
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSMutableArray *images = [NSMutableArray arrayWithCapacity: chartsCopy.count];
+        for (NSUInteger index = 0; index < chartsCopy.count; index++)
+        {
+            [images addObject: [NSNull null]];
+        }
+        
+        // the axis layouts are shared through their cache, so each chart only draws its series and the cached labels
+        dispatch_apply(chartsCopy.count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+            UIImage *image = [renderer imageWithSeries: chartsCopy[index]];
+            @synchronized(images)
+            {
+                images[index] = image ?: [NSNull null];
+            }
+        });
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(images);
+        });
+    });
+}
+
+- (void)renderPDFDataWithPages: (NSArray*)pages completion: (void (^)(NSData *data))completion
+{
+    UHNTimeSeriesChartRenderer *renderer = [self copy];
+    NSArray *pagesCopy = [pages copy];
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSData *data = [renderer PDFDataWithPages: pagesCopy];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(data);
+        });
+    });
+}
+
+@end
@@ -0,0 +1,18 @@
+//
+//  UHNTimeSeriesPlotView.h
+//  Pods
+//
+//  Created by Nathaniel Hamming on 2015-02-12.
+//
+//
+
+#import "UHNScrollingTimeSeriesPlotView.h"
+#import "UHNGraphGridLines.h"
+#import "UHNXRealScale.h"
+#import "UHNYRealScale.h"
+#import "UHNScaleLayout.h"
+#import "UHNChartSeries.h"
+#import "UHNTimeSeriesChartRenderer.h"
+#import "UHNDecimationPyramid.h"
+#import "UHNThresholdBandDecoration.h"
+#import "UHNEventMarkerDecoration.h"
\ No newline at end of file
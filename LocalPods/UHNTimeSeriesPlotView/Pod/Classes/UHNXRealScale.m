@@ -0,0 +1,63 @@
+//
+//  UHNXRealScale.m
+//  Bant
+//
+//  Created by Mat Trudel on 09-10-05.
+//  Copyright 2015 University Health Network. All rights reserved.
+//
+
+#import "UHNXRealScale.h"
+#import "UHNScaleLayout.h"
+
+@interface UHNXRealScale ()
+@property(nonatomic,strong) UHNScaleLayout *layout;
+@end
+
+@implementation UHNXRealScale
+@synthesize min, max, minorStep, majorStep;
+@synthesize units;
+@synthesize formatString;
+@synthesize tickColor;
+
+- (void)drawRect:(CGRect)rect {
+	CGContextRef context = UIGraphicsGetCurrentContext();
+    [[self currentLayout] drawInContext: context tickColor: [UIColor colorWithWhite: 0.17 alpha: 1] tickWidth: 2.0];
+}
+
+#pragma mark - Layout methods
+
+- (UHNScaleLayout*)currentLayout {
+    UHNScaleLayoutKey key = {0};
+    key.min = [self.min doubleValue];
+    key.max = [self.max doubleValue];
+    key.minorStep = [self.minorStep doubleValue];
+    key.majorStep = [self.majorStep doubleValue];
+    key.size = self.bounds.size;
+    key.contentScale = self.contentScaleFactor;
+    if ([self.layout matchesKey: key formatString: self.formatString units: self.units]) {
+        return self.layout;
+    }
+    
+    // reuse a layout built for the same range and size, otherwise lay out the labels and ticks once
+    self.layout = [UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisX key: key formatString: self.formatString units: self.units];
+    return self.layout;
+}
+
+- (CGFloat)screenValueForDomain: (id)domainValue {
+	return self.bounds.origin.x + super.bounds.size.width * ([domainValue floatValue] - [self.min floatValue]) / ([self.max floatValue] - [self.min floatValue]);
+}
+
+- (id)domainValueForScreen: (CGFloat)screenValue {
+	return [NSNumber numberWithFloat: [self.min floatValue] + ([self.max floatValue] - [self.min floatValue])*((screenValue - self.bounds.origin.x) / self.bounds.size.width)];	
+}
+
+
+- (id)valueByAdding: (id)delta to: (id)original {
+	return [NSNumber numberWithFloat: [original floatValue] + [delta floatValue]];
+}
+
+- (NSComparisonResult)compare: (id)a to: (id)b {
+	return [a compare: b];
+}
+
+@end
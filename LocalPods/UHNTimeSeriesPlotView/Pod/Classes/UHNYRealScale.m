@@ -0,0 +1,68 @@
+//
+//  UHNYRealScale.m
+//  Bant
+//
+//  Created by Mat Trudel on 09-10-05.
+//  Copyright 2015 University Health Network. All rights reserved.
+//
+
+#import "UHNYRealScale.h"
+#import "UHNScaleLayout.h"
+
+@interface UHNYRealScale ()
+@property(nonatomic,strong) UHNScaleLayout *layout;
+@end
+
+@implementation UHNYRealScale
+@synthesize min, max, minorStep, majorStep;
+@synthesize units;
+@synthesize formatString;
+@synthesize tickColor;
+
+- (void)drawRect:(CGRect)rect {
+    if (!self.formatString) 
+    {
+        self.formatString = @"%f";
+    }
+    
+    CGContextRef context = UIGraphicsGetCurrentContext();
+    UIColor *color = self.tickColor ? self.tickColor : [UIColor colorWithWhite: 0.17 alpha: 1];
+    [[self currentLayout] drawInContext: context tickColor: color tickWidth: 2.0];
+}
+
+#pragma mark - Layout methods
+
+- (UHNScaleLayout*)currentLayout {
+    UHNScaleLayoutKey key = {0};
+    key.min = [self.min doubleValue];
+    key.max = [self.max doubleValue];
+    key.minorStep = [self.minorStep doubleValue];
+    key.majorStep = [self.majorStep doubleValue];
+    key.size = self.bounds.size;
+    key.contentScale = self.contentScaleFactor;
+    if ([self.layout matchesKey: key formatString: self.formatString units: self.units]) {
+        return self.layout;
+    }
+    
+    // reuse a layout built for the same range and size, otherwise lay out the labels and ticks once
+    self.layout = [UHNScaleLayout layoutForAxis: UHNScaleLayoutAxisY key: key formatString: self.formatString units: self.units];
+    return self.layout;
+}
+
+- (CGFloat)screenValueForDomain: (id)domainValue {
+    return self.bounds.size.height - super.bounds.size.height * ([domainValue floatValue] - [self.min floatValue]) / ([self.max floatValue] - [self.min floatValue]);
+}
+
+- (id)domainValueForScreen: (CGFloat)screenValue {
+	return [NSNumber numberWithFloat: [self.max floatValue] - ([self.max floatValue] - [self.min floatValue])*((screenValue - self.bounds.origin.y) / self.bounds.size.height)];	
+}
+
+- (id)valueByAdding: (id)delta to: (id)original {
+	return [NSNumber numberWithFloat: [original floatValue] + [delta floatValue]];
+}
+
+- (NSComparisonResult)compare: (id)a to: (id)b {
+	return [a compare: b];
+}
+
+@end
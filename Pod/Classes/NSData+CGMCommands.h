@@ -26,6 +26,86 @@
 #import <Foundation/Foundation.h>
 #import "UHNCGMConstants.h"
 
+///---------------------
+/// @name SFLOAT Values
+///---------------------
+/**
+ Encode a float as an SFLOAT. The exponent is chosen for the most precision that fits the 12 bit mantissa, trailing decimal zeros of fractional values are dropped, and the mantissa is rounded half away from zero. NaN and the infinities are encoded as the SFLOAT special values, as are values too large to represent, and values too small to represent are encoded as 0.
+ 
+ @param value The value to encode
+ 
+ @return The SFLOAT, in host byte order
+ */
+uint16_t CGMSFloatFromFloat(float value);
+
+/**
+ Decode an SFLOAT, including its special values. NRes and the reserved value are decoded as NaN.
+ 
+ @param sfloat The SFLOAT, in host byte order
+ 
+ @return The value
+ */
+float CGMFloatFromSFloat(uint16_t sfloat);
+
+/**
+ Pack the `shortFloat` bitfield struct from `UHNBLETypes.h` as an SFLOAT, independent of how the compiler lays out the bitfields
+ 
+ @param value The short float
+ 
+ @return The SFLOAT, in host byte order
+ */
+uint16_t CGMSFloatFromShortFloat(shortFloat value);
+
+/**
+ Calculate the E2E-CRC of octets
+ 
+ @param bytes The octets
+ @param length The number of octets
+ 
+ @return The CRC-CCITT seeded with `kCGMCRCSeed`
+ */
+uint16_t CGMCRC(const uint8_t *bytes, NSUInteger length);
+
+///----------------------
+/// @name Command Builder
+///----------------------
+/**
+ A CGMCP command built in a fixed-size buffer, which is usually on the stack, so a command is only copied once into the `NSData` that is written to the sensor. Multi-octet fields are written in little endian byte order.
+ */
+typedef struct CGMCommandBuffer {
+    uint8_t bytes[kCGMCPCommandMaxLength];
+    NSUInteger length;
+} CGMCommandBuffer;
+
+static inline void CGMCommandBegin(CGMCommandBuffer *command, uint8_t opCode)
+{
+    command->bytes[0] = opCode;
+    command->length = 1;
+}
+
+static inline void CGMCommandAppendUInt8(CGMCommandBuffer *command, uint8_t value)
+{
+    NSCAssert(command->length + 1 <= kCGMCPCommandMaxLength, @"CGMCP command is too long");
+    command->bytes[command->length++] = value;
+}
+
+static inline void CGMCommandAppendUInt16(CGMCommandBuffer *command, uint16_t value)
+{
+    NSCAssert(command->length + 2 <= kCGMCPCommandMaxLength, @"CGMCP command is too long");
+    command->bytes[command->length++] = value & 0xFF;
+    command->bytes[command->length++] = value >> 8;
+}
+
+static inline void CGMCommandAppendSFloat(CGMCommandBuffer *command, float value)
+{
+    CGMCommandAppendUInt16(command, CGMSFloatFromFloat(value));
+}
+
+static inline void CGMCommandAppendCRC(CGMCommandBuffer *command)
+{
+    CGMCommandAppendUInt16(command, CGMCRC(command->bytes, command->length));
+}
+
 /**
  `NSData+CGMCommands` constructs CGM commands or values in `NSDate` format to be sent is a CGM sensor
  */
@@ -51,4 +131,26 @@
 + (NSData*)joinFluidType: (GlucoseFluidTypeOption)type
           sampleLocation: (GlucoseSampleLocationOption)location;
 
+/**
+ Command consisting of an op code only. These commands are immutable, so they are built once and the same object is returned for every call
+ 
+ @param opCode The op code of the command
+ @param crcPresent YES if the E2E-CRC is appended
+ 
+ @returns The command in NSData format
+ 
+ */
++ (NSData*)cgmCommandWithOpCode: (CGMCPOpCode)opCode
+                     crcPresent: (BOOL)crcPresent;
+
+/**
+ Copies a built command
+ 
+ @param command The command
+ 
+ @returns The command in NSData format
+ 
+ */
++ (NSData*)dataWithCGMCommand: (const CGMCommandBuffer*)command;
+
 @end
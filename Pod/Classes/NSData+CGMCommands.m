@@ -8,6 +8,85 @@
 
 #import "NSData+CGMCommands.h"
 
+// commands consisting of an op code only, without and with the E2E-CRC
+#define kCGMCPOpCodeCount       (CGMCPOpCodeResponse + 1)
+static NSData *opCodeCommands[2][kCGMCPOpCodeCount];
+
+#pragma mark - SFLOAT Values
+
+uint16_t CGMSFloatFromFloat(float value)
+{
+    if (isnan(value)) {
+        return kSFloatNaN;
+    }
+    if (isinf(value)) {
+        return value > 0 ? kSFloatPositiveInfinity : kSFloatNegativeInfinity;
+    }
+    
+    // the smallest exponent whose rounded mantissa fits gives the most precision
+    double magnitude = fabs((double)value);
+    for (int exponent = kSFloatExponentMin; exponent <= kSFloatExponentMax; exponent++) {
+        double mantissa = round(magnitude / pow(10., exponent));
+        if (mantissa == 0.) {
+            continue;
+        }
+        // with an exponent of 0 the largest mantissas are the special values
+        double mantissaMax = (exponent == 0) ? kSFloatPositiveInfinity - 1 : kSFloatMantissaMax;
+        if (mantissa > mantissaMax) {
+            continue;
+        }
+        
+        NSInteger signedMantissa = (value < 0) ? -(NSInteger)mantissa : (NSInteger)mantissa;
+        while (exponent < 0 && signedMantissa % 10 == 0) {
+            signedMantissa /= 10;
+            exponent++;
+        }
+        return (uint16_t)(((exponent & 0x0F) << 12) | (signedMantissa & 0x0FFF));
+    }
+    
+    // too small rounds to 0, too large is infinite
+    if (magnitude < kSFloatMantissaMax * pow(10., kSFloatExponentMax)) {
+        return 0;
+    }
+    return value > 0 ? kSFloatPositiveInfinity : kSFloatNegativeInfinity;
+}
+
+float CGMFloatFromSFloat(uint16_t sfloat)
+{
+    switch (sfloat) {
+        case kSFloatPositiveInfinity:
+            return INFINITY;
+        case kSFloatNegativeInfinity:
+            return -INFINITY;
+        case kSFloatNaN:
+        case kSFloatNRes:
+        case kSFloatReserved:
+            return NAN;
+    }
+    
+    // sign extend the 4 bit exponent and the 12 bit mantissa
+    int exponent = (int16_t)sfloat >> 12;
+    int mantissa = (int16_t)(sfloat << 4) >> 4;
+    return (float)(mantissa * pow(10., exponent));
+}
+
+uint16_t CGMSFloatFromShortFloat(shortFloat value)
+{
+    return (uint16_t)(((value.exponent & 0x0F) << 12) | (value.mantissa & 0x0FFF));
+}
+
+uint16_t CGMCRC(const uint8_t *bytes, NSUInteger length)
+{
+    uint16_t crc = kCGMCRCSeed;
+    for (NSUInteger index = 0; index < length; index++) {
+        crc ^= (uint16_t)bytes[index] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ kCGMCRCPolynomial) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
 @implementation NSData (CGMCommands)
 
 + (NSData*)cgmCurrentTimeValue;
@@ -38,9 +117,10 @@
         dtsOffsetValue = DSTStandardTime;
     }
     
-    NSInteger secFromGMT = [localTimeZone secondsFromGMT];
+    // the time zone is the standard offset from UTC, as the daylight saving time is sent separately
+    NSInteger secFromGMT = [localTimeZone secondsFromGMT] - daylightOffset;
     float hourFromGMT = secFromGMT / kSecondsInHour;
-    uint8_t timeZoneValue = hourFromGMT * kCGMTimeZoneStepSizeMin60;
+    uint8_t timeZoneValue = (int8_t)lroundf(hourFromGMT * kCGMTimeZoneStepSizeMin60);
 
     char cgmCurrentTimeBytes[] = {year, (year >> 8), month, day, hour, minute, second, timeZoneValue, dtsOffsetValue};
     NSData *cgmCurrentTimeValue = [NSData dataWithBytes:cgmCurrentTimeBytes length:sizeof(cgmCurrentTimeBytes)];
@@ -55,5 +135,25 @@
     return [NSData dataWithBytes:&typeLocation length:sizeof(uint8_t)];
 }
 
++ (NSData*)cgmCommandWithOpCode:(CGMCPOpCode)opCode
+                     crcPresent:(BOOL)crcPresent;
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (uint8_t code = 0; code < kCGMCPOpCodeCount; code++) {
+            CGMCommandBuffer command;
+            CGMCommandBegin(&command, code);
+            opCodeCommands[0][code] = [NSData dataWithCGMCommand:&command];
+            CGMCommandAppendCRC(&command);
+            opCodeCommands[1][code] = [NSData dataWithCGMCommand:&command];
+        }
+    });
+    return opCodeCommands[crcPresent ? 1 : 0][opCode];
+}
+
++ (NSData*)dataWithCGMCommand:(const CGMCommandBuffer*)command;
+{
+    return [NSData dataWithBytes:command->bytes length:command->length];
+}
 
 @end
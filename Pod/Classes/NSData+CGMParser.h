@@ -38,6 +38,8 @@
  
  @return  All the data of the measurement characteristic minus the flags, size, and E2E-CRC (if present). Keys and enumerations are defined in the CGMConstants.h file, which is imported with this category.
  
+ @discussion The dictionary is a `UHNCGMMeasurementDetails` backed by the measurement bytes, which decodes each field when it is looked up.
+ 
  @discussion Here are the defined keys:
  
     kCGMMeasurementKeyGlucoseConcentration:    Glucose concentration in mg/dl. Stored as NSNumber.
@@ -130,6 +132,16 @@
  */
 - (NSDate*)parseSessionStartTime: (BOOL)crcPresent;
 
+/**
+ Session start time as seconds since 1970, calculated with integer math without a calendar or time zone object
+ 
+ @param crcPresent crcPresent Indicates whether the characteristic includes the E2E-CRC field
+ 
+ @return The CGM session start time in seconds since 1970, or `kCGMEpochTimeUnknown` if the session start time is not known
+ 
+ */
+- (int64_t)parseSessionStartEpochTime: (BOOL)crcPresent;
+
 
 
 /** 
@@ -7,6 +7,7 @@
 //
 
 #import "NSData+CGMParser.h"
+#import "UHNCGMMeasurementDetails.h"
 #import "NSData+ConversionExtensions.h"
 #import "UHNDebug.h"
 
@@ -25,80 +26,8 @@
 
 - (NSDictionary*)parseMeasurementCharacteristicDetails:(BOOL)crcPresent;
 {
-    // TODO add CRC checking
-    BOOL crcFailed = NO;
-    
-//    NSUInteger charSize = [self parseMeasurementCharacteristicSize];
-    NSUInteger flags = [self parseMeasurementCharacteristicFlags];
-    NSNumber *glucoseConcentration = [self parseGlucoseConcentration];
-    NSUInteger timeOffset = [self parseMeasurementTimeOffest];
-    NSMutableDictionary *measurementDetails = [NSMutableDictionary dictionaryWithObjectsAndKeys: glucoseConcentration, kCGMMeasurementKeyGlucoseConcentration, @(timeOffset), kCGMKeyTimeOffset, nil];
-    NSUInteger currentByteIndex = kCGMMeasurementFieldRangeTimeOffset.location + kCGMMeasurementFieldRangeTimeOffset.length;
-    
-    NSDictionary *measurementStatusDict = [self parseStatusStartByte: currentByteIndex
-                                                 warningOctetPresent: (flags & CGMMeasurementFlagsWarningOctetPresent)
-                                                 calTempOctetPresent: (flags & CGMMeasurementFlagsCalTempOctetPresent)
-                                                  statusOctetPresent: (flags & CGMMeasurementFlagsStatusOctetPresent)];
-    if (measurementStatusDict && [measurementStatusDict count] != 0) {
-        measurementDetails[kCGMStatusKeySensorStatus] = measurementStatusDict;
-    }
-
-    currentByteIndex += ((flags & CGMMeasurementFlagsWarningOctetPresent) != NO) + ((flags & CGMMeasurementFlagsCalTempOctetPresent) != NO) + ((flags & CGMMeasurementFlagsStatusOctetPresent) != NO);
-    if (flags & CGMMeasurementFlagsTrendInformationPresent) {
-        NSNumber *trendInfo = [self parseMeasurementTrendInformation:currentByteIndex];
-        measurementDetails[kCGMMeasurementKeyTrendInfo] = trendInfo;
-        currentByteIndex += kCGMMeasurementFieldSizeTrendInfo;
-    }
-    
-    if (flags & CGMMeasurementFlagsQualityPresent) {
-        NSNumber *measurementQuality = [self parseMeasurementQuality:currentByteIndex];
-        measurementDetails[kCGMMeasurementKeyQuality] = measurementQuality;
-        currentByteIndex += kCGMMeasurementFieldSizeQuality;
-    }
-    
-    
-    //TODO update CRC calculation
-    if (crcPresent) {
-        measurementDetails[kCGMCRCFailed] = @(crcFailed);
-    }
-    
-    return measurementDetails;
-}
-
-- (NSUInteger)parseMeasurementCharacteristicSize;
-{
-    return [self unsignedIntegerAtRange:kCGMMeasurementFieldRangeSize];
-}
-
-- (NSUInteger)parseMeasurementCharacteristicFlags;
-{
-    return [self unsignedIntegerAtRange:kCGMMeasurementFieldRangeFlags];
-}
-
-- (NSNumber*)parseGlucoseConcentration;
-{
-    float glucoseConcentration = [self shortFloatAtRange:kCGMMeasurementFieldRangeGlucoseConcentration];
-    return @(glucoseConcentration);
-}
-
-- (NSUInteger)parseMeasurementTimeOffest;
-{
-    return [self unsignedIntegerAtRange:kCGMMeasurementFieldRangeTimeOffset];
-}
-
-- (NSNumber*)parseMeasurementTrendInformation:(NSUInteger)startByte;
-{
-    NSRange trendRange = {startByte, 2};
-    float trend = [self shortFloatAtRange:trendRange];
-    
-    return @(trend);
-}
-- (NSNumber*)parseMeasurementQuality:(NSUInteger)startByte;
-{
-    NSRange qualityRange = {startByte, 2};
-    float quality = [self shortFloatAtRange:qualityRange];
-    
-    return @(quality);
+    // the fields are decoded when looked up
+    return [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:self crcPresent:crcPresent];
 }
 
 #pragma mark - CGM Feature Characteristic
@@ -191,50 +120,53 @@
 #pragma mark - CGM Session Start Time
 
 - (NSDate*)parseSessionStartTime:(BOOL)crcPresent;
+{
+    int64_t epochTime = [self parseSessionStartEpochTime:crcPresent];
+    if (epochTime == kCGMEpochTimeUnknown) {
+        return nil;
+    }
+    return [NSDate dateWithTimeIntervalSince1970:epochTime];
+}
+
+- (int64_t)parseSessionStartEpochTime:(BOOL)crcPresent;
 {
     // TODO add CRC checking
     
-    NSUInteger year = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeYear];
-    NSUInteger month = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeMonth];
-    NSUInteger day = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeDay];
+    NSInteger year = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeYear];
+    NSInteger month = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeMonth];
+    NSInteger day = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeDay];
     
     if (year == 0 || month == 0 || day == 0) {
         // Session start time is not known
-        return nil;
+        return kCGMEpochTimeUnknown;
     }
     
-    NSUInteger hours = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeHour];
-    NSUInteger minutes = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeMinute];
-    NSUInteger seconds = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeSecond];
-    NSTimeInterval timeZoneOffsetInHours = [self integerAtRange:kCGMSessionStartTimeFieldRangeTimeZone] / kCGMTimeZoneStepSizeMin60;
-    NSTimeZone *timeZone = [NSTimeZone timeZoneForSecondsFromGMT:(timeZoneOffsetInHours * kSecondsInHour)];
+    NSInteger hours = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeHour];
+    NSInteger minutes = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeMinute];
+    NSInteger seconds = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeSecond];
+    NSInteger timeZoneOffsetInSeconds = [self integerAtRange:kCGMSessionStartTimeFieldRangeTimeZone] * kCGMTimeZoneStepSizeSeconds;
     NSInteger dstOffsetCode = [self unsignedIntegerAtRange:kCGMSessionStartTimeFieldRangeDSTOffset];
     
-    NSTimeInterval dstOffsetInSeconds = 0.;
-    if ((dstOffsetCode == DSTStandardTime) && ([timeZone daylightSavingTimeOffset] == 0)) {
-        dstOffsetInSeconds = [timeZone daylightSavingTimeOffset];
-    } else if ((dstOffsetCode == DSTPlusHourHalf) && ([timeZone daylightSavingTimeOffset] != (kSecondsInHour / 2.))) {
-        dstOffsetInSeconds = [timeZone daylightSavingTimeOffset] - (kSecondsInHour / 2.);
-    } else if ((dstOffsetCode == DSTPlusHourOne) && ([timeZone daylightSavingTimeOffset] != kSecondsInHour)) {
-        dstOffsetInSeconds = [timeZone daylightSavingTimeOffset] - kSecondsInHour;
-    } else if ((dstOffsetCode == DSTPlusHoursTwo) && ([timeZone daylightSavingTimeOffset] != (kSecondsInHour * 2))) {
-        dstOffsetInSeconds = [timeZone daylightSavingTimeOffset] - (kSecondsInHour * 2);
+    // the local time is ahead of UTC by the time zone offset plus the DST offset, so both are subtracted from it
+    NSInteger dstOffsetInSeconds = 0;
+    if (dstOffsetCode == DSTPlusHourHalf) {
+        dstOffsetInSeconds = 30 * kCGMSecondsInMinute;
+    } else if (dstOffsetCode == DSTPlusHourOne) {
+        dstOffsetInSeconds = 60 * kCGMSecondsInMinute;
+    } else if (dstOffsetCode == DSTPlusHoursTwo) {
+        dstOffsetInSeconds = 120 * kCGMSecondsInMinute;
     }
     
-    NSCalendar *calendar = [NSCalendar currentCalendar];
-    NSDateComponents *components = [[NSDateComponents alloc] init];
-    [components setCalendar:calendar];
-    [components setYear:year];
-    [components setMonth:month];
-    [components setDay:day];
-    [components setHour:hours];
-    [components setMinute:minutes];
-    [components setSecond:seconds - dstOffsetInSeconds];
-    [components setTimeZone:timeZone];
-    
-    NSDate *sessionStartTime = [calendar dateFromComponents:components];
+    // days since 1970-01-01 in the proleptic Gregorian calendar, counting years from March so the leap day is last
+    NSInteger marchYear = (month <= 2) ? year - 1 : year;
+    NSInteger era = marchYear / 400;
+    NSInteger yearOfEra = marchYear - era * 400;
+    NSInteger dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    NSInteger dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int64_t days = (int64_t)era * 146097 + dayOfEra - 719468;
     
-    return sessionStartTime;
+    int64_t localSeconds = days * kCGMSecondsInDay + hours * 3600 + minutes * kCGMSecondsInMinute + seconds;
+    return localSeconds - timeZoneOffsetInSeconds - dstOffsetInSeconds;
 }
 
 #pragma mark - CGM Session Run Time
@@ -83,6 +83,36 @@
  */
 - (NSNumber*)trendValue;
 
+/**
+ Checks the measurement characteristic details for the glucose trend value derived by the `UHNCGMController` from the recent measurements
+ 
+ @return The derived glucose trend value. Units is (mg/dl)/min
+ 
+ @discussion If not enough measurements were received to derive a trend value, returns `nil`
+ 
+ */
+- (NSNumber*)derivedTrendValue;
+
+/**
+ Checks the measurement characteristic details for the rate of change of the glucose concentration
+ 
+ @return The trend value reported by the sensor, if available, otherwise the derived trend value. Units is (mg/dl)/min
+ 
+ @discussion If neither trend value is available, returns `nil`
+ 
+ */
+- (NSNumber*)rateOfChange;
+
+/**
+ Checks the measurement characteristic details for the glucose trend arrow
+ 
+ @return The trend arrow classified from the rate of change
+ 
+ @discussion If the rate of change is not available, returns `CGMTrendArrowUnknown`
+ 
+ */
+- (CGMTrendArrowOption)trendArrow;
+
 /**
  Checks the measurement characteristic details for the glucose quality value
  
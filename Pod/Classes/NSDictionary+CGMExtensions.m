@@ -40,6 +40,22 @@
     return self[kCGMMeasurementKeyTrendInfo];
 }
 
+- (NSNumber*)derivedTrendValue;
+{
+    return self[kCGMMeasurementKeyDerivedTrendInfo];
+}
+
+- (NSNumber*)rateOfChange;
+{
+    NSNumber *trendValue = [self trendValue];
+    return (trendValue ? trendValue : [self derivedTrendValue]);
+}
+
+- (CGMTrendArrowOption)trendArrow;
+{
+    return [self[kCGMMeasurementKeyTrendArrow] unsignedIntegerValue];
+}
+
 - (NSNumber*)qualityValue;
 {
     return self[kCGMMeasurementKeyQuality];
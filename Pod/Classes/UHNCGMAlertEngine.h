@@ -0,0 +1,183 @@
+//
+//  UHNCGMAlertEngine.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+///-------------------------------
+/// @name Alert Engine Definitions
+///-------------------------------
+/**
+ Default alert thresholds used until the alert levels have been read from the CGM sensor. Glucose levels are in mg/dl and rates in (mg/dl)/min.
+ */
+#define kCGMAlertDefaultLevelHypo                   54.
+#define kCGMAlertDefaultLevelPatientLow             70.
+#define kCGMAlertDefaultLevelPatientHigh            250.
+#define kCGMAlertDefaultLevelHyper                  400.
+#define kCGMAlertDefaultLevelRateDecrease           3.
+#define kCGMAlertDefaultLevelRateIncrease           3.
+
+/**
+ Default number of minutes the glucose concentration is projected ahead for the predicted low alert
+ */
+#define kCGMAlertDefaultPredictionInMinutes         20
+
+/**
+ Default hysteresis margins. An active alert is only cleared once the glucose concentration (mg/dl) or rate of change ((mg/dl)/min) has moved back past the threshold by the margin
+ */
+#define kCGMAlertDefaultGlucoseHysteresis           5.
+#define kCGMAlertDefaultRateHysteresis              0.5
+
+/**
+ Age in seconds beyond which a measurement is treated as a historical record and is not evaluated, even if it is the newest measurement received
+ */
+#define kCGMAlertLiveMeasurementMaximumAge          (15 * 60)
+
+/**
+ All possible host-side alerts with their assigned bit position
+ */
+typedef NS_OPTIONS (uint8_t, CGMAlertOption) {
+    /** Alert indicating that the glucose concentration is below the hypo level */
+    CGMAlertHypo                = (1 << 0),
+    /** Alert indicating that the glucose concentration is below the patient low level */
+    CGMAlertPatientLow          = (1 << 1),
+    /** Alert indicating that the glucose concentration is above the patient high level */
+    CGMAlertPatientHigh         = (1 << 2),
+    /** Alert indicating that the glucose concentration is above the hyper level */
+    CGMAlertHyper               = (1 << 3),
+    /** Alert indicating that the glucose concentration is decreasing faster than the rate decrease level */
+    CGMAlertRateDecrease        = (1 << 4),
+    /** Alert indicating that the glucose concentration is increasing faster than the rate increase level */
+    CGMAlertRateIncrease        = (1 << 5),
+    /** Alert indicating that the glucose concentration is projected to fall below the hypo level within the prediction time */
+    CGMAlertPredictedHypo       = (1 << 6),
+};
+
+#define kCGMAlertNumberOfAlerts                     7
+#define kCGMAlertAll                                ((CGMAlertOption)((1 << kCGMAlertNumberOfAlerts) - 1))
+
+/**
+ `UHNCGMAlertEngine` evaluates glucose alerts on the host, independent of the alerts supported by the CGM sensor. Each evaluation is O(1), so alerts are raised while the measurement is being processed.
+
+ An alert is raised once when its condition starts and cleared once the condition has ended, with hysteresis so readings around a threshold do not toggle the alert. A snoozed alert is not raised again until the snooze expires.
+
+ @discussion The `UHNCGMController` evaluates every live measurement, but not the stored records reported during a RACP procedure, and updates the thresholds with the alert levels read from the CGM sensor.
+
+ */
+@interface UHNCGMAlertEngine : NSObject
+
+///--------------------------
+/// @name Alert Configuration
+///--------------------------
+
+/**
+ The alerts that are evaluated. Default is `kCGMAlertAll`
+ */
+@property(nonatomic,assign) CGMAlertOption enabledAlerts;
+
+/**
+ The hypo level (mg/dl). Default is `kCGMAlertDefaultLevelHypo`
+ */
+@property(nonatomic,assign) float levelHypo;
+
+/**
+ The patient low level (mg/dl). Default is `kCGMAlertDefaultLevelPatientLow`
+ */
+@property(nonatomic,assign) float levelPatientLow;
+
+/**
+ The patient high level (mg/dl). Default is `kCGMAlertDefaultLevelPatientHigh`
+ */
+@property(nonatomic,assign) float levelPatientHigh;
+
+/**
+ The hyper level (mg/dl). Default is `kCGMAlertDefaultLevelHyper`
+ */
+@property(nonatomic,assign) float levelHyper;
+
+/**
+ The rate decrease level as a positive rate ((mg/dl)/min). Default is `kCGMAlertDefaultLevelRateDecrease`
+ */
+@property(nonatomic,assign) float levelRateDecrease;
+
+/**
+ The rate increase level ((mg/dl)/min). Default is `kCGMAlertDefaultLevelRateIncrease`
+ */
+@property(nonatomic,assign) float levelRateIncrease;
+
+/**
+ Number of minutes the glucose concentration is projected ahead for the predicted hypo alert. Default is `kCGMAlertDefaultPredictionInMinutes`
+ */
+@property(nonatomic,assign) NSUInteger predictionInMinutes;
+
+/**
+ Hysteresis margin of the glucose levels (mg/dl). Default is `kCGMAlertDefaultGlucoseHysteresis`
+ */
+@property(nonatomic,assign) float glucoseHysteresis;
+
+/**
+ Hysteresis margin of the rate levels ((mg/dl)/min). Default is `kCGMAlertDefaultRateHysteresis`
+ */
+@property(nonatomic,assign) float rateHysteresis;
+
+///-----------------------
+/// @name Alert Evaluation
+///-----------------------
+
+/**
+ The alerts whose conditions are currently met, including snoozed alerts
+ */
+@property(nonatomic,readonly) CGMAlertOption activeAlerts;
+
+/**
+ Evaluate the alerts for a glucose reading
+
+ @param glucoseConcentration The glucose concentration in mg/dl
+ @param rateOfChange The rate of change in (mg/dl)/min, or `NAN` if not known. Rate and predicted alerts are not evaluated without a rate of change
+ @param date The date and time of the evaluation, used to expire snoozes
+ @param clearedAlerts If not `NULL`, returns the alerts that were cleared by this reading
+
+ @return The alerts that were raised by this reading
+
+ */
+- (CGMAlertOption)evaluateGlucoseConcentration:(float)glucoseConcentration
+                                  rateOfChange:(float)rateOfChange
+                                        atDate:(NSDate*)date
+                                 clearedAlerts:(CGMAlertOption*)clearedAlerts;
+
+/**
+ Snooze alerts. A snoozed alert that is still active when the snooze expires is raised again by the next evaluation
+
+ @param alerts The alerts to snooze
+ @param interval The duration of the snooze
+
+ */
+- (void)snoozeAlerts:(CGMAlertOption)alerts forTimeInterval:(NSTimeInterval)interval;
+
+/**
+ Clear all the active alerts and snoozes, keeping the configuration
+ */
+- (void)reset;
+
+@end
@@ -0,0 +1,142 @@
+//
+//  UHNCGMAlertEngine.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMAlertEngine.h"
+
+@interface UHNCGMAlertEngine ()
+{
+    // end of the snooze of each alert, indexed by bit position, as time interval since the reference date
+    NSTimeInterval _snoozeEnd[kCGMAlertNumberOfAlerts];
+}
+@property(nonatomic,readwrite) CGMAlertOption activeAlerts;
+@property(nonatomic,assign) CGMAlertOption raisedAlerts;
+@property(nonatomic,assign) CGMAlertOption notifiedAlerts;
+@end
+
+@implementation UHNCGMAlertEngine
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        self.enabledAlerts = kCGMAlertAll;
+        self.levelHypo = kCGMAlertDefaultLevelHypo;
+        self.levelPatientLow = kCGMAlertDefaultLevelPatientLow;
+        self.levelPatientHigh = kCGMAlertDefaultLevelPatientHigh;
+        self.levelHyper = kCGMAlertDefaultLevelHyper;
+        self.levelRateDecrease = kCGMAlertDefaultLevelRateDecrease;
+        self.levelRateIncrease = kCGMAlertDefaultLevelRateIncrease;
+        self.predictionInMinutes = kCGMAlertDefaultPredictionInMinutes;
+        self.glucoseHysteresis = kCGMAlertDefaultGlucoseHysteresis;
+        self.rateHysteresis = kCGMAlertDefaultRateHysteresis;
+        [self reset];
+    }
+    return self;
+}
+
+- (void)reset;
+{
+    self.activeAlerts = 0;
+    self.raisedAlerts = 0;
+    self.notifiedAlerts = 0;
+    for (NSUInteger index = 0; index < kCGMAlertNumberOfAlerts; index++) {
+        _snoozeEnd[index] = 0;
+    }
+}
+
+#pragma mark - Alert Evaluation
+
+- (CGMAlertOption)evaluateGlucoseConcentration:(float)glucoseConcentration
+                                  rateOfChange:(float)rateOfChange
+                                        atDate:(NSDate*)date
+                                 clearedAlerts:(CGMAlertOption*)clearedAlerts;
+{
+    CGMAlertOption previousAlerts = self.activeAlerts;
+    CGMAlertOption alerts = 0;
+
+    // an active alert stays active until the reading has moved past the threshold by the hysteresis margin
+    float glucoseMargin = self.glucoseHysteresis;
+    float rateMargin = self.rateHysteresis;
+    if (!isnan(glucoseConcentration)) {
+        alerts |= [self alert:CGMAlertHypo wasActive:previousAlerts
+                        isSet:(glucoseConcentration < self.levelHypo)
+                      isClear:(glucoseConcentration >= self.levelHypo + glucoseMargin)];
+        alerts |= [self alert:CGMAlertPatientLow wasActive:previousAlerts
+                        isSet:(glucoseConcentration < self.levelPatientLow)
+                      isClear:(glucoseConcentration >= self.levelPatientLow + glucoseMargin)];
+        alerts |= [self alert:CGMAlertPatientHigh wasActive:previousAlerts
+                        isSet:(glucoseConcentration > self.levelPatientHigh)
+                      isClear:(glucoseConcentration <= self.levelPatientHigh - glucoseMargin)];
+        alerts |= [self alert:CGMAlertHyper wasActive:previousAlerts
+                        isSet:(glucoseConcentration > self.levelHyper)
+                      isClear:(glucoseConcentration <= self.levelHyper - glucoseMargin)];
+    }
+    if (!isnan(rateOfChange)) {
+        alerts |= [self alert:CGMAlertRateDecrease wasActive:previousAlerts
+                        isSet:(rateOfChange <= -1 * self.levelRateDecrease)
+                      isClear:(rateOfChange > -1 * (self.levelRateDecrease - rateMargin))];
+        alerts |= [self alert:CGMAlertRateIncrease wasActive:previousAlerts
+                        isSet:(rateOfChange >= self.levelRateIncrease)
+                      isClear:(rateOfChange < self.levelRateIncrease - rateMargin)];
+        if (!isnan(glucoseConcentration)) {
+            float projectedGlucose = glucoseConcentration + rateOfChange * self.predictionInMinutes;
+            alerts |= [self alert:CGMAlertPredictedHypo wasActive:previousAlerts
+                            isSet:(projectedGlucose < self.levelHypo)
+                          isClear:(projectedGlucose >= self.levelHypo + glucoseMargin)];
+        }
+    }
+    alerts &= self.enabledAlerts;
+    self.activeAlerts = alerts;
+
+    // alerts that ended are cleared and can be raised again
+    CGMAlertOption endedAlerts = previousAlerts & ~alerts;
+    CGMAlertOption cleared = endedAlerts & self.notifiedAlerts;
+    self.notifiedAlerts &= ~endedAlerts;
+    self.raisedAlerts &= ~endedAlerts;
+    if (clearedAlerts) {
+        *clearedAlerts = cleared;
+    }
+
+    // raise the active alerts that were not raised yet and are not snoozed
+    NSTimeInterval now = [date timeIntervalSinceReferenceDate];
+    CGMAlertOption raised = 0;
+    for (NSUInteger index = 0; index < kCGMAlertNumberOfAlerts; index++) {
+        CGMAlertOption alert = (1 << index);
+        if ((alerts & alert) && !(self.raisedAlerts & alert) && now >= _snoozeEnd[index]) {
+            raised |= alert;
+        }
+    }
+    self.raisedAlerts |= raised;
+    self.notifiedAlerts |= raised;
+    return raised;
+}
+
+- (void)snoozeAlerts:(CGMAlertOption)alerts forTimeInterval:(NSTimeInterval)interval;
+{
+    NSTimeInterval snoozeEnd = [NSDate timeIntervalSinceReferenceDate] + interval;
+    for (NSUInteger index = 0; index < kCGMAlertNumberOfAlerts; index++) {
+        if (alerts & (1 << index)) {
+            _snoozeEnd[index] = snoozeEnd;
+        }
+    }
+    // snoozed alerts are raised again once the snooze expires
+    self.raisedAlerts &= ~alerts;
+}
+
+#pragma mark - Private Methods
+
+- (CGMAlertOption)alert:(CGMAlertOption)alert wasActive:(CGMAlertOption)previousAlerts isSet:(BOOL)isSet isClear:(BOOL)isClear;
+{
+    if (previousAlerts & alert) {
+        return (isClear ? 0 : alert);
+    }
+    return (isSet ? alert : 0);
+}
+
+@end
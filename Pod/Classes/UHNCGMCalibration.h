@@ -0,0 +1,140 @@
+//
+//  UHNCGMCalibration.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+#import "UHNCGMSession.h"
+#import "UHNCGMCalibrationManager.h"
+
+/**
+ Determine if a calibration status flag is set. The `CGMCPCalibrationStatusOption` values are bit positions of the status octet
+ */
+static inline BOOL CGMCalibrationStatusHas(uint8_t status, CGMCPCalibrationStatusOption option)
+{
+    return (status & (1 << option)) != 0;
+}
+
+/**
+ `UHNCGMCalibration` is an immutable record of a calibration data record, kept in the same compact `CGMCalibrationRecord` as the `UHNCGMCalibrationManager` cache.
+ 
+ */
+@interface UHNCGMCalibration : NSObject <NSCopying>
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a calibration record
+ 
+ @param record The calibration data record
+ @param session The session of the calibration, or nil if not known
+ 
+ @return The calibration record
+ 
+ */
+- (instancetype)initWithRecord:(CGMCalibrationRecord)record session:(UHNCGMSession*)session;
+
+/**
+ Initialize a calibration record from the calibration details parsed from a CGMCP response
+ 
+ @param calibrationDetails The calibration details
+ @param session The session of the calibration, or nil if not known
+ 
+ @return The calibration record
+ 
+ */
+- (instancetype)initWithCalibrationDetails:(NSDictionary*)calibrationDetails session:(UHNCGMSession*)session;
+
+///------------------
+/// @name Calibration
+///------------------
+
+/**
+ The calibration data record
+ */
+@property(nonatomic,readonly) CGMCalibrationRecord record;
+
+/**
+ The calibration data record number
+ */
+@property(nonatomic,readonly) uint16_t recordNumber;
+
+/**
+ The glucose concentration of the calibration in mg/dl
+ */
+@property(nonatomic,readonly) float glucoseConcentration;
+
+/**
+ The fluid type of the calibration
+ */
+@property(nonatomic,readonly) GlucoseFluidTypeOption fluidType;
+
+/**
+ The sample location of the calibration
+ */
+@property(nonatomic,readonly) GlucoseSampleLocationOption sampleLocation;
+
+/**
+ The calibration status octet. The flags are tested with `CGMCalibrationStatusHas`
+ */
+@property(nonatomic,readonly) uint8_t status;
+
+/**
+ Whether the calibration was accepted, i.e. no status flag is set
+ */
+@property(nonatomic,readonly) BOOL isAccepted;
+
+/**
+ The identifier of the session of the calibration, or `NSNotFound` if not known
+ */
+@property(nonatomic,readonly) NSUInteger sessionID;
+
+///----------------
+/// @name Date/Time
+///----------------
+
+/**
+ The time offset of the calibration from the session start time in minutes
+ */
+@property(nonatomic,readonly) uint16_t timeOffset;
+
+/**
+ The time offset of the next calibration from the session start time in minutes
+ */
+@property(nonatomic,readonly) uint16_t timeOffsetNext;
+
+/**
+ The date/time of the calibration, or nil if the session start time is not known
+ */
+@property(nonatomic,readonly) NSDate *date;
+
+/**
+ The date/time of the next calibration, or nil if the session start time is not known
+ */
+@property(nonatomic,readonly) NSDate *nextDate;
+
+@end
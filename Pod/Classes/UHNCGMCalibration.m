@@ -0,0 +1,93 @@
+//
+//  UHNCGMCalibration.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMCalibration.h"
+
+@interface UHNCGMCalibration ()
+@property(nonatomic,strong) UHNCGMSessionClock *clock;
+@end
+
+@implementation UHNCGMCalibration
+
+#pragma mark - Initialization
+
+- (instancetype)initWithRecord:(CGMCalibrationRecord)record session:(UHNCGMSession*)session;
+{
+    if ((self = [super init])) {
+        _record = record;
+        _sessionID = session ? session.sessionID : NSNotFound;
+        _clock = session.clock;
+    }
+    return self;
+}
+
+- (instancetype)initWithCalibrationDetails:(NSDictionary*)calibrationDetails session:(UHNCGMSession*)session;
+{
+    return [self initWithRecord:CGMCalibrationRecordMake(calibrationDetails) session:session];
+}
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    return self;
+}
+
+#pragma mark - Calibration
+
+- (uint16_t)recordNumber;
+{
+    return _record.recordNumber;
+}
+
+- (float)glucoseConcentration;
+{
+    return _record.glucoseConcentration;
+}
+
+- (GlucoseFluidTypeOption)fluidType;
+{
+    return _record.fluidType;
+}
+
+- (GlucoseSampleLocationOption)sampleLocation;
+{
+    return _record.sampleLocation;
+}
+
+- (uint8_t)status;
+{
+    return _record.status;
+}
+
+- (BOOL)isAccepted;
+{
+    return _record.status == 0;
+}
+
+#pragma mark - Date/Time
+
+- (uint16_t)timeOffset;
+{
+    return _record.timeOffset;
+}
+
+- (uint16_t)timeOffsetNext;
+{
+    return _record.timeOffsetNext;
+}
+
+- (NSDate*)date;
+{
+    return [self.clock dateForTimeOffset:_record.timeOffset];
+}
+
+- (NSDate*)nextDate;
+{
+    return [self.clock dateForTimeOffset:_record.timeOffsetNext];
+}
+
+@end
@@ -0,0 +1,185 @@
+//
+//  UHNCGMCalibrationManager.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMSession.h"
+
+@protocol UHNCGMCalibrationManagerDelegate;
+
+/**
+ A calibration data record as cached by `UHNCGMCalibrationManager`
+ */
+typedef struct CGMCalibrationRecord {
+    uint16_t recordNumber;
+    uint16_t timeOffset;
+    uint16_t timeOffsetNext;
+    uint8_t fluidType;
+    uint8_t sampleLocation;
+    uint8_t status;
+    float glucoseConcentration;
+} CGMCalibrationRecord;
+
+/**
+ Make a calibration data record from the calibration details parsed from a CGMCP response
+ */
+extern CGMCalibrationRecord CGMCalibrationRecordMake(NSDictionary *calibrationDetails);
+
+/**
+ `UHNCGMCalibrationManager` caches the calibration data records of each session in a compact array ordered by record number, and plans the retrieval of the calibration history.
+ 
+ A retrieval first requests the most recent record to learn the newest record number, then requests each record newer than the cached records one after another. Only one CGMCP procedure can be in progress, so each request is sent as soon as the previous one completes, without going through the application.
+ 
+ The next calibration time of the newest record of an active session is scheduled as a reminder, which is reported to the delegate when due.
+ 
+ */
+@interface UHNCGMCalibrationManager : NSObject
+
+/**
+ The delegate notified of due calibrations
+ */
+@property(nonatomic,weak) id<UHNCGMCalibrationManagerDelegate> delegate;
+
+///--------------
+/// @name Records
+///--------------
+
+/**
+ Add a calibration data record to the cache of a session
+ 
+ @param calibrationDetails The calibration details as parsed from the CGMCP response
+ @param session The session of the record
+ 
+ @return YES if the record was not cached yet, otherwise NO
+ 
+ */
+- (BOOL)addCalibrationDetails:(NSDictionary*)calibrationDetails forSession:(UHNCGMSession*)session;
+
+/**
+ The number of cached records of a session
+ 
+ @param sessionID The identifier of the session
+ 
+ @return The number of records
+ 
+ */
+- (NSUInteger)numberOfRecordsForSessionID:(NSUInteger)sessionID;
+
+/**
+ A cached record of a session
+ 
+ @param index The index of the record, in ascending order of record number
+ @param sessionID The identifier of the session
+ 
+ @return The record
+ 
+ */
+- (CGMCalibrationRecord)recordAtIndex:(NSUInteger)index forSessionID:(NSUInteger)sessionID;
+
+/**
+ The newest cached record number of a session
+ 
+ @param sessionID The identifier of the session
+ 
+ @return The record number, or `NSNotFound` if no record is cached
+ 
+ */
+- (NSUInteger)newestRecordNumberForSessionID:(NSUInteger)sessionID;
+
+/**
+ Remove the cached records of a session
+ 
+ @param sessionID The identifier of the session
+ 
+ */
+- (void)removeRecordsForSessionID:(NSUInteger)sessionID;
+
+///----------------
+/// @name Retrieval
+///----------------
+
+/**
+ Indicates if a retrieval is in progress
+ */
+@property(nonatomic,readonly) BOOL isRetrieving;
+
+/**
+ Begin a retrieval of the records of a session newer than the cached records
+ 
+ @param session The session of the records
+ 
+ */
+- (void)beginRetrievalForSession:(UHNCGMSession*)session;
+
+/**
+ The next record number to request, which ends the retrieval when there is none
+ 
+ @return The record number, `kCGMCPCalibrationRecordNumberMostRecent` for the first request, or `NSNotFound` when the retrieval is complete
+ 
+ */
+- (NSUInteger)nextRecordNumberToRequest;
+
+/**
+ Note that the last requested record could not be retrieved, e.g. because the sensor does not have it. A failed request of the most recent record ends the retrieval
+ */
+- (void)didFailToRetrieveRecord;
+
+/**
+ Cancel the retrieval in progress, e.g. when the CGM sensor disconnects. The records retrieved so far stay cached
+ */
+- (void)cancelRetrieval;
+
+///-----------------------
+/// @name Next Calibration
+///-----------------------
+
+/**
+ The date of the next calibration requested by the newest record of an active session, or nil if none is scheduled
+ */
+@property(nonatomic,readonly) NSDate *nextCalibrationDate;
+
+/**
+ Cancel the scheduled next calibration reminder
+ */
+- (void)cancelNextCalibrationReminder;
+
+@end
+
+/**
+ The `UHNCGMCalibrationManagerDelegate` protocol is notified of due calibrations
+ */
+@protocol UHNCGMCalibrationManagerDelegate <NSObject>
+
+/**
+ Notifies the delegate that the next calibration is due
+ 
+ @param calibrationManager The calibration manager
+ @param nextCalibrationDate The date the calibration was due
+ @param session The session requesting the calibration
+ 
+ */
+- (void)calibrationManager:(UHNCGMCalibrationManager*)calibrationManager didReachNextCalibrationDate:(NSDate*)nextCalibrationDate forSession:(UHNCGMSession*)session;
+
+@end
@@ -0,0 +1,261 @@
+//
+//  UHNCGMCalibrationManager.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMCalibrationManager.h"
+#import "UHNCGMConstants.h"
+
+@interface UHNCGMCalibrationManager ()
+// records of each session, in NSMutableData sorted by record number
+@property(nonatomic,strong) NSMutableDictionary *recordsBySession;
+@property(nonatomic,readwrite) BOOL isRetrieving;
+@property(nonatomic,assign) NSUInteger retrievingSessionID;
+@property(nonatomic,assign) NSUInteger requestedRecordNumber;
+@property(nonatomic,assign) NSUInteger newestRecordNumberOnSensor;
+@property(nonatomic,strong,readwrite) NSDate *nextCalibrationDate;
+@property(nonatomic,strong) UHNCGMSession *reminderSession;
+@property(nonatomic,strong) NSTimer *reminderTimer;
+@end
+
+CGMCalibrationRecord CGMCalibrationRecordMake(NSDictionary *calibrationDetails)
+{
+    CGMCalibrationRecord record;
+    record.recordNumber = [calibrationDetails[kCGMCalibrationKeyRecordNumber] unsignedShortValue];
+    record.timeOffset = [calibrationDetails[kCGMKeyTimeOffset] unsignedShortValue];
+    record.timeOffsetNext = [calibrationDetails[kCGMKeyTimeOffsetNext] unsignedShortValue];
+    record.fluidType = [calibrationDetails[kCGMCalibrationKeyFluidType] unsignedCharValue];
+    record.sampleLocation = [calibrationDetails[kCGMCalibrationKeySampleLocation] unsignedCharValue];
+    record.status = [calibrationDetails[kCGMCalibrationKeyStatus] unsignedCharValue];
+    record.glucoseConcentration = [calibrationDetails[kCGMCalibrationKeyValue] floatValue];
+    return record;
+}
+
+@implementation UHNCGMCalibrationManager
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        self.recordsBySession = [NSMutableDictionary dictionary];
+        self.requestedRecordNumber = NSNotFound;
+        self.newestRecordNumberOnSensor = NSNotFound;
+    }
+    return self;
+}
+
+- (void)dealloc;
+{
+    [_reminderTimer invalidate];
+}
+
+#pragma mark - Records
+
+- (BOOL)addCalibrationDetails:(NSDictionary*)calibrationDetails forSession:(UHNCGMSession*)session;
+{
+    CGMCalibrationRecord record = CGMCalibrationRecordMake(calibrationDetails);
+
+    if (self.isRetrieving && self.requestedRecordNumber == kCGMCPCalibrationRecordNumberMostRecent) {
+        self.newestRecordNumberOnSensor = record.recordNumber;
+    }
+
+    NSMutableData *records = [self mutableRecordsForSessionID:session.sessionID];
+    NSUInteger count = records.length / sizeof(CGMCalibrationRecord);
+    NSUInteger index = [self indexOfRecordNumber:record.recordNumber inRecords:records];
+    CGMCalibrationRecord *bytes = records.mutableBytes;
+    if (index < count && bytes[index].recordNumber == record.recordNumber) {
+        // a record may be updated, e.g. once a pending calibration is processed
+        bytes[index] = record;
+        [self scheduleNextCalibrationForSession:session];
+        return NO;
+    }
+    [records replaceBytesInRange:NSMakeRange(index * sizeof(CGMCalibrationRecord), 0) withBytes:&record length:sizeof(CGMCalibrationRecord)];
+    [self scheduleNextCalibrationForSession:session];
+    return YES;
+}
+
+- (NSUInteger)numberOfRecordsForSessionID:(NSUInteger)sessionID;
+{
+    return [self.recordsBySession[@(sessionID)] length] / sizeof(CGMCalibrationRecord);
+}
+
+- (CGMCalibrationRecord)recordAtIndex:(NSUInteger)index forSessionID:(NSUInteger)sessionID;
+{
+    NSData *records = self.recordsBySession[@(sessionID)];
+    NSAssert(index < records.length / sizeof(CGMCalibrationRecord), @"Calibration record index %lu is out of range", (unsigned long)index);
+    return ((const CGMCalibrationRecord*)records.bytes)[index];
+}
+
+- (NSUInteger)newestRecordNumberForSessionID:(NSUInteger)sessionID;
+{
+    NSUInteger count = [self numberOfRecordsForSessionID:sessionID];
+    if (count == 0) {
+        return NSNotFound;
+    }
+    return [self recordAtIndex:count - 1 forSessionID:sessionID].recordNumber;
+}
+
+- (void)removeRecordsForSessionID:(NSUInteger)sessionID;
+{
+    [self.recordsBySession removeObjectForKey:@(sessionID)];
+    if (self.reminderSession.sessionID == sessionID) {
+        [self cancelNextCalibrationReminder];
+    }
+}
+
+#pragma mark - Retrieval
+
+- (void)beginRetrievalForSession:(UHNCGMSession*)session;
+{
+    self.isRetrieving = YES;
+    self.retrievingSessionID = session.sessionID;
+    self.requestedRecordNumber = NSNotFound;
+    self.newestRecordNumberOnSensor = NSNotFound;
+}
+
+- (NSUInteger)nextRecordNumberToRequest;
+{
+    if (!self.isRetrieving) {
+        return NSNotFound;
+    }
+    if (self.requestedRecordNumber == NSNotFound) {
+        self.requestedRecordNumber = kCGMCPCalibrationRecordNumberMostRecent;
+        return self.requestedRecordNumber;
+    }
+    if (self.newestRecordNumberOnSensor == NSNotFound) {
+        // the most recent record was not reported
+        [self endRetrieval];
+        return NSNotFound;
+    }
+
+    // continue after the last request, or after the newest cached record before the most recent one
+    NSUInteger recordNumber;
+    if (self.requestedRecordNumber == kCGMCPCalibrationRecordNumberMostRecent) {
+        recordNumber = [self newestCachedRecordNumberBefore:self.newestRecordNumberOnSensor];
+        recordNumber = (recordNumber == NSNotFound) ? 0 : recordNumber + 1;
+    } else {
+        recordNumber = self.requestedRecordNumber + 1;
+    }
+    while (recordNumber < self.newestRecordNumberOnSensor && [self isRecordNumberCached:recordNumber]) {
+        recordNumber++;
+    }
+    if (recordNumber >= self.newestRecordNumberOnSensor) {
+        [self endRetrieval];
+        return NSNotFound;
+    }
+    self.requestedRecordNumber = recordNumber;
+    return recordNumber;
+}
+
+- (void)didFailToRetrieveRecord;
+{
+    if (self.requestedRecordNumber == kCGMCPCalibrationRecordNumberMostRecent) {
+        [self endRetrieval];
+    }
+}
+
+- (void)cancelRetrieval;
+{
+    [self endRetrieval];
+}
+
+#pragma mark - Next Calibration
+
+- (void)cancelNextCalibrationReminder;
+{
+    [self.reminderTimer invalidate];
+    self.reminderTimer = nil;
+    self.reminderSession = nil;
+    self.nextCalibrationDate = nil;
+}
+
+- (void)nextCalibrationReminderDidFire:(NSTimer*)timer
+{
+    NSDate *nextCalibrationDate = self.nextCalibrationDate;
+    UHNCGMSession *session = self.reminderSession;
+    self.reminderTimer = nil;
+    if ([self.delegate respondsToSelector:@selector(calibrationManager:didReachNextCalibrationDate:forSession:)]) {
+        [self.delegate calibrationManager:self didReachNextCalibrationDate:nextCalibrationDate forSession:session];
+    }
+}
+
+#pragma mark - Private Methods
+
+- (NSMutableData*)mutableRecordsForSessionID:(NSUInteger)sessionID;
+{
+    NSMutableData *records = self.recordsBySession[@(sessionID)];
+    if (!records) {
+        records = [NSMutableData data];
+        self.recordsBySession[@(sessionID)] = records;
+    }
+    return records;
+}
+
+- (NSUInteger)indexOfRecordNumber:(NSUInteger)recordNumber inRecords:(NSData*)records;
+{
+    // binary search for the first record at or after the record number
+    const CGMCalibrationRecord *bytes = records.bytes;
+    NSUInteger low = 0;
+    NSUInteger high = records.length / sizeof(CGMCalibrationRecord);
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if (bytes[middle].recordNumber < recordNumber) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+- (BOOL)isRecordNumberCached:(NSUInteger)recordNumber;
+{
+    NSData *records = self.recordsBySession[@(self.retrievingSessionID)];
+    NSUInteger index = [self indexOfRecordNumber:recordNumber inRecords:records];
+    return index < records.length / sizeof(CGMCalibrationRecord) && ((const CGMCalibrationRecord*)records.bytes)[index].recordNumber == recordNumber;
+}
+
+- (NSUInteger)newestCachedRecordNumberBefore:(NSUInteger)recordNumber;
+{
+    NSData *records = self.recordsBySession[@(self.retrievingSessionID)];
+    NSUInteger index = [self indexOfRecordNumber:recordNumber inRecords:records];
+    return index > 0 ? ((const CGMCalibrationRecord*)records.bytes)[index - 1].recordNumber : NSNotFound;
+}
+
+- (void)endRetrieval;
+{
+    self.isRetrieving = NO;
+    self.requestedRecordNumber = NSNotFound;
+}
+
+- (void)scheduleNextCalibrationForSession:(UHNCGMSession*)session;
+{
+    // only the newest record of an active session requests the next calibration
+    NSUInteger count = [self numberOfRecordsForSessionID:session.sessionID];
+    if (!session.isActive || count == 0) {
+        return;
+    }
+    CGMCalibrationRecord newestRecord = [self recordAtIndex:count - 1 forSessionID:session.sessionID];
+    NSDate *nextCalibrationDate = [session.clock dateForTimeOffset:newestRecord.timeOffsetNext];
+    if (self.reminderSession == session && [self.nextCalibrationDate isEqualToDate:nextCalibrationDate]) {
+        return;
+    }
+
+    [self cancelNextCalibrationReminder];
+    self.reminderSession = session;
+    self.nextCalibrationDate = nextCalibrationDate;
+    // a date in the past fires on the next pass of the run loop
+    self.reminderTimer = [[NSTimer alloc] initWithFireDate:nextCalibrationDate
+                                                  interval:0
+                                                    target:self
+                                                  selector:@selector(nextCalibrationReminderDidFire:)
+                                                  userInfo:nil
+                                                   repeats:NO];
+    [[NSRunLoop mainRunLoop] addTimer:self.reminderTimer forMode:NSRunLoopCommonModes];
+}
+
+@end
@@ -0,0 +1,211 @@
+//
+//  UHNCGMCommunicationPolicyEngine.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+#import "UHNCGMAlertEngine.h"
+
+///----------------------------------------------
+/// @name Communication Policy Engine Definitions
+///----------------------------------------------
+/**
+ The policies of the communication interval, in ascending order of priority
+ */
+typedef NS_ENUM (NSUInteger, CGMCommunicationPolicy) {
+    /** Policy while the application is monitoring in the background */
+    CGMCommunicationPolicyBackground = 0,
+    /** Policy while a backlog of stored records is retrieved in the background */
+    CGMCommunicationPolicyBacklog,
+    /** Policy while the application is charting in the foreground */
+    CGMCommunicationPolicyForeground,
+    /** Policy while an alert is active or the glucose concentration is falling */
+    CGMCommunicationPolicyUrgent,
+};
+
+/**
+ The number of communication policies
+ */
+#define kCGMCommunicationPolicyCount                        4
+
+/**
+ Default communication interval of each policy in minutes
+ */
+#define kCGMCommunicationPolicyDefaultIntervalBackground    5
+#define kCGMCommunicationPolicyDefaultIntervalBacklog       15
+#define kCGMCommunicationPolicyDefaultIntervalForeground    1
+#define kCGMCommunicationPolicyDefaultIntervalUrgent        kCGMCPCommunicationIntervalFastest
+
+/**
+ Default number of stored records from which the backlog policy applies, i.e. one hour of 5 minute readings
+ */
+#define kCGMCommunicationPolicyDefaultBacklogThreshold      12
+
+/**
+ Default rate of change ((mg/dl)/min) below which the glucose concentration is considered falling
+ */
+#define kCGMCommunicationPolicyDefaultFallingRate           -1.
+
+/**
+ The statistics of a communication policy
+ */
+typedef struct CGMCommunicationPolicyStatistics {
+    /** The time the policy was in effect in seconds */
+    NSTimeInterval duration;
+    /** The number of live measurement notifications received under the policy */
+    NSUInteger numberOfNotifications;
+    /** The number of notifications per hour the policy was in effect, or 0 if it was never in effect */
+    double notificationsPerHour;
+    /** The mean time in seconds between a measurement and its notification, or `NAN` without notifications */
+    NSTimeInterval meanLatency;
+    /** The longest time in seconds between a measurement and its notification, or `NAN` without notifications */
+    NSTimeInterval maxLatency;
+} CGMCommunicationPolicyStatistics;
+
+/**
+ `UHNCGMCommunicationPolicyEngine` chooses the communication interval of the CGM sensor from the state of the application, so measurements arrive with low latency when it matters and the radio wakes up less often the rest of the time.
+ 
+ The policy with the highest priority whose condition is met applies: urgent while an alert is active or the glucose concentration is falling, foreground while the application is charting, backlog while many stored records are left to retrieve, and background otherwise. While a backlog is retrieved with RACP, the stored records arrive regardless of the communication interval, so fewer periodic notifications keep the radio free for the transfer.
+ 
+ The number of notifications per hour and the notification latency are measured for each policy, so the trade-off of the intervals can be tuned.
+ 
+ @discussion The `UHNCGMController` keeps the alerts, rate of change and backlog up to date and sets the communication interval of the CGM sensor when the policy changes, if `adaptsCommunicationInterval` is enabled. The application sets `isForeground`.
+ 
+ */
+@interface UHNCGMCommunicationPolicyEngine : NSObject
+
+///-------------------
+/// @name Policy Input
+///-------------------
+
+/**
+ Indicates if the application is charting in the foreground
+ */
+@property(nonatomic,assign) BOOL isForeground;
+
+/**
+ The active alerts
+ */
+@property(nonatomic,assign) CGMAlertOption activeAlerts;
+
+/**
+ The rate of change of the glucose concentration in (mg/dl)/min, or `NAN` if not known
+ */
+@property(nonatomic,assign) float rateOfChange;
+
+/**
+ The number of stored records left to retrieve
+ */
+@property(nonatomic,assign) NSUInteger numberOfStoredRecords;
+
+///---------------------------
+/// @name Policy Configuration
+///---------------------------
+
+/**
+ The number of stored records from which the backlog policy applies. Default is `kCGMCommunicationPolicyDefaultBacklogThreshold`
+ */
+@property(nonatomic,assign) NSUInteger backlogThreshold;
+
+/**
+ The rate of change ((mg/dl)/min) below which the glucose concentration is considered falling. Default is `kCGMCommunicationPolicyDefaultFallingRate`
+ */
+@property(nonatomic,assign) float fallingRate;
+
+/**
+ The communication interval of a policy
+ 
+ @param policy The policy
+ 
+ @return The communication interval in minutes, or `kCGMCPCommunicationIntervalFastest`
+ 
+ */
+- (uint8_t)communicationIntervalForPolicy:(CGMCommunicationPolicy)policy;
+
+/**
+ Set the communication interval of a policy
+ 
+ @param intervalInMinutes The communication interval in minutes, `kCGMCPCommunicationIntervalFastest` or `kCGMCPCommunicationIntervalDisabled`
+ @param policy The policy
+ 
+ */
+- (void)setCommunicationInterval:(uint8_t)intervalInMinutes forPolicy:(CGMCommunicationPolicy)policy;
+
+///-----------------------
+/// @name Policy Selection
+///-----------------------
+
+/**
+ The policy in effect since the last evaluation
+ */
+@property(nonatomic,readonly) CGMCommunicationPolicy policy;
+
+/**
+ The communication interval of the policy in effect
+ */
+@property(nonatomic,readonly) uint8_t communicationInterval;
+
+/**
+ Choose the policy from the current input
+ 
+ @param date The date and time of the evaluation, used to measure the time each policy is in effect
+ 
+ @return YES if the communication interval changed, otherwise NO
+ 
+ */
+- (BOOL)evaluatePolicyAtDate:(NSDate*)date;
+
+///-----------------
+/// @name Statistics
+///-----------------
+
+/**
+ Count a live measurement notification for the policy in effect
+ 
+ @param latency The time in seconds between the measurement and its notification
+ 
+ */
+- (void)addNotificationWithLatency:(NSTimeInterval)latency;
+
+/**
+ The statistics of a policy
+ 
+ @param policy The policy
+ @param date The current date and time, which adds the time since the last evaluation to the policy in effect
+ 
+ @return The statistics
+ 
+ */
+- (CGMCommunicationPolicyStatistics)statisticsForPolicy:(CGMCommunicationPolicy)policy atDate:(NSDate*)date;
+
+/**
+ Clear the statistics of all policies, keeping the input and configuration
+ 
+ @param date The date and time from which the statistics are measured
+ 
+ */
+- (void)resetStatisticsAtDate:(NSDate*)date;
+
+@end
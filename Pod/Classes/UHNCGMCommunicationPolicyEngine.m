@@ -0,0 +1,130 @@
+//
+//  UHNCGMCommunicationPolicyEngine.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMCommunicationPolicyEngine.h"
+
+typedef struct CGMPolicyCounters {
+    NSTimeInterval duration;
+    NSUInteger numberOfNotifications;
+    NSTimeInterval totalLatency;
+    NSTimeInterval maxLatency;
+} CGMPolicyCounters;
+
+@interface UHNCGMCommunicationPolicyEngine ()
+{
+    uint8_t _intervals[kCGMCommunicationPolicyCount];
+    CGMPolicyCounters _counters[kCGMCommunicationPolicyCount];
+}
+@property(nonatomic,readwrite) CGMCommunicationPolicy policy;
+// start of the time not yet added to the policy in effect, as time interval since the reference date
+@property(nonatomic,assign) NSTimeInterval policyStartTime;
+@end
+
+@implementation UHNCGMCommunicationPolicyEngine
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        _intervals[CGMCommunicationPolicyBackground] = kCGMCommunicationPolicyDefaultIntervalBackground;
+        _intervals[CGMCommunicationPolicyBacklog] = kCGMCommunicationPolicyDefaultIntervalBacklog;
+        _intervals[CGMCommunicationPolicyForeground] = kCGMCommunicationPolicyDefaultIntervalForeground;
+        _intervals[CGMCommunicationPolicyUrgent] = kCGMCommunicationPolicyDefaultIntervalUrgent;
+        self.backlogThreshold = kCGMCommunicationPolicyDefaultBacklogThreshold;
+        self.fallingRate = kCGMCommunicationPolicyDefaultFallingRate;
+        self.rateOfChange = NAN;
+        self.policy = CGMCommunicationPolicyBackground;
+        [self resetStatisticsAtDate:[NSDate date]];
+    }
+    return self;
+}
+
+#pragma mark - Policy Configuration
+
+- (uint8_t)communicationIntervalForPolicy:(CGMCommunicationPolicy)policy;
+{
+    NSAssert(policy < kCGMCommunicationPolicyCount, @"Unknown communication policy %lu", (unsigned long)policy);
+    return _intervals[policy];
+}
+
+- (void)setCommunicationInterval:(uint8_t)intervalInMinutes forPolicy:(CGMCommunicationPolicy)policy;
+{
+    NSAssert(policy < kCGMCommunicationPolicyCount, @"Unknown communication policy %lu", (unsigned long)policy);
+    _intervals[policy] = intervalInMinutes;
+}
+
+#pragma mark - Policy Selection
+
+- (uint8_t)communicationInterval;
+{
+    return _intervals[self.policy];
+}
+
+- (BOOL)evaluatePolicyAtDate:(NSDate*)date;
+{
+    CGMCommunicationPolicy policy;
+    if (self.activeAlerts || self.rateOfChange < self.fallingRate) {
+        // a NAN rate of change is never falling
+        policy = CGMCommunicationPolicyUrgent;
+    } else if (self.isForeground) {
+        policy = CGMCommunicationPolicyForeground;
+    } else if (self.numberOfStoredRecords >= self.backlogThreshold) {
+        policy = CGMCommunicationPolicyBacklog;
+    } else {
+        policy = CGMCommunicationPolicyBackground;
+    }
+
+    [self addDurationUntilTime:date.timeIntervalSinceReferenceDate];
+    uint8_t previousInterval = self.communicationInterval;
+    self.policy = policy;
+    return self.communicationInterval != previousInterval;
+}
+
+#pragma mark - Statistics
+
+- (void)addNotificationWithLatency:(NSTimeInterval)latency;
+{
+    CGMPolicyCounters *counters = &_counters[self.policy];
+    counters->numberOfNotifications++;
+    counters->totalLatency += latency;
+    counters->maxLatency = MAX(counters->maxLatency, latency);
+}
+
+- (CGMCommunicationPolicyStatistics)statisticsForPolicy:(CGMCommunicationPolicy)policy atDate:(NSDate*)date;
+{
+    NSAssert(policy < kCGMCommunicationPolicyCount, @"Unknown communication policy %lu", (unsigned long)policy);
+    [self addDurationUntilTime:date.timeIntervalSinceReferenceDate];
+
+    CGMPolicyCounters counters = _counters[policy];
+    CGMCommunicationPolicyStatistics statistics;
+    statistics.duration = counters.duration;
+    statistics.numberOfNotifications = counters.numberOfNotifications;
+    statistics.notificationsPerHour = counters.duration > 0 ? counters.numberOfNotifications * 3600. / counters.duration : 0;
+    statistics.meanLatency = counters.numberOfNotifications > 0 ? counters.totalLatency / counters.numberOfNotifications : NAN;
+    statistics.maxLatency = counters.numberOfNotifications > 0 ? counters.maxLatency : NAN;
+    return statistics;
+}
+
+- (void)resetStatisticsAtDate:(NSDate*)date;
+{
+    memset(_counters, 0, sizeof(_counters));
+    self.policyStartTime = date.timeIntervalSinceReferenceDate;
+}
+
+#pragma mark - Private Methods
+
+- (void)addDurationUntilTime:(NSTimeInterval)time;
+{
+    if (time > self.policyStartTime) {
+        _counters[self.policy].duration += time - self.policyStartTime;
+        self.policyStartTime = time;
+    }
+}
+
+@end
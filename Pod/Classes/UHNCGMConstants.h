@@ -39,6 +39,7 @@
 #define kCGMKeyDateTimeNext @"CGMDateTimeNext"
 #define kCGMKeyTimeOffset @"CGMTimeOffset"
 #define kCGMKeyTimeOffsetNext @"CGMTimeOffsetNext"
+#define kCGMKeySessionID @"CGMSessionID"
 #define kCGMCRCFailed @"CGMCRCFailed"
 
 /**
@@ -47,6 +48,8 @@
 #define kCGMMeasurementKeyGlucoseConcentration @"CGMGlucoseConcentration"
 #define kCGMMeasurementKeyTrendInfo @"CGMTrendInformation"
 #define kCGMMeasurementKeyQuality @"CGMMeasurementQuality"
+#define kCGMMeasurementKeyDerivedTrendInfo @"CGMDerivedTrendInformation"
+#define kCGMMeasurementKeyTrendArrow @"CGMTrendArrow"
 
 /** 
  Keys for Status Characteristic
@@ -174,6 +177,7 @@
 #define kCGMMeasurementFieldSizeTrendInfo               2
 #define kCGMMeasurementFieldSizeQuality                 2
 #define kCGMMeasurementFieldSizeCRC                     2
+#define kCGMMeasurementMaxLength                        15
 
 
 ///--------------------------------------------------
@@ -195,6 +199,35 @@ typedef NS_ENUM (uint8_t, CGMMeasurementFlagOption) {
     CGMMeasurementFlagsStatusOctetPresent       = (1 << 7)
 };
 
+/**
+ Rate of change thresholds, in (mg/dl)/min, used to classify the glucose trend arrows
+ */
+#define kCGMTrendArrowThresholdSlight                   1.
+#define kCGMTrendArrowThresholdModerate                 2.
+#define kCGMTrendArrowThresholdRapid                    3.
+
+/**
+ All possible glucose trend arrows, classified from the rate of change of the glucose concentration
+ */
+typedef NS_ENUM (uint8_t, CGMTrendArrowOption) {
+    /** Trend arrow indicating that the rate of change is not known */
+    CGMTrendArrowUnknown = 0,
+    /** Trend arrow indicating a rate of change of at least +3 (mg/dl)/min */
+    CGMTrendArrowRisingRapidly,
+    /** Trend arrow indicating a rate of change between +2 and +3 (mg/dl)/min */
+    CGMTrendArrowRising,
+    /** Trend arrow indicating a rate of change between +1 and +2 (mg/dl)/min */
+    CGMTrendArrowRisingSlightly,
+    /** Trend arrow indicating a rate of change between -1 and +1 (mg/dl)/min */
+    CGMTrendArrowFlat,
+    /** Trend arrow indicating a rate of change between -1 and -2 (mg/dl)/min */
+    CGMTrendArrowFallingSlightly,
+    /** Trend arrow indicating a rate of change between -2 and -3 (mg/dl)/min */
+    CGMTrendArrowFalling,
+    /** Trend arrow indicating a rate of change of at most -3 (mg/dl)/min */
+    CGMTrendArrowFallingRapidly,
+};
+
 
 ///---------------------------------
 /// @name CGM Feature Characteristic
@@ -564,6 +597,27 @@ typedef NS_ENUM (uint8_t, DSTOffsetOption) {
 #define kCGMCPFieldRangeCalibrationRecordNumber             (NSRange){8,2}
 #define kCGMCPFieldRangeCalibrationStatus                   (NSRange){10,1}
 
+/**
+ CGMCP command sizes. The longest command is the set calibration value op code with its 10 octet calibration record operand and the E2E-CRC
+ */
+#define kCGMCPFieldSizeCRC                                  2
+#define kCGMCPCommandMaxLength                              13
+
+/**
+ The calibration record number requesting the most recent calibration data record
+ */
+#define kCGMCPCalibrationRecordNumberMostRecent             0xFFFF
+
+/**
+ The communication interval disabling periodic communication
+ */
+#define kCGMCPCommunicationIntervalDisabled                 0x00
+
+/**
+ The communication interval requesting the fastest interval supported by the CGM sensor
+ */
+#define kCGMCPCommunicationIntervalFastest                  0xFF
+
 
 ///---------------------------------------------------------
 /// @name CGMCP Characteristic Enumerations
@@ -660,6 +714,28 @@ typedef NS_ENUM (uint8_t, CGMCPCalibrationStatusOption) {
     CGMCPCalibrationStatusProcessPending,
 };
 
+///-------------------------
+/// @name SFLOAT Definitions
+///-------------------------
+/**
+ The 16 bit SFLOAT (IEEE 11073-20601) used for glucose concentrations and alert levels is a 4 bit signed exponent of base 10 and a 12 bit signed mantissa. The special values below all have an exponent of 0, so these mantissas are not used for finite values with an exponent of 0.
+ */
+#define kSFloatPositiveInfinity     0x07FE
+#define kSFloatNaN                  0x07FF
+#define kSFloatNRes                 0x0800
+#define kSFloatReserved             0x0801
+#define kSFloatNegativeInfinity     0x0802
+#define kSFloatMantissaMax          2047
+#define kSFloatMantissaMin          -2048
+#define kSFloatExponentMax          7
+#define kSFloatExponentMin          -8
+
+/**
+ The E2E-CRC is a CRC-CCITT with the generator polynomial D^16 + D^12 + D^5 + 1, calculated with this seed over all preceding octets of the characteristic value
+ */
+#define kCGMCRCPolynomial           0x1021
+#define kCGMCRCSeed                 0xFFFF
+
 ///-----------------------
 /// @name Time Definitions
 ///-----------------------
@@ -669,3 +745,15 @@ typedef NS_ENUM (uint8_t, CGMCPCalibrationStatusOption) {
 #define kMinutesInHour 60.
 #define kSecondsInMinute 60.
 #define kSecondsInHour (kMinutesInHour * kSecondsInMinute)
+
+/**
+ Integer time definitions for epoch time calculations, in seconds
+ */
+#define kCGMSecondsInMinute         60
+#define kCGMSecondsInDay            86400
+#define kCGMTimeZoneStepSizeSeconds 900
+
+/**
+ The epoch time returned when the session start time is not known
+ */
+#define kCGMEpochTimeUnknown        INT64_MIN
@@ -26,6 +26,19 @@
 #import <Foundation/Foundation.h>
 #import "UHNCGMConstants.h"
 #import "UHNRACPConstants.h"
+#import "UHNCGMStatistics.h"
+#import "UHNCGMGlucoseProfile.h"
+#import "UHNCGMTrendEstimator.h"
+#import "UHNCGMAlertEngine.h"
+#import "UHNCGMGapDetector.h"
+#import "UHNCGMSessionManager.h"
+#import "UHNCGMCalibrationManager.h"
+#import "UHNCGMSettings.h"
+#import "UHNCGMCommunicationPolicyEngine.h"
+#import "UHNCGMMeasurement.h"
+#import "UHNCGMStatus.h"
+#import "UHNCGMFeatures.h"
+#import "UHNCGMCalibration.h"
 
 @protocol UHNCGMControllerDelegate;
 
@@ -243,6 +256,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)getCalibrationDataRecord:(uint16_t)recordNumber;
 
+/**
+ Request the calibration data records of the current session that are newer than the records cached by the `calibrationManager`
+ 
+ @discussion The most recent record is requested first, then each missing record up to it, one after another. Each record is reported with `cgmController:didGetCalibrationDetails:` and the completion with `cgmControllerDidGetCalibrationHistory:`. A record that can not be retrieved is reported with `cgmController:CGMCPOperation:failed:` and skipped
+ 
+ @discussion The session start time needs to be read first
+ 
+ */
+- (void)getCalibrationHistory;
+
 /**
  Request the current patient high alert level from the CGM sensor
  
@@ -303,6 +326,14 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)getAlertLevelRateIncrease;
 
+/**
+ Request the communication interval and all alert levels supported by the CGM sensor into the `settings` snapshot
+ 
+ @discussion The settings are requested one after another, skipping the alert levels that the CGM sensor features do not support, so the features should be read first. Each value is reported as by the individual get methods, and the completion with `cgmController:didGetSettings:`. A setting that is not supported by the CGM sensor is reported with `cgmController:CGMCPOperation:failed:` and skipped
+ 
+ */
+- (void)getSettings;
+
 /**
  Request to set the current communication interval to the specified value
  
@@ -353,6 +384,22 @@ The delegate for the CGM controller. This can be used to make changes to the del
              sampleLocation:(GlucoseSampleLocationOption)location
                        date:(NSDate*)date;
 
+/**
+ Request to set a calibration as specified
+ 
+ @param value The glucose concentration value with which to calibrate, which is encoded as an SFLOAT with the most precision that fits
+ @param type The fluid type with which the glucose concentration was measured
+ @param location The sample location where the glucose concentration was measured
+ @param date The date the glucose concentration was measured
+ 
+ @discussion The delegate is notified as for `setCalibrationValue:fluidType:sampleLocation:date:`
+ 
+ */
+- (void)setCalibrationGlucoseValue:(float)value
+                         fluidType:(GlucoseFluidTypeOption)type
+                    sampleLocation:(GlucoseSampleLocationOption)location
+                              date:(NSDate*)date;
+
 /**
  Request to set the patient high alert level
  
@@ -365,6 +412,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setPatientHighLevel:(shortFloat)value;
 
+/**
+ Request to set the patient high alert level
+ 
+ @param value The value of the patient high alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setPatientHighLevel:`
+ 
+ */
+- (void)setPatientHighLevelValue:(float)value;
+
 /**
  Request to set the patient low alert level
  
@@ -377,6 +434,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setPatientLowLevel:(shortFloat)value;
 
+/**
+ Request to set the patient low alert level
+ 
+ @param value The value of the patient low alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setPatientLowLevel:`
+ 
+ */
+- (void)setPatientLowLevelValue:(float)value;
+
 /**
  Request to set the hypo alert level
  
@@ -389,6 +456,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setHypoLevel:(shortFloat)value;
 
+/**
+ Request to set the hypo alert level
+ 
+ @param value The value of the hypo alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setHypoLevel:`
+ 
+ */
+- (void)setHypoLevelValue:(float)value;
+
 /**
  Request to set the hyper alert level
  
@@ -401,6 +478,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setHyperLevel:(shortFloat)value;
 
+/**
+ Request to set the hyper alert level
+ 
+ @param value The value of the hyper alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setHyperLevel:`
+ 
+ */
+- (void)setHyperLevelValue:(float)value;
+
 /**
  Request to set the rate decrease alert level
  
@@ -413,6 +500,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setRateDecreaseLevel:(shortFloat)value;
 
+/**
+ Request to set the rate decrease alert level
+ 
+ @param value The value of the rate decrease alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setRateDecreaseLevel:`
+ 
+ */
+- (void)setRateDecreaseLevelValue:(float)value;
+
 /**
  Request to set the rate increase alert level
  
@@ -425,6 +522,16 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)setRateIncreaseLevel:(shortFloat)value;
 
+/**
+ Request to set the rate increase alert level
+ 
+ @param value The value of the rate increase alert level, which is encoded as an SFLOAT with the most precision that fits
+ 
+ @discussion The delegate is notified as for `setRateIncreaseLevel:`
+ 
+ */
+- (void)setRateIncreaseLevelValue:(float)value;
+
 ///----------------------------------
 /// @name Record Access Control Point
 ///----------------------------------
@@ -447,6 +554,8 @@ The delegate for the CGM controller. This can be used to make changes to the del
  
  @discussion If 'getStoredRecordsGreatThanEqualTo:` is unsuccessful, the delegate will receive the `cgmController:RACPOperation:failed:` notification.
  
+ @discussion If the session start time has not been read, the records of the whole session are requested
+ 
  */
 - (void)getStoredRecordsGreatThanEqualTo:(NSDate*)date;
 
@@ -469,9 +578,121 @@ The delegate for the CGM controller. This can be used to make changes to the del
  
  @discussion If 'getNumberOfStoredRecordsGreatThanEqualTo:` is unsuccessful, the delegate will receive the `cgmController:RACPOperation:failed:` notification.
  
+ @discussion If the session start time has not been read, the records of the whole session are requested
+ 
  */
 - (void)getNumberOfStoredRecordsGreatThanEqualTo:(NSDate*)date;
 
+/**
+ Indicates if a RACP get stored records procedure is in progress. Live measurements may be reported while in progress, so each measurement is classified on its own: it is historical if it is not newer than the newest measurement received, or older than `kCGMAlertLiveMeasurementMaximumAge`.
+ */
+@property(nonatomic,readonly) BOOL isRetrievingStoredRecords;
+
+/**
+ Detector of gaps in the measurement stream, e.g. while the CGM sensor was out of range. The cadence is taken from the communication interval, when read with `getCommunicationInterval`, or from the observed time offsets. This is the gap detector of the current session, which is fed from the record index of the session, or a detector of its own while the session start time is not known.
+ */
+@property(nonatomic,strong,readonly) UHNCGMGapDetector *gapDetector;
+
+/**
+ Indicates if the missing ranges of the `gapDetector` should be requested from the CGM sensor. Default is `YES`
+
+ @discussion When a gap is detected or the measurement notification is enabled after a reconnect, the missing ranges are requested one at a time with targeted RACP get stored records procedures, instead of a full resync. The RACP characteristic indication needs to be enabled. The stored records are reported with `cgmController:measurementDetails:` and each reconciled range with `cgmController:didReconcileGapWithTimeOffsets:`. These procedures are not reported as RACP procedures of the app, i.e. with `cgmController:RACPOperationSuccessful:`, `cgmController:RACPOperation:failed:` or `cgmControllerDidGetStoredRecords:`. A range that can not be requested, e.g. while a RACP procedure of the app is in progress, is requested again with a later measurement, and given up after repeated failures. Live measurements received while a range is reconciled are still evaluated by the `alertEngine`
+
+ */
+@property(nonatomic,assign) BOOL shouldReconcileGaps;
+
+///---------------
+/// @name Sessions
+///---------------
+
+/**
+ History of the sessions of the connected CGM sensors. A session is begun when a new session start time is read, and stopped when a session is started or stopped with `startSession` or `stopSession`. The session run time and the status read after a session is stopped are kept with the session.
+
+ @discussion The identifier of the current session is added to the measurement, status and calibration details with `kCGMKeySessionID`, and the time offset of each measurement is added to the record index of the session
+
+ */
+@property(nonatomic,strong,readonly) UHNCGMSessionManager *sessionManager;
+
+/**
+ Cache of the calibration data records of each session, filled by `getCalibrationHistory` and any calibration data record received. The next calibration time of the newest record of the current session is reported with `cgmController:didReachNextCalibrationDate:` when due
+ */
+@property(nonatomic,strong,readonly) UHNCGMCalibrationManager *calibrationManager;
+
+/**
+ Snapshot of the communication interval and alert levels of the CGM sensor, filled by `getSettings` and the individual get methods, and updated by each set method that the CGM sensor confirms
+ */
+@property(nonatomic,strong,readonly) UHNCGMSettings *settings;
+
+///---------------------------
+/// @name Communication Policy
+///---------------------------
+
+/**
+ Engine choosing the communication interval from the state of the application. Its alerts and rate of change are kept up to date from the live measurements. Its backlog is the number of records reported by `getNumberOfStoredRecords` that have not been received yet, counted in the record index of the current session. The notifications per hour and latency of each policy are measured from the live measurements
+ */
+@property(nonatomic,strong,readonly) UHNCGMCommunicationPolicyEngine *communicationPolicyEngine;
+
+/**
+ Indicates if the communication interval of the CGM sensor is set by the `communicationPolicyEngine`. Default is `NO`
+ 
+ @discussion The communication interval is set when the policy changes, but not while another CGMCP procedure started by the controller is in progress, in which case it is set with a later measurement. An interval the CGM sensor rejected is also set again with a later measurement
+ 
+ */
+@property(nonatomic,assign) BOOL adaptsCommunicationInterval;
+
+/**
+ Evaluate the policy of the `communicationPolicyEngine` and set the communication interval of the CGM sensor if it changed and `adaptsCommunicationInterval` is enabled
+ 
+ @discussion Call this method after changing the state of the application, e.g. `isForeground`, of the `communicationPolicyEngine`
+ 
+ */
+- (void)updateCommunicationInterval;
+
+///--------------------------
+/// @name Glycemic Statistics
+///--------------------------
+
+/**
+ Glycemic statistics of the measurements received from the CGM sensor, including stored records. The statistics are updated as each measurement is received and are reset when the session start time changes.
+
+ @discussion The thresholds of the statistics are updated with the alert levels read from the CGM sensor (see `getAlertLevelHypo`, `getAlertLevelHyper`, `getPatientAlertLevelLow`, and `getPatientAlertLevelHigh`)
+
+ */
+@property(nonatomic,strong,readonly) UHNCGMStatistics *statistics;
+
+/**
+ Ambulatory glucose profile of the measurements received between two dates, built by merging the profiles of each local day in the date range. Measurements are only added to the profile once the session start time is known, and only once per session record. The profiles of the 90 most recent local days are kept.
+
+ @param fromDate The first day of the date range
+ @param toDate The last day of the date range (inclusive)
+
+ @return The glucose profile of the date range
+
+ @discussion The returned profile is a copy and can be merged with profiles from other sessions or devices (see `mergeProfile:`)
+
+ */
+- (UHNCGMGlucoseProfile*)glucoseProfileFromDate:(NSDate*)fromDate toDate:(NSDate*)toDate;
+
+/**
+ Estimator of the rate of change of the glucose concentration. Every live measurement reported to the delegate includes the derived trend (`kCGMMeasurementKeyDerivedTrendInfo`), once enough measurements are received, and the trend arrow (`kCGMMeasurementKeyTrendArrow`). Historical records, e.g. stored records or reconciled gaps, are not added to the estimator, so they do not restart the estimation and have no derived trend.
+
+ @discussion The trend arrow is classified from the trend information reported by the sensor, if present, otherwise from the derived trend. This allows trend arrows to be displayed for sensors that do not support the CGM trend feature.
+
+ */
+@property(nonatomic,strong,readonly) UHNCGMTrendEstimator *trendEstimator;
+
+///------------------
+/// @name Host Alerts
+///------------------
+
+/**
+ Host-side alert engine. Every live measurement is evaluated and raised or cleared alerts are reported to the delegate with `cgmController:didRaiseAlerts:measurementDetails:` and `cgmController:didClearAlerts:`. Historical records, i.e. measurements not newer than the newest measurement received or older than `kCGMAlertLiveMeasurementMaximumAge`, are not evaluated. Without a session the age of a measurement is not known, so measurements received while `isRetrievingStoredRecords` are not evaluated either.
+
+ @discussion The thresholds of the alert engine are updated with the alert levels read from the CGM sensor. Alerts can be configured and snoozed directly on the alert engine.
+
+ */
+@property(nonatomic,strong,readonly) UHNCGMAlertEngine *alertEngine;
+
 ///------------------------------
 /// @name Bond Management Service
 ///------------------------------
@@ -547,6 +768,17 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller measurementDetails:(NSDictionary*)measurementDetails;
 
+/**
+ Notifies the delegate when a CGM sensor has a measurement to report, as a compact typed record
+ 
+ @param controller The `UHNCGMController` that was managing the CGM sensor
+ @param measurement A `UHNCGMMeasurement` of the measurement
+ 
+ @discussion This method is invoked along with `cgmController:measurementDetails:`, for delegates that keep many measurements and test the sensor status flags without dictionary lookups
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReceiveMeasurement:(UHNCGMMeasurement*)measurement;
+
 /**
  Notifies the delegate when the CGM sensor session start time characteristic has been read
  
@@ -612,6 +844,17 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller didReadFeatures:(NSDictionary*)features;
 
+/**
+ Notifies the delegate when the CGM sensor features characteristic has been read, as a compact typed record
+ 
+ @param controller The `UHNCGMController` which with the characteristic was read
+ @param features A `UHNCGMFeatures` of the supported features
+ 
+ @discussion This method is invoked along with `cgmController:didReadFeatures:`
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReceiveFeatures:(UHNCGMFeatures*)features;
+
 /**
  Notifies the delegate when the CGM sensor session run time characteristic has been read
  
@@ -636,6 +879,17 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller didReadStatus:(NSDictionary*)status;
 
+/**
+ Notifies the delegate when the CGM sensor status characteristic has been read, as a compact typed record
+ 
+ @param controller The `UHNCGMController` which with the characteristic was read
+ @param status A `UHNCGMStatus` of the status of the CGM sensor
+ 
+ @discussion This method is invoked along with `cgmController:didReadStatus:`
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReceiveStatus:(UHNCGMStatus*)status;
+
 /**
  Notifies the delegate when a CGMCP operation has been completed successfully
  
@@ -807,6 +1061,36 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller didGetCalibrationDetails:(NSDictionary*)calibrationDetails;
 
+/**
+ Notifies the delegate when the get calibration data record CGMCP operation has been completed successfully, as a compact typed record
+ 
+ @param controller The `UHNCGMController` which with the CGMCP operation was executed
+ @param calibration A `UHNCGMCalibration` of the calibration data record
+ 
+ @discussion This method is invoked along with `cgmController:didGetCalibrationDetails:`
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReceiveCalibration:(UHNCGMCalibration*)calibration;
+
+/**
+ Notifies the delegate when the calibration history has been retrieved
+ 
+ @param controller The `UHNCGMController` which retrieved the calibration history
+ 
+ @discussion This method is invoked when all calibration data records requested with `getCalibrationHistory` have been reported or skipped
+ 
+ */
+- (void)cgmControllerDidGetCalibrationHistory:(UHNCGMController*)controller;
+
+/**
+ Notifies the delegate when the next calibration requested by the CGM sensor is due
+ 
+ @param controller The `UHNCGMController` which received the calibration data record
+ @param nextCalibrationDate The next calibration time of the newest calibration data record of the current session
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReachNextCalibrationDate:(NSDate*)nextCalibrationDate;
+
 /**
  Notifies the delegate of the current patient high alert level of the CGM sensor
  
@@ -873,6 +1157,17 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller didGetAlertLevelRateIncrease:(NSNumber*)increaseLevel;
 
+/**
+ Notifies the delegate when the settings of the CGM sensor have been refreshed
+ 
+ @param controller The `UHNCGMController` which refreshed the settings
+ @param settings The settings snapshot
+ 
+ @discussion This method is invoked when all settings requested with `getSettings` have been reported or skipped
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didGetSettings:(UHNCGMSettings*)settings;
+
 /**
  Notifies the delegate when a RACP procedure has been completed successfully
  
@@ -917,5 +1212,39 @@ The delegate for the CGM controller. This can be used to make changes to the del
  */
 - (void)cgmController:(UHNCGMController*)controller didGetNumberOfStoredRecords:(NSNumber*)numOfRecords;
 
+/**
+ Notifies the delegate that a gap in the measurements has been reconciled
+ 
+ @param controller The `UHNCGMController` which requested the missing records
+ @param timeOffsets The time offsets of the gap, in minutes since the session start
+ 
+ @discussion This method is invoked when the stored records of a gap requested by the controller, see `shouldReconcileGaps`, have been reported with `cgmController:measurementDetails:`, or the CGM sensor has no records for it. The records are historical records, so they are not evaluated by the `alertEngine`
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didReconcileGapWithTimeOffsets:(NSRange)timeOffsets;
+
+/**
+ Notifies the delegate when host-side alerts have been raised
+ 
+ @param controller The `UHNCGMController` that was managing the CGM sensor
+ @param alerts The alerts that were raised. The alerts are defined in `UHNCGMAlertEngine.h`
+ @param measurementDetails The measurement details that raised the alerts
+ 
+ @discussion This method is invoked before the measurement is reported to the delegate. It is not invoked for historical records, e.g. stored records older than the newest measurement received
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didRaiseAlerts:(CGMAlertOption)alerts measurementDetails:(NSDictionary*)measurementDetails;
+
+/**
+ Notifies the delegate when host-side alerts have been cleared
+ 
+ @param controller The `UHNCGMController` that was managing the CGM sensor
+ @param alerts The alerts that were cleared. The alerts are defined in `UHNCGMAlertEngine.h`
+ 
+ @discussion This method is invoked when the condition of a previously raised alert has ended
+ 
+ */
+- (void)cgmController:(UHNCGMController*)controller didClearAlerts:(CGMAlertOption)alerts;
+
 @end
 
@@ -12,15 +12,40 @@
 #import "UHNDebug.h"
 #import "NSData+CGMCommands.h"
 #import "NSData+CGMParser.h"
+#import "UHNCGMMeasurementDetails.h"
+#import "NSDictionary+CGMExtensions.h"
 #import "UHNRecordAccessControlPoint.h"
 
-@interface UHNCGMController() <UHNBLEControllerDelegate>
+// number of failed requests for a missing range before it is given up, e.g. when the sensor does not support the filter
+static const NSUInteger kCGMGapReconcileMaximumAttempts = 3;
+
+// number of local days of which the glucose profile is kept, e.g. for a 90 day AGP report
+static const NSUInteger kCGMDailyGlucoseProfileMaximumDays = 90;
+
+@interface UHNCGMController() <UHNBLEControllerDelegate, UHNCGMCalibrationManagerDelegate>
 @property(nonatomic,strong) UHNBLEController *bleController;
 @property(nonatomic,strong) NSUUID *deviceIdentifier;
-@property(nonatomic,strong) NSDate *sessionStartTime;
+@property(nonatomic,strong) UHNCGMSession *currentSession;
+@property(nonatomic,strong) UHNCGMSession *sessionAwaitingStopStatus;
+@property(nonatomic,strong,readwrite) UHNCGMSessionManager *sessionManager;
+@property(nonatomic,strong,readwrite) UHNCGMCalibrationManager *calibrationManager;
+@property(nonatomic,strong,readwrite) UHNCGMSettings *settings;
+@property(nonatomic,strong,readwrite) UHNCGMCommunicationPolicyEngine *communicationPolicyEngine;
+@property(nonatomic,assign) NSUInteger adaptedCommunicationInterval;
 @property(nonatomic,strong) NSString *cgmDeviceName;
 @property(nonatomic,assign) BOOL shouldBlockReconnect;
 @property(nonatomic,assign) BOOL crcPresent;
+@property(nonatomic,strong,readwrite) UHNCGMStatistics *statistics;
+@property(nonatomic,strong) NSMutableDictionary *dailyGlucoseProfiles;
+@property(nonatomic,strong,readwrite) UHNCGMTrendEstimator *trendEstimator;
+@property(nonatomic,strong,readwrite) UHNCGMAlertEngine *alertEngine;
+@property(nonatomic,readwrite) BOOL isRetrievingStoredRecords;
+@property(nonatomic,strong) UHNCGMGapDetector *sessionlessGapDetector;
+@property(nonatomic,assign) NSRange reconcilingRange;
+@property(nonatomic,assign) NSUInteger numberOfReconcileAttempts;
+@property(nonatomic,assign) NSUInteger numberOfStoredRecordsReported;
+@property(nonatomic,assign) NSUInteger storedRecordsCountFirstTimeOffset;
+@property(nonatomic,assign) NSRange storedRecordsCountRange;
 @end
 
 @implementation UHNCGMController
@@ -68,6 +93,22 @@
                                                        requiredServices:requiredServices];
         self.shouldBlockReconnect = YES;
         self.crcPresent = NO;
+        self.statistics = [[UHNCGMStatistics alloc] init];
+        self.dailyGlucoseProfiles = [NSMutableDictionary dictionary];
+        self.trendEstimator = [[UHNCGMTrendEstimator alloc] init];
+        self.alertEngine = [[UHNCGMAlertEngine alloc] init];
+        self.isRetrievingStoredRecords = NO;
+        self.sessionlessGapDetector = [[UHNCGMGapDetector alloc] init];
+        self.sessionManager = [[UHNCGMSessionManager alloc] init];
+        self.calibrationManager = [[UHNCGMCalibrationManager alloc] init];
+        self.calibrationManager.delegate = self;
+        self.settings = [[UHNCGMSettings alloc] init];
+        self.communicationPolicyEngine = [[UHNCGMCommunicationPolicyEngine alloc] init];
+        self.adaptsCommunicationInterval = NO;
+        self.adaptedCommunicationInterval = NSNotFound;
+        self.shouldReconcileGaps = YES;
+        self.reconcilingRange = NSMakeRange(NSNotFound, 0);
+        self.storedRecordsCountRange = NSMakeRange(NSNotFound, 0);
     }
     return self;
 }
@@ -168,20 +209,37 @@
     }
 }
 
+- (void)sendCGMCPCommandBuffer:(CGMCommandBuffer*)command;
+{
+    // the command is only copied once, after the E2E-CRC is appended if supported
+    if (self.crcPresent) {
+        CGMCommandAppendCRC(command);
+    }
+    [self sendCGMCPCommand:[NSData dataWithCGMCommand:command]];
+}
+
 - (void)sendCGMCPOpCode:(uint8_t)opCode;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *command = [NSData dataWithBytes:&opCode length:sizeof(uint8_t)];
-    [self sendCGMCPCommand:command];
+    [self sendCGMCPCommand:[NSData cgmCommandWithOpCode:opCode crcPresent:self.crcPresent]];
 }
 
 - (void)sendCGMCPOpCode:(uint8_t)opCode
-            operandData:(NSData*)operand
+          uint16Operand:(uint16_t)operand;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSMutableData *command = [NSMutableData dataWithBytes:&opCode length:sizeof(uint8_t)];
-    [command appendData:operand];
-    [self sendCGMCPCommand:command];
+    CGMCommandBuffer command;
+    CGMCommandBegin(&command, opCode);
+    CGMCommandAppendUInt16(&command, operand);
+    [self sendCGMCPCommandBuffer:&command];
+}
+
+- (void)sendCGMCPSetOpCode:(uint8_t)opCode
+              sfloatOperand:(uint16_t)operand;
+{
+    // the value is kept as the sensor stores it, once the sensor confirms it
+    [self.settings willSetValue:CGMFloatFromSFloat(operand) forRequestOpCode:opCode];
+    [self sendCGMCPOpCode:opCode uint16Operand:operand];
 }
 
 - (void)startSession;
@@ -212,15 +270,61 @@
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
     // write 0xFFFF to calibration get operation
-    [self getCalibrationDataRecord:0xFFFF];
+    [self getCalibrationDataRecord:kCGMCPCalibrationRecordNumberMostRecent];
+}
+
+- (void)getCalibrationHistory;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    if (!self.currentSession) {
+        DLog(@"%s: session start time is not known", __PRETTY_FUNCTION__);
+        return;
+    }
+    [self.calibrationManager beginRetrievalForSession:self.currentSession];
+    [self requestNextCalibrationDataRecord];
+}
+
+- (void)requestNextCalibrationDataRecord
+{
+    NSUInteger recordNumber = [self.calibrationManager nextRecordNumberToRequest];
+    if (recordNumber != NSNotFound) {
+        [self getCalibrationDataRecord:recordNumber];
+        return;
+    }
+    if ([self.delegate respondsToSelector:@selector(cgmControllerDidGetCalibrationHistory:)]) {
+        [self.delegate cgmControllerDidGetCalibrationHistory:self];
+    }
+    // an interval change deferred during the retrieval
+    [self updateCommunicationInterval];
 }
 
 - (void)getCalibrationDataRecord:(uint16_t)recordNumber;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&recordNumber length:sizeof(uint16_t)];
-    [self sendCGMCPOpCode:CGMCPOpCodeCalibrationValueGet operandData:operand];
+    [self sendCGMCPOpCode:CGMCPOpCodeCalibrationValueGet uint16Operand:recordNumber];
 }
+
+- (void)getSettings;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self.settings beginRefresh];
+    [self requestNextSetting];
+}
+
+- (void)requestNextSetting
+{
+    NSUInteger opCode = [self.settings nextOpCodeToRequest];
+    if (opCode != NSNotFound) {
+        [self sendCGMCPOpCode:opCode];
+        return;
+    }
+    if ([self.delegate respondsToSelector:@selector(cgmController:didGetSettings:)]) {
+        [self.delegate cgmController:self didGetSettings:self.settings];
+    }
+    // an interval change deferred during the refresh
+    [self updateCommunicationInterval];
+}
+
 - (void)getPatientAlertLevelHigh;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
@@ -260,22 +364,46 @@
 - (void)setCommunicationInterval:(uint8_t)intervalInMinutes;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&intervalInMinutes length:sizeof(uint8_t)];
-    [self sendCGMCPOpCode:CGMCPOpCodeCommIntervalSet operandData:operand];
+    CGMCommandBuffer command;
+    CGMCommandBegin(&command, CGMCPOpCodeCommIntervalSet);
+    CGMCommandAppendUInt8(&command, intervalInMinutes);
+    [self.settings willSetValue:intervalInMinutes forRequestOpCode:CGMCPOpCodeCommIntervalSet];
+    [self sendCGMCPCommandBuffer:&command];
+}
+
+- (void)updateCommunicationInterval;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self.communicationPolicyEngine evaluatePolicyAtDate:[NSDate date]];
+    uint8_t intervalInMinutes = self.communicationPolicyEngine.communicationInterval;
+    if (!self.adaptsCommunicationInterval || ![self isConnected] || intervalInMinutes == self.adaptedCommunicationInterval) {
+        return;
+    }
+
+    // only one CGMCP procedure can be in progress, so the interval is set with a later measurement
+    if (self.settings.isRefreshing || self.calibrationManager.isRetrieving) {
+        return;
+    }
+    self.adaptedCommunicationInterval = intervalInMinutes;
+    if ([self.settings hasValueForSetting:CGMSettingCommunicationInterval] &&
+        [self.settings valueForSetting:CGMSettingCommunicationInterval] == intervalInMinutes) {
+        return;
+    }
+    [self setCommunicationInterval:intervalInMinutes];
 }
 
 - (void)disablePeriodicCommunication;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
     // set communication interval to 0x00
-    [self setCommunicationInterval:0x00];
+    [self setCommunicationInterval:kCGMCPCommunicationIntervalDisabled];
 }
 
 - (void)setFastestCommunicationInterval;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
     // set communication interval to 0xFF
-    [self setCommunicationInterval:0xFF];
+    [self setCommunicationInterval:kCGMCPCommunicationIntervalFastest];
 }
 
 - (void)setCalibrationValue:(shortFloat)value
@@ -283,57 +411,107 @@
              sampleLocation:(GlucoseSampleLocationOption)location
                        date:(NSDate*)date;
 {
-    NSMutableData *operand = [NSMutableData dataWithBytes:&value length:sizeof(shortFloat)];
-    uint16_t timeOffset = [self.sessionStartTime timeIntervalSinceDate:date] / kSecondsInMinute;
-    [operand appendBytes:&timeOffset length:sizeof(uint16_t)];
-    NSData *typeLocation = [NSData joinFluidType:type sampleLocation:location];
-    [operand appendData:typeLocation];
-    char ignoredBytes[] = {0x00, 0x00, 0x00, 0x00, 0x00};
-    [operand appendBytes:ignoredBytes length:sizeof(ignoredBytes)];
-    NSLog(@"operand is %@", operand);
-    [self sendCGMCPOpCode:CGMCPOpCodeCalibrationValueSet operandData:operand];
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self setCalibrationSFloat:CGMSFloatFromShortFloat(value) fluidType:type sampleLocation:location date:date];
+}
+
+- (void)setCalibrationGlucoseValue:(float)value
+                         fluidType:(GlucoseFluidTypeOption)type
+                    sampleLocation:(GlucoseSampleLocationOption)location
+                              date:(NSDate*)date;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self setCalibrationSFloat:CGMSFloatFromFloat(value) fluidType:type sampleLocation:location date:date];
+}
+
+- (void)setCalibrationSFloat:(uint16_t)value
+                   fluidType:(GlucoseFluidTypeOption)type
+              sampleLocation:(GlucoseSampleLocationOption)location
+                        date:(NSDate*)date;
+{
+    CGMCommandBuffer command;
+    CGMCommandBegin(&command, CGMCPOpCodeCalibrationValueSet);
+    CGMCommandAppendUInt16(&command, value);
+    uint16_t timeOffset = [self timeOffsetFromSessionStartTime:date];
+    CGMCommandAppendUInt16(&command, timeOffset);
+    CGMCommandAppendUInt8(&command, type | (location << 4));
+    // the next calibration time, record number and status are ignored by the sensor
+    for (NSUInteger index = 0; index < 5; index++) {
+        CGMCommandAppendUInt8(&command, 0x00);
+    }
+    [self sendCGMCPCommandBuffer:&command];
 }
 
 - (void)setPatientHighLevel:(shortFloat)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&value length:sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelPatientHighSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelPatientHighSet sfloatOperand:CGMSFloatFromShortFloat(value)];
+}
+
+- (void)setPatientHighLevelValue:(float)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelPatientHighSet sfloatOperand:CGMSFloatFromFloat(value)];
 }
 
 - (void)setPatientLowLevel:(shortFloat)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&value length:sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelPatientLowSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelPatientLowSet sfloatOperand:CGMSFloatFromShortFloat(value)];
+}
+
+- (void)setPatientLowLevelValue:(float)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelPatientLowSet sfloatOperand:CGMSFloatFromFloat(value)];
 }
 
 - (void)setHypoLevel:(shortFloat)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&value length:sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelHypoSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelHypoSet sfloatOperand:CGMSFloatFromShortFloat(value)];
+}
+
+- (void)setHypoLevelValue:(float)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelHypoSet sfloatOperand:CGMSFloatFromFloat(value)];
 }
 
 - (void)setHyperLevel:(shortFloat)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes:&value length:sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelHyperSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelHyperSet sfloatOperand:CGMSFloatFromShortFloat(value)];
+}
+
+- (void)setHyperLevelValue:(float)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelHyperSet sfloatOperand:CGMSFloatFromFloat(value)];
 }
 
 - (void)setRateDecreaseLevel:(shortFloat)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes: &value length: sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelRateDecreaseSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelRateDecreaseSet sfloatOperand:CGMSFloatFromShortFloat(value)];
+}
+
+- (void)setRateDecreaseLevelValue:(float)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelRateDecreaseSet sfloatOperand:CGMSFloatFromFloat(value)];
+}
+
+- (void)setRateIncreaseLevel:(shortFloat)value;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelRateIncreaseSet sfloatOperand:CGMSFloatFromShortFloat(value)];
 }
 
-- (void)setRateIncreaseLevel: (shortFloat)value;
+- (void)setRateIncreaseLevelValue:(float)value;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *operand = [NSData dataWithBytes: &value length: sizeof(shortFloat)];
-    [self sendCGMCPOpCode:CGMCPOpCodeAlertLevelRateIncreaseSet operandData:operand];
+    [self sendCGMCPSetOpCode:CGMCPOpCodeAlertLevelRateIncreaseSet sfloatOperand:CGMSFloatFromFloat(value)];
 }
 
 #pragma mark - Record Access Control Point
@@ -342,6 +520,12 @@
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
     if ([self isConnected]) {
+        // measurements received until the RACP response are stored records
+        uint8_t opCode = 0;
+        [command getBytes:&opCode length:sizeof(opCode)];
+        if (opCode == RACPOpCodeStoredRecordsReport) {
+            self.isRetrievingStoredRecords = YES;
+        }
         [self.bleController writeValue:command toCharacteristicUUID:kCGMCharacteristicUUIDRecordAccessControlPoint withServiceUUID:kCGMServiceUUID];
     } else {
         [self displayMessage:@"CGM not connected."];
@@ -366,28 +550,107 @@
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
     NSData *command = [NSData reportNumberOfAllStoredRecords];
+    self.storedRecordsCountFirstTimeOffset = 0;
     [self sendRACPCommand:command];
 }
 
 - (void)getNumberOfStoredRecordsGreatThanEqualTo:(NSDate*)date;
 {
     DLog(@"%s", __PRETTY_FUNCTION__);
-    NSData *command = [NSData reportNumberOfStoredRecordsGreaterThanOrEqualToTimeOffset:[self timeOffsetFromSessionStartTime:date]];
+    uint16_t timeOffset = [self timeOffsetFromSessionStartTime:date];
+    NSData *command = [NSData reportNumberOfStoredRecordsGreaterThanOrEqualToTimeOffset:timeOffset];
+    self.storedRecordsCountFirstTimeOffset = timeOffset;
     [self sendRACPCommand:command];
 }
 
-- (NSInteger)timeOffsetFromSessionStartTime:(NSDate*)date
+- (void)reconcileNextMissingRange
 {
-    if (self.sessionStartTime) {
-        // divide by integer to convert from float to int
-        return [date timeIntervalSinceDate:self.sessionStartTime] / 1;
-    } else {
-        [NSException raise:NSInvalidArgumentException
-                    format:@"%s: Need to know the session start time to calculate a time offet", __PRETTY_FUNCTION__];
-        return -1;
+    if (!self.shouldReconcileGaps || self.isRetrievingStoredRecords || self.gapDetector.numberOfMissingRanges == 0) {
+        return;
+    }
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    NSRange missingRange = [self.gapDetector missingRangeAtIndex:0];
+    self.reconcilingRange = missingRange;
+    NSData *command = [NSData reportStoredRecordsBetween:missingRange.location and:NSMaxRange(missingRange) - 1];
+    [self sendRACPCommand:command];
+}
+
+- (void)didCompleteReconcileWithResponseCode:(RACPResponseCode)responseCode
+{
+    NSRange missingRange = self.reconcilingRange;
+    self.reconcilingRange = NSMakeRange(NSNotFound, 0);
+    
+    // a range without stored records can not be reconciled either
+    if (responseCode == RACPSuccess || responseCode == RACPNoRecordsFound) {
+        [self.gapDetector removeMissingRange:missingRange];
+        self.numberOfReconcileAttempts = 0;
+        if ([self.delegate respondsToSelector:@selector(cgmController:didReconcileGapWithTimeOffsets:)]) {
+            [self.delegate cgmController:self didReconcileGapWithTimeOffsets:missingRange];
+        }
+        [self reconcileNextMissingRange];
+    } else if (++self.numberOfReconcileAttempts >= kCGMGapReconcileMaximumAttempts) {
+        DLog(@"%s: giving up missing range %@", __PRETTY_FUNCTION__, NSStringFromRange(missingRange));
+        [self.gapDetector removeMissingRange:missingRange];
+        self.numberOfReconcileAttempts = 0;
+    }
+}
+
+- (void)updateStoredRecordsBacklog
+{
+    // the counted records which have been received are no longer outstanding
+    NSUInteger backlog = self.numberOfStoredRecordsReported;
+    if (self.currentSession && self.storedRecordsCountRange.location != NSNotFound) {
+        NSUInteger numberOfRecordsReceived = [self.currentSession numberOfRecordsInRange:self.storedRecordsCountRange];
+        backlog = (backlog > numberOfRecordsReceived) ? backlog - numberOfRecordsReceived : 0;
+    }
+    if (backlog != self.communicationPolicyEngine.numberOfStoredRecords) {
+        self.communicationPolicyEngine.numberOfStoredRecords = backlog;
+        [self updateCommunicationInterval];
     }
 }
 
+- (uint16_t)timeOffsetFromSessionStartTime:(NSDate*)date
+{
+    if (!self.currentSession) {
+        // without a session start time the filter includes all records of the session
+        DLog(@"%s: session start time is not known", __PRETTY_FUNCTION__);
+        return 0;
+    }
+    NSInteger timeOffset = [self.currentSession.clock timeOffsetForDate:date];
+    return (uint16_t)MIN(MAX(timeOffset, 0), UINT16_MAX);
+}
+
+- (NSString*)sessionDeviceIdentifier
+{
+    return self.deviceIdentifier.UUIDString ?: self.cgmDeviceName ?: @"";
+}
+
+#pragma mark - Calibration Manager Delegate Methods
+
+- (void)calibrationManager:(UHNCGMCalibrationManager*)calibrationManager didReachNextCalibrationDate:(NSDate*)nextCalibrationDate forSession:(UHNCGMSession*)session
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    if ([self.delegate respondsToSelector:@selector(cgmController:didReachNextCalibrationDate:)]) {
+        [self.delegate cgmController:self didReachNextCalibrationDate:nextCalibrationDate];
+    }
+}
+
+#pragma mark - Glycemic Statistics
+
+- (UHNCGMGlucoseProfile*)glucoseProfileFromDate:(NSDate*)fromDate toDate:(NSDate*)toDate;
+{
+    DLog(@"%s", __PRETTY_FUNCTION__);
+    UHNCGMGlucoseProfile *profile = [[UHNCGMGlucoseProfile alloc] init];
+    NSInteger firstDay = [self localDayForDate:fromDate];
+    NSInteger lastDay = [self localDayForDate:toDate];
+    [self.dailyGlucoseProfiles enumerateKeysAndObjectsUsingBlock:^(NSNumber *day, UHNCGMGlucoseProfile *dailyProfile, BOOL *stop) {
+        if ([day integerValue] >= firstDay && [day integerValue] <= lastDay) {
+            [profile mergeProfile:dailyProfile];
+        }
+    }];
+    return profile;
+}
+
 #pragma mark - Battery Service Methods
 
 //- (void) getBatteryLevel;
@@ -402,6 +665,80 @@
 
 #pragma mark - Private Methods
 
+- (NSInteger)localDayForDate:(NSDate*)date
+{
+    NSInteger secondsFromGMT = [[NSTimeZone localTimeZone] secondsFromGMTForDate:date];
+    return (NSInteger)floor(([date timeIntervalSince1970] + secondsFromGMT) / (24 * kSecondsInHour));
+}
+
+- (void)evaluateAlertsForMeasurementDetails:(NSDictionary*)measurementDetails
+{
+    NSNumber *rateOfChange = [measurementDetails rateOfChange];
+    CGMAlertOption clearedAlerts = 0;
+    CGMAlertOption raisedAlerts = [self.alertEngine evaluateGlucoseConcentration:[measurementDetails[kCGMMeasurementKeyGlucoseConcentration] floatValue]
+                                                                   rateOfChange:(rateOfChange ? [rateOfChange floatValue] : NAN)
+                                                                         atDate:[NSDate date]
+                                                                  clearedAlerts:&clearedAlerts];
+    if (clearedAlerts && [self.delegate respondsToSelector:@selector(cgmController:didClearAlerts:)]) {
+        [self.delegate cgmController:self didClearAlerts:clearedAlerts];
+    }
+    if (raisedAlerts && [self.delegate respondsToSelector:@selector(cgmController:didRaiseAlerts:measurementDetails:)]) {
+        [self.delegate cgmController:self didRaiseAlerts:raisedAlerts measurementDetails:measurementDetails];
+    }
+}
+
+- (UHNCGMGapDetector*)gapDetector
+{
+    return self.currentSession ? self.currentSession.gapDetector : self.sessionlessGapDetector;
+}
+
+- (BOOL)isLiveReadingWithTimeOffset:(NSUInteger)timeOffset
+{
+    // stored records are older than the newest measurement received, or too old to act on
+    NSUInteger newestTimeOffset = self.gapDetector.newestTimeOffset;
+    if (newestTimeOffset != NSNotFound && timeOffset <= newestTimeOffset) {
+        return NO;
+    }
+    if (self.currentSession) {
+        NSDate *measurementDate = [self.currentSession.clock dateForTimeOffset:timeOffset];
+        return -[measurementDate timeIntervalSinceNow] <= kCGMAlertLiveMeasurementMaximumAge;
+    }
+    // without a session clock the age is not known, so the records of an ascending stored records transfer are not live
+    return !self.isRetrievingStoredRecords;
+}
+
+- (void)updateCommunicationPolicyForMeasurementDetails:(NSDictionary*)measurementDetails
+{
+    NSDate *measurementDate = measurementDetails[kCGMKeyDateTime];
+    if (measurementDate) {
+        [self.communicationPolicyEngine addNotificationWithLatency:MAX(0, -[measurementDate timeIntervalSinceNow])];
+    }
+    NSNumber *rateOfChange = [measurementDetails rateOfChange];
+    self.communicationPolicyEngine.activeAlerts = self.alertEngine.activeAlerts;
+    self.communicationPolicyEngine.rateOfChange = rateOfChange ? [rateOfChange floatValue] : NAN;
+    [self updateCommunicationInterval];
+}
+
+- (void)addMeasurementDetailsToGlucoseProfile:(NSDictionary*)measurementDetails
+{
+    NSDate *measurementDate = measurementDetails[kCGMKeyDateTime];
+    NSNumber *day = @([self localDayForDate:measurementDate]);
+    UHNCGMGlucoseProfile *dailyProfile = self.dailyGlucoseProfiles[day];
+    if (!dailyProfile) {
+        // the profile of the oldest day is evicted, unless the measurement is older than all the kept days
+        if (self.dailyGlucoseProfiles.count >= kCGMDailyGlucoseProfileMaximumDays) {
+            NSNumber *oldestDay = [self.dailyGlucoseProfiles.allKeys valueForKeyPath:@"@min.self"];
+            if ([day compare:oldestDay] == NSOrderedAscending) {
+                return;
+            }
+            [self.dailyGlucoseProfiles removeObjectForKey:oldestDay];
+        }
+        dailyProfile = [[UHNCGMGlucoseProfile alloc] init];
+        self.dailyGlucoseProfiles[day] = dailyProfile;
+    }
+    [dailyProfile addGlucoseConcentration:[measurementDetails[kCGMMeasurementKeyGlucoseConcentration] floatValue] atDate:measurementDate];
+}
+
 - (void)displayMessage:(NSString*)message {
     DLog(@"%s", __PRETTY_FUNCTION__);
 #ifdef DEBUG
@@ -431,6 +768,10 @@
 
 - (void)bleController:(UHNBLEController*)controller didConnectWithPeripheral:(NSString*)deviceName withServices:(NSArray*)services andUUID:(NSUUID*)uuid
 {
+    if (![uuid isEqual:self.deviceIdentifier]) {
+        // the settings of the previous sensor do not apply
+        [self.settings reset];
+    }
     self.deviceIdentifier = uuid;
     self.cgmDeviceName = deviceName;
     self.shouldBlockReconnect = NO;
@@ -440,6 +781,13 @@
 - (void)bleController:(UHNBLEController*)controller didDisconnectFromPeripheral:(NSString*)deviceName
 {
     DLog(@"Did cancel connection or disconnect with %@", deviceName);
+    self.isRetrievingStoredRecords = NO;
+    self.reconcilingRange = NSMakeRange(NSNotFound, 0);
+    self.adaptedCommunicationInterval = NSNotFound;
+
+    // a history walk would otherwise be resumed by an unrelated calibration response
+    [self.calibrationManager cancelRetrieval];
+    [self.settings cancelRefresh];
 
     // try to reconnect
     if (!self.shouldBlockReconnect)
@@ -476,6 +824,10 @@
         if ([self.delegate respondsToSelector:@selector(cgmController:notificationMeasurement:)]) {
             [self.delegate cgmController:self notificationMeasurement:notify];
         }
+        // missing ranges left over from a previous connection
+        if (notify) {
+            [self reconcileNextMissingRange];
+        }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDRecordAccessControlPoint]) {
         if ([self.delegate respondsToSelector:@selector(cgmController:notificationRACP:)]) {
             [self.delegate cgmController:self notificationRACP:notify];
@@ -501,49 +853,128 @@
     DLog(@"Characteristic %@ did update %@", charUUID, value);
     
     if ([charUUID isEqualToString: kCGMCharacteristicUUIDMeasurement]) {
-        NSMutableDictionary *measurementDetails = [[value parseMeasurementCharacteristicDetails:self.crcPresent] mutableCopy];
+        // the fields needed to index the measurement and derive its trend are read from the bytes, so the details are only created once
+        CGMMeasurementFields measurementFields = CGMMeasurementFieldsFromData(value);
+        NSUInteger timeOffset = measurementFields.timeOffset;
+        BOOL isLiveReading = [self isLiveReadingWithTimeOffset:timeOffset];
+        NSUInteger numberOfMissingRanges = self.gapDetector.numberOfMissingRanges;
         
-        // for convenience, add the measurement date/time as native NSDate, if possible
-        if (self.sessionStartTime) {
-            NSDate *measurementDate = [self.sessionStartTime dateByAddingTimeInterval:[measurementDetails[kCGMKeyTimeOffset] doubleValue]];
-            measurementDetails[kCGMKeyDateTime] = measurementDate;
+        BOOL isNewSessionRecord = NO;
+        if (self.currentSession) {
+            // the index of the session opens and fills the missing ranges of the session
+            isNewSessionRecord = [self.currentSession addRecordWithTimeOffset:timeOffset];
+            if (isNewSessionRecord && self.numberOfStoredRecordsReported > 0) {
+                [self updateStoredRecordsBacklog];
+            }
+        } else {
+            [self.sessionlessGapDetector addTimeOffset:timeOffset];
+        }
+        BOOL didOpenGap = self.gapDetector.numberOfMissingRanges > numberOfMissingRanges;
+
+        // derive the trend from the recent measurements for sensors that do not report it. Historical records are older than the
+        // window of the estimator and would reset it, so they have no derived trend
+        float derivedTrend = NAN;
+        if (isLiveReading) {
+            derivedTrend = [self.trendEstimator addGlucoseConcentration:measurementFields.glucoseConcentration
+                                                           atTimeOffset:timeOffset];
+        }
+        float rateOfChange = isnan(measurementFields.trendInformation) ? derivedTrend : measurementFields.trendInformation;
+
+        // for convenience, add the measurement date/time as native NSDate, if possible. The details are immutable once created
+        UHNCGMMeasurementDetails *measurementDetails = [[UHNCGMMeasurementDetails alloc] initWithMeasurementData:value
+                                                                                                       crcPresent:self.crcPresent
+                                                                                                     sessionClock:self.currentSession.clock
+                                                                                                        sessionID:(self.currentSession ? self.currentSession.sessionID : NSNotFound)
+                                                                                                     derivedTrend:derivedTrend
+                                                                                                       trendArrow:[UHNCGMTrendEstimator trendArrowForRateOfChange:rateOfChange]];
+
+        // historical records must not raise alerts, while live readings do even during a RACP procedure
+        if (isLiveReading) {
+            [self evaluateAlertsForMeasurementDetails:measurementDetails];
+            [self updateCommunicationPolicyForMeasurementDetails:measurementDetails];
+        }
+
+        // duplicate records (e.g. from overlapping record transfers) are only counted once. The index of the session outlives
+        // the statistics, so a record is added to the profile of its day only once
+        [self.statistics addMeasurementDetails:measurementDetails];
+        if (isNewSessionRecord) {
+            [self addMeasurementDetailsToGlucoseProfile:measurementDetails];
         }
 
-        NSLog(@"measurement details %@", measurementDetails);
+        DLog(@"measurement details %@", measurementDetails);
         if ([self.delegate respondsToSelector:@selector(cgmController:measurementDetails:)]) {
             [self.delegate cgmController:self measurementDetails:measurementDetails];
         }
+        if ([self.delegate respondsToSelector:@selector(cgmController:didReceiveMeasurement:)]) {
+            UHNCGMMeasurement *measurement = [[UHNCGMMeasurement alloc] initWithMeasurementDetails:measurementDetails];
+            [self.delegate cgmController:self didReceiveMeasurement:measurement];
+        }
+
+        // a range that could not be requested, e.g. during a RACP procedure of the app, is requested again with a later measurement
+        if (didOpenGap || isLiveReading) {
+            [self reconcileNextMissingRange];
+        }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDFeature]) {
         NSDictionary *cgmFeatures = [value parseFeatureCharacteristicDetails];
         
         // extract presence of CRC to use for future commands
         self.crcPresent = [cgmFeatures[kCGMFeatureKeyFeatures] unsignedIntegerValue] & CGMFeatureSupportedE2ECRC;
+        self.settings.supportedFeatures = [cgmFeatures[kCGMFeatureKeyFeatures] unsignedIntegerValue];
         
         if ([self.delegate respondsToSelector:@selector(cgmController:didReadFeatures:)]) {
             [self.delegate cgmController:self didReadFeatures:cgmFeatures];
         }
+        if ([self.delegate respondsToSelector:@selector(cgmController:didReceiveFeatures:)]) {
+            UHNCGMFeatures *features = [[UHNCGMFeatures alloc] initWithFeatureData:value];
+            [self.delegate cgmController:self didReceiveFeatures:features];
+        }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDStatus]) {
-        NSMutableDictionary *cgmStatus = [[value parseStatusCharacteristicDetails:self.crcPresent] mutableCopy];
+        BOOL shouldNotifyDelegate = [self.delegate respondsToSelector:@selector(cgmController:didReadStatus:)];
+        if (shouldNotifyDelegate || self.sessionAwaitingStopStatus) {
+            NSMutableDictionary *cgmStatus = [[value parseStatusCharacteristicDetails:self.crcPresent] mutableCopy];
+
+            // for convenience, add the status date/time as native NSDate, if possible
+            if (self.currentSession) {
+                cgmStatus[kCGMKeyDateTime] = [self.currentSession.clock dateForTimeOffset:[cgmStatus[kCGMKeyTimeOffset] unsignedIntegerValue]];
+                cgmStatus[kCGMKeySessionID] = @(self.currentSession.sessionID);
+            }
 
-        // for convenience, add the status date/time as native NSDate, if possible
-        if (self.sessionStartTime) {
-            NSDate *statusDate = [self.sessionStartTime dateByAddingTimeInterval:[cgmStatus[kCGMKeyTimeOffset] doubleValue]];
-            cgmStatus[kCGMKeyDateTime] = statusDate;
-        }
+            // the first status read after a session stopped is kept with the session
+            self.sessionAwaitingStopStatus.statusAtStop = cgmStatus;
+            self.sessionAwaitingStopStatus = nil;
 
-        if ([self.delegate respondsToSelector:@selector(cgmController:didReadStatus:)]) {
-            [self.delegate cgmController:self didReadStatus:cgmStatus];
+            if (shouldNotifyDelegate) {
+                [self.delegate cgmController:self didReadStatus:cgmStatus];
+            }
+        }
+        if ([self.delegate respondsToSelector:@selector(cgmController:didReceiveStatus:)]) {
+            UHNCGMStatus *status = [[UHNCGMStatus alloc] initWithStatusData:value session:self.currentSession];
+            [self.delegate cgmController:self didReceiveStatus:status];
         }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDSessionStartTime]) {
-        NSDate *sessionStartTime = [value parseSessionStartTime:self.crcPresent];
-        self.sessionStartTime = sessionStartTime;
+        int64_t sessionStartEpochTime = [value parseSessionStartEpochTime:self.crcPresent];
+        if (sessionStartEpochTime == kCGMEpochTimeUnknown) {
+            self.currentSession = nil;
+        } else if (self.currentSession.startEpochTime != sessionStartEpochTime) {
+            UHNCGMSession *session = [self.sessionManager sessionWithStartEpochTime:sessionStartEpochTime
+                                                                   deviceIdentifier:[self sessionDeviceIdentifier]];
+            if (self.currentSession && session != self.currentSession) {
+                // time offsets of a new session are not comparable to the previous session
+                [self.statistics reset];
+                [self.trendEstimator reset];
+            }
+            session.gapDetector.communicationInterval = self.gapDetector.communicationInterval;
+            [self.sessionlessGapDetector reset];
+            self.currentSession = session;
+        }
         if ([self.delegate respondsToSelector:@selector(cgmController:didReadSessionStartTime:)]) {
-            [self.delegate cgmController:self didReadSessionStartTime:sessionStartTime];
+            [self.delegate cgmController:self didReadSessionStartTime:self.currentSession.clock.sessionStartDate];
         }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDSessionRunTime]) {
         NSTimeInterval runtimeOffset = [value parseSessionRunTimeOffset:self.crcPresent];
+        self.currentSession.runTime = runtimeOffset;
         if ([self.delegate respondsToSelector: @selector(cgmController:didReadSessionRunTime:)]) {
-            [self.delegate cgmController: self didReadSessionRunTime: [self.sessionStartTime dateByAddingTimeInterval:runtimeOffset]];
+            [self.delegate cgmController: self didReadSessionRunTime: [self.currentSession.clock dateForTimeIntervalSinceSessionStart:runtimeOffset]];
         }
     } else if ([charUUID isEqualToString:kCGMCharacteristicUUIDSpecificOpsControlPoint]) {
         NSDictionary *responseDict = [value parseCGMCPResponse:self.crcPresent];
@@ -561,90 +992,135 @@
                     }
                     [self notifyDelegateCGMCPOpCodeSuccess: requestOpCode];
                 } else {
+                    BOOL isSettingsRequest = self.settings.isRefreshing && requestOpCode == self.settings.requestedOpCode;
+                    [self.settings didFailRequestOpCode:requestOpCode responseCode:responseCode];
+                    if (requestOpCode == CGMCPOpCodeCommIntervalSet) {
+                        // the interval was not set, so the adapted interval is sent again with a later measurement
+                        self.adaptedCommunicationInterval = NSNotFound;
+                    }
                     if ([self.delegate respondsToSelector:@selector(cgmController:CGMCPOperation:failed:)]) {
                         [self.delegate cgmController:self CGMCPOperation:requestOpCode failed:responseCode];
                     }
+                    if (isSettingsRequest) {
+                        // an unsupported setting does not end the refresh of the settings
+                        [self requestNextSetting];
+                    }
+                    if (requestOpCode == CGMCPOpCodeCalibrationValueGet && self.calibrationManager.isRetrieving) {
+                        // a missing record does not end the retrieval of the calibration history
+                        [self.calibrationManager didFailToRetrieveRecord];
+                        [self requestNextCalibrationDataRecord];
+                    }
                 }
                 break;
             }
             case CGMCPOpCodeCommIntervalResponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.gapDetector.communicationInterval = [value unsignedIntegerValue];
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetCommunicationInterval:)]) {
                     [self.delegate cgmController:self didGetCommunicationInterval:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelPatientHighResponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.statistics.levelPatientHigh = [value floatValue];
+                self.alertEngine.levelPatientHigh = [value floatValue];
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetPatientAlertLevelHigh:)]) {
                     [self.delegate cgmController:self didGetPatientAlertLevelHigh:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelPatientLowResponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.statistics.levelPatientLow = [value floatValue];
+                self.alertEngine.levelPatientLow = [value floatValue];
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetPatientAlertLevelLow:)]) {
                     [self.delegate cgmController:self didGetPatientAlertLevelLow:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelHypoReponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.statistics.levelHypo = [value floatValue];
+                self.alertEngine.levelHypo = [value floatValue];
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetAlertLevelHypo:)]) {
                     [self.delegate cgmController:self didGetAlertLevelHypo:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelHyperReponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.statistics.levelHyper = [value floatValue];
+                self.alertEngine.levelHyper = [value floatValue];
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetAlertLevelHyper:)]) {
                     [self.delegate cgmController:self didGetAlertLevelHyper:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelRateDecreaseResponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.alertEngine.levelRateDecrease = fabsf([value floatValue]);
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetAlertLevelRateDecrease:)]) {
                     [self.delegate cgmController:self didGetAlertLevelRateDecrease:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeAlertLevelRateIncreaseResponse:
             {
                 NSNumber *value = responseDict[kCGMCPKeyOperand];
+                self.alertEngine.levelRateIncrease = fabsf([value floatValue]);
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetAlertLevelRateIncrease:)]) {
                     [self.delegate cgmController:self didGetAlertLevelRateIncrease:value];
                 }
                 [self notifyDelegateDidGetCGMCPValue:value responseOpCode:responseOpCode];
+                [self updateSettingsWithValue:value responseOpCode:responseOpCode];
                 break;
             }
             case CGMCPOpCodeCalibrationValueResponse:
             {
+                NSDictionary *calibrationRecord = responseDict[kCGMCPKeyResponseCalibration];
+                if (self.currentSession) {
+                    [self.calibrationManager addCalibrationDetails:calibrationRecord forSession:self.currentSession];
+                }
+
                 if ([self.delegate respondsToSelector:@selector(cgmController:didGetCalibrationDetails:)]) {
-                    NSMutableDictionary *calibrationDetails = [responseDict[kCGMCPKeyResponseCalibration] mutableCopy];
+                    NSMutableDictionary *calibrationDetails = [calibrationRecord mutableCopy];
                 
                     // for convenience, add the calibration date/time as native NSDate, if possible
-                    if (self.sessionStartTime) {
-                        NSDate *calibrationDate = [self.sessionStartTime dateByAddingTimeInterval:[calibrationDetails[kCGMKeyTimeOffset] doubleValue]];
-                        NSDate *calibrationDateNext = [self.sessionStartTime dateByAddingTimeInterval:[calibrationDetails[kCGMKeyTimeOffsetNext] doubleValue]];
-                        calibrationDetails[kCGMKeyDateTime] = calibrationDate;
-                        calibrationDetails[kCGMKeyDateTimeNext] = calibrationDateNext;
+                    if (self.currentSession) {
+                        calibrationDetails[kCGMKeyDateTime] = [self.currentSession.clock dateForTimeOffset:[calibrationDetails[kCGMKeyTimeOffset] unsignedIntegerValue]];
+                        calibrationDetails[kCGMKeyDateTimeNext] = [self.currentSession.clock dateForTimeOffset:[calibrationDetails[kCGMKeyTimeOffsetNext] unsignedIntegerValue]];
+                        calibrationDetails[kCGMKeySessionID] = @(self.currentSession.sessionID);
                     }
 
                     [self.delegate cgmController:self didGetCalibrationDetails:calibrationDetails];
                 }
+                if ([self.delegate respondsToSelector:@selector(cgmController:didReceiveCalibration:)]) {
+                    UHNCGMCalibration *calibration = [[UHNCGMCalibration alloc] initWithCalibrationDetails:calibrationRecord session:self.currentSession];
+                    [self.delegate cgmController:self didReceiveCalibration:calibration];
+                }
+
+                if (self.calibrationManager.isRetrieving) {
+                    [self requestNextCalibrationDataRecord];
+                }
                 break;
             }
             default:
@@ -660,6 +1136,20 @@
                 NSDictionary *responseDetails = responseDict[kRACPKeyResponseCodeDetails];
                 RACPResponseCode responseCode = [responseDetails[kRACPKeyResponseCode] unsignedIntegerValue];
                 RACPOpCode requestOpCode = [responseDetails[kRACPKeyRequestOpCode] unsignedIntegerValue];
+                if (requestOpCode == RACPOpCodeStoredRecordsReport || requestOpCode == RACPOpCodeAbortOperation) {
+                    self.isRetrievingStoredRecords = NO;
+                    if (requestOpCode == RACPOpCodeStoredRecordsReport && responseCode == RACPSuccess &&
+                        !self.currentSession && self.reconcilingRange.location == NSNotFound) {
+                        // without a session the received records can not be counted, so only a completed report clears the backlog
+                        self.numberOfStoredRecordsReported = 0;
+                        [self updateStoredRecordsBacklog];
+                    }
+                }
+                if (requestOpCode == RACPOpCodeStoredRecordsReport && self.reconcilingRange.location != NSNotFound) {
+                    // the app did not request the range, so the response is not reported as its RACP procedure
+                    [self didCompleteReconcileWithResponseCode:responseCode];
+                    break;
+                }
                 if (responseCode == RACPSuccess) {
                     if ([self.delegate respondsToSelector:@selector(cgmController:RACPOperationSuccessful:)]) {
                         [self.delegate cgmController:self RACPOperationSuccessful:requestOpCode];
@@ -674,8 +1164,18 @@
             }
             case RACPOpCodeResponseStoredRecordsReportNumber:
             {
+                NSNumber *value = responseDict[kRACPKeyNumberOfRecords];
+                self.numberOfStoredRecordsReported = [value unsignedIntegerValue];
+                if (self.currentSession) {
+                    // the counted records are stored up to now
+                    NSInteger currentTimeOffset = [self.currentSession.clock timeOffsetForDate:[NSDate date]];
+                    NSUInteger lastTimeOffset = (NSUInteger)MAX(currentTimeOffset, (NSInteger)self.storedRecordsCountFirstTimeOffset);
+                    self.storedRecordsCountRange = NSMakeRange(self.storedRecordsCountFirstTimeOffset, lastTimeOffset - self.storedRecordsCountFirstTimeOffset + 1);
+                } else {
+                    self.storedRecordsCountRange = NSMakeRange(NSNotFound, 0);
+                }
+                [self updateStoredRecordsBacklog];
                 if ([self.delegate respondsToSelector: @selector(cgmController:didGetNumberOfStoredRecords:)]) {
-                    NSNumber *value = responseDict[kRACPKeyNumberOfRecords];
                     [self.delegate cgmController:self didGetNumberOfStoredRecords:value];
                 }
                 break;
@@ -711,6 +1211,7 @@
 
 - (void)notifyDelegateCGMCPOpCodeSuccess:(CGMCPOpCode)requestOpCode
 {
+    [self.settings didSucceedRequestOpCode:requestOpCode];
     switch (requestOpCode) {
         case CGMCPOpCodeCommIntervalSet:
             if ([self.delegate respondsToSelector:@selector(cgmControllerDidSetCommunicationInterval:)]) {
@@ -753,11 +1254,20 @@
             }
             break;
         case CGMCPOpCodeSessionStart:
+            // starting a session on the sensor stops its previous session, and the new session has its own start time
+            [self.sessionManager stopActiveSessionForDeviceIdentifier:[self sessionDeviceIdentifier] atEpochTime:(int64_t)[[NSDate date] timeIntervalSince1970]];
+            [self.calibrationManager cancelNextCalibrationReminder];
+            [self resetForNewSession];
             if ([self.delegate respondsToSelector:@selector(cgmControllerDidStartSession:)]) {
                 [self.delegate cgmControllerDidStartSession:self];
             }
             break;
         case CGMCPOpCodeSessionStop:
+            self.sessionAwaitingStopStatus = [self.sessionManager stopActiveSessionForDeviceIdentifier:[self sessionDeviceIdentifier] atEpochTime:(int64_t)[[NSDate date] timeIntervalSince1970]];
+            if (self.sessionAwaitingStopStatus) {
+                [self readStatus];
+            }
+            [self.calibrationManager cancelNextCalibrationReminder];
             if ([self.delegate respondsToSelector:@selector(cgmControllerDidStopSession:)]) {
                 [self.delegate cgmControllerDidStopSession:self];
             }
@@ -773,6 +1283,29 @@
     }
 }
 
+- (void)resetForNewSession
+{
+    // measurements of the new session are only assigned to it once its start time has been read
+    self.sessionlessGapDetector.communicationInterval = self.gapDetector.communicationInterval;
+    self.currentSession = nil;
+    [self.statistics reset];
+    [self.trendEstimator reset];
+    [self.sessionlessGapDetector reset];
+    self.numberOfStoredRecordsReported = 0;
+    self.storedRecordsCountRange = NSMakeRange(NSNotFound, 0);
+    [self updateStoredRecordsBacklog];
+    [self readSessionStartTime];
+}
+
+- (void)updateSettingsWithValue:(NSNumber*)value responseOpCode:(CGMCPOpCode)responseOpCode
+{
+    BOOL isSettingsResponse = self.settings.isRefreshing && responseOpCode == self.settings.requestedOpCode + 1;
+    [self.settings updateValue:[value floatValue] forResponseOpCode:responseOpCode];
+    if (isSettingsResponse) {
+        [self requestNextSetting];
+    }
+}
+
 - (void)notifyDelegateDidGetCGMCPValue:(NSNumber*)value responseOpCode:(CGMCPOpCode)responseOpCode
 {
     if ([self.delegate respondsToSelector:@selector(cgmController:CGMCPResponseOpCode:didGetValue:)]) {
@@ -0,0 +1,89 @@
+//
+//  UHNCGMFeatures.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+
+/**
+ Determine if all of the features are supported
+ */
+static inline BOOL CGMFeaturesSupport(uint32_t features, CGMFeatureOption options)
+{
+    return (features & options) == options;
+}
+
+/**
+ `UHNCGMFeatures` is an immutable record of the CGM feature characteristic, with the 24 bit feature word kept as one integer.
+ 
+ The features are tested with `CGMFeaturesSupport`, which is inlined, instead of a dictionary lookup per feature.
+ 
+ */
+@interface UHNCGMFeatures : NSObject <NSCopying>
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a features record
+ 
+ @param data The value of the CGM feature characteristic
+ 
+ @return The features record
+ 
+ */
+- (instancetype)initWithFeatureData:(NSData*)data;
+
+///---------------
+/// @name Features
+///---------------
+
+/**
+ The supported features as `CGMFeatureOption` flags
+ */
+@property(nonatomic,readonly) uint32_t features;
+
+/**
+ The fluid type of the glucose concentration
+ */
+@property(nonatomic,readonly) GlucoseFluidTypeOption fluidType;
+
+/**
+ The sample location of the glucose concentration
+ */
+@property(nonatomic,readonly) GlucoseSampleLocationOption sampleLocation;
+
+/**
+ Determine if all of the features are supported
+ 
+ @param options The `CGMFeatureOption` flags
+ 
+ @return YES if all of the features are supported, otherwise NO
+ 
+ */
+- (BOOL)supportsFeatures:(CGMFeatureOption)options;
+
+@end
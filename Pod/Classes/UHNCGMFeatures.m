@@ -0,0 +1,42 @@
+//
+//  UHNCGMFeatures.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMFeatures.h"
+
+@implementation UHNCGMFeatures
+
+#pragma mark - Initialization
+
+- (instancetype)initWithFeatureData:(NSData*)data;
+{
+    if ((self = [super init])) {
+        // the feature word and the type/location nibbles, without the E2E-CRC
+        uint8_t bytes[4] = {0};
+        [data getBytes:bytes length:MIN(data.length, sizeof(bytes))];
+        NSUInteger index = kCGMFeatureFieldRangeFeatures.location;
+        _features = (uint32_t)(bytes[index] | (bytes[index + 1] << 8) | (bytes[index + 2] << 16));
+        uint8_t typeAndLocation = bytes[kCGMFeatureFieldRangeTypeLocation.location];
+        _fluidType = typeAndLocation & 0x0F;
+        _sampleLocation = typeAndLocation >> 4;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    return self;
+}
+
+#pragma mark - Features
+
+- (BOOL)supportsFeatures:(CGMFeatureOption)options;
+{
+    return CGMFeaturesSupport(self.features, options);
+}
+
+@end
@@ -0,0 +1,121 @@
+//
+//  UHNCGMGapDetector.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+///-------------------------------
+/// @name Gap Detector Definitions
+///-------------------------------
+/**
+ The communication interval value indicating the fastest interval supported by the CGM sensor, which is assumed to be one minute
+ */
+#define kCGMGapDetectorFastestCommunicationInterval     0xFF
+
+/**
+ A gap is detected when two consecutive time offsets are further apart than the expected interval multiplied by this tolerance
+ */
+#define kCGMGapDetectorIntervalTolerance                1.5
+
+/**
+ `UHNCGMGapDetector` detects gaps in the measurement stream, for example when the CGM sensor was out of range, and keeps a compact sorted set of the missing time offset ranges.
+
+ The expected interval between measurements is the communication interval of the CGM sensor, if known, otherwise the shortest interval observed between consecutive measurements. A measurement that arrives later than expected opens a missing range between it and the previous measurement.
+
+ Missing ranges are filled by stored records, which are reported in ascending order of time offset: a record within a missing range fills the range up to and including its time offset. A range is removed when a RACP procedure covering it has completed.
+
+ */
+@interface UHNCGMGapDetector : NSObject
+
+///-----------------------
+/// @name Expected Cadence
+///-----------------------
+
+/**
+ The communication interval of the CGM sensor in minutes, or 0 if not known or periodic communication is disabled. `kCGMGapDetectorFastestCommunicationInterval` is treated as one minute
+ */
+@property(nonatomic,assign) NSUInteger communicationInterval;
+
+/**
+ The expected interval between measurements in minutes, or 0 if not known yet
+ */
+@property(nonatomic,readonly) NSUInteger expectedInterval;
+
+///-------------------
+/// @name Time Offsets
+///-------------------
+
+/**
+ The newest time offset in minutes, or `NSNotFound` if no measurement was added
+ */
+@property(nonatomic,readonly) NSUInteger newestTimeOffset;
+
+/**
+ Add the time offset of a measurement
+
+ @param timeOffset The time offset of the measurement in minutes
+
+ @return YES if the time offset opened a new missing range, otherwise NO
+
+ */
+- (BOOL)addTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Remove the time offsets of a range from the missing ranges, once the range has been reconciled
+
+ @param range The reconciled range of time offsets
+
+ */
+- (void)removeMissingRange:(NSRange)range;
+
+/**
+ Remove all missing ranges up to and including the newest time offset
+ */
+- (void)removeAllMissingRanges;
+
+/**
+ Remove all time offsets and missing ranges, keeping the communication interval
+ */
+- (void)reset;
+
+///---------------------
+/// @name Missing Ranges
+///---------------------
+
+/**
+ The number of missing ranges
+ */
+@property(nonatomic,readonly) NSUInteger numberOfMissingRanges;
+
+/**
+ The missing range at an index, in ascending order of time offset
+
+ @param index The index of the missing range
+
+ @return The range of missing time offsets. `location` is the first missing time offset and `length` the number of minutes
+
+ */
+- (NSRange)missingRangeAtIndex:(NSUInteger)index;
+
+@end
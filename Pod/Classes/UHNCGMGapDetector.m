@@ -0,0 +1,193 @@
+//
+//  UHNCGMGapDetector.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMGapDetector.h"
+
+typedef struct CGMMissingRange {
+    NSUInteger first;
+    NSUInteger last;
+} CGMMissingRange;
+
+@interface UHNCGMGapDetector ()
+{
+    // sorted, non-overlapping missing ranges
+    CGMMissingRange *_ranges;
+    NSUInteger _capacity;
+}
+@property(nonatomic,readwrite) NSUInteger newestTimeOffset;
+@property(nonatomic,readwrite) NSUInteger numberOfMissingRanges;
+@property(nonatomic,assign) NSUInteger observedInterval;
+@end
+
+@implementation UHNCGMGapDetector
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        _capacity = 8;
+        _ranges = malloc(_capacity * sizeof(CGMMissingRange));
+        [self reset];
+    }
+    return self;
+}
+
+- (void)dealloc;
+{
+    free(_ranges);
+}
+
+- (void)reset;
+{
+    self.newestTimeOffset = NSNotFound;
+    self.numberOfMissingRanges = 0;
+    self.observedInterval = 0;
+}
+
+#pragma mark - Expected Cadence
+
+- (NSUInteger)expectedInterval;
+{
+    if (self.communicationInterval == kCGMGapDetectorFastestCommunicationInterval) {
+        return 1;
+    } else if (self.communicationInterval > 0) {
+        return self.communicationInterval;
+    }
+    return self.observedInterval;
+}
+
+#pragma mark - Time Offsets
+
+- (BOOL)addTimeOffset:(NSUInteger)timeOffset;
+{
+    if (self.newestTimeOffset == NSNotFound) {
+        self.newestTimeOffset = timeOffset;
+        return NO;
+    }
+
+    if (timeOffset <= self.newestTimeOffset) {
+        // a stored record fills the missing range it falls in up to its time offset
+        NSUInteger index = [self indexOfRangeContainingTimeOffset:timeOffset];
+        if (index != NSNotFound) {
+            [self removeFirst:_ranges[index].first last:timeOffset];
+        }
+        return NO;
+    }
+
+    NSUInteger interval = timeOffset - self.newestTimeOffset;
+    NSUInteger expectedInterval = self.expectedInterval;
+    BOOL didOpenRange = NO;
+    if (expectedInterval > 0 && interval > expectedInterval * kCGMGapDetectorIntervalTolerance) {
+        [self addFirst:self.newestTimeOffset + 1 last:timeOffset - 1];
+        didOpenRange = YES;
+    } else if (self.observedInterval == 0 || interval < self.observedInterval) {
+        self.observedInterval = interval;
+    }
+    self.newestTimeOffset = timeOffset;
+    return didOpenRange;
+}
+
+- (void)removeMissingRange:(NSRange)range;
+{
+    if (range.length == 0) {
+        return;
+    }
+    [self removeFirst:range.location last:NSMaxRange(range) - 1];
+}
+
+- (void)removeAllMissingRanges;
+{
+    self.numberOfMissingRanges = 0;
+}
+
+#pragma mark - Missing Ranges
+
+- (NSRange)missingRangeAtIndex:(NSUInteger)index;
+{
+    if (index >= self.numberOfMissingRanges) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+    return NSMakeRange(_ranges[index].first, _ranges[index].last - _ranges[index].first + 1);
+}
+
+#pragma mark - Private Methods
+
+- (NSUInteger)indexOfRangeContainingTimeOffset:(NSUInteger)timeOffset;
+{
+    // binary search for the last range starting at or before the time offset
+    NSUInteger low = 0;
+    NSUInteger high = self.numberOfMissingRanges;
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if (_ranges[middle].first <= timeOffset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low > 0 && _ranges[low - 1].last >= timeOffset) {
+        return low - 1;
+    }
+    return NSNotFound;
+}
+
+- (void)addFirst:(NSUInteger)first last:(NSUInteger)last;
+{
+    // new ranges are opened after the newest time offset, so they are appended, merging with an adjacent range
+    NSUInteger count = self.numberOfMissingRanges;
+    if (count > 0 && _ranges[count - 1].last + 1 >= first) {
+        _ranges[count - 1].last = MAX(_ranges[count - 1].last, last);
+        return;
+    }
+    if (count == _capacity) {
+        _capacity *= 2;
+        _ranges = realloc(_ranges, _capacity * sizeof(CGMMissingRange));
+    }
+    _ranges[count].first = first;
+    _ranges[count].last = last;
+    self.numberOfMissingRanges = count + 1;
+}
+
+- (void)removeFirst:(NSUInteger)first last:(NSUInteger)last;
+{
+    NSUInteger count = self.numberOfMissingRanges;
+
+    // removing from the middle of a range splits it in two
+    NSUInteger index = [self indexOfRangeContainingTimeOffset:first];
+    if (index != NSNotFound && _ranges[index].first < first && _ranges[index].last > last) {
+        if (count == _capacity) {
+            _capacity *= 2;
+            _ranges = realloc(_ranges, _capacity * sizeof(CGMMissingRange));
+        }
+        memmove(&_ranges[index + 1], &_ranges[index], (count - index) * sizeof(CGMMissingRange));
+        _ranges[index].last = first - 1;
+        _ranges[index + 1].first = last + 1;
+        self.numberOfMissingRanges = count + 1;
+        return;
+    }
+
+    // otherwise the overlapping ranges are trimmed or dropped
+    NSUInteger writeIndex = 0;
+    for (NSUInteger readIndex = 0; readIndex < count; readIndex++) {
+        CGMMissingRange range = _ranges[readIndex];
+        if (range.last >= first && range.first <= last) {
+            if (range.first < first) {
+                range.last = first - 1;
+            } else if (range.last > last) {
+                range.first = last + 1;
+            } else {
+                continue;
+            }
+        }
+        _ranges[writeIndex++] = range;
+    }
+    self.numberOfMissingRanges = writeIndex;
+}
+
+@end
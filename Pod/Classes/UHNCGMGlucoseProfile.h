@@ -0,0 +1,140 @@
+//
+//  UHNCGMGlucoseProfile.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+///---------------------------------
+/// @name Glucose Profile Definitions
+///---------------------------------
+/**
+ Number of time of day buckets, each covering 30 minutes
+ */
+#define kCGMGlucoseProfileNumberOfBuckets           48
+#define kCGMGlucoseProfileMinutesPerBucket          (24 * 60 / kCGMGlucoseProfileNumberOfBuckets)
+
+/**
+ The glucose domain (mg/dl) of the histogram of each bucket. Readings outside the domain are counted in the first or last bin.
+ */
+#define kCGMGlucoseProfileMaximumGlucose            600
+#define kCGMGlucoseProfileBinWidth                  2
+#define kCGMGlucoseProfileNumberOfBins              (kCGMGlucoseProfileMaximumGlucose / kCGMGlucoseProfileBinWidth)
+
+/**
+ Percentiles of the ambulatory glucose profile for one time of day bucket. All values are `NAN` if the bucket has no readings.
+ */
+typedef struct CGMGlucoseProfilePercentiles {
+    /** 5th percentile (mg/dl) */
+    float percentile5;
+    /** 25th percentile (mg/dl) */
+    float percentile25;
+    /** Median (mg/dl) */
+    float percentile50;
+    /** 75th percentile (mg/dl) */
+    float percentile75;
+    /** 95th percentile (mg/dl) */
+    float percentile95;
+} CGMGlucoseProfilePercentiles;
+
+/**
+ `UHNCGMGlucoseProfile` is a quantile sketch for ambulatory glucose profile (AGP) reports. Each 30 minute time of day bucket holds a fixed-bin histogram of the glucose readings, so readings are added in O(1) and percentiles are answered without sorting any readings.
+
+ Profiles are mergeable, allowing an AGP over any date range to be built by merging the profiles of single days, sessions, or devices. Profiles support `NSCoding` so they can be persisted and merged later.
+
+ @discussion Percentiles are interpolated within a histogram bin and are therefore accurate to within `kCGMGlucoseProfileBinWidth` mg/dl.
+
+ */
+@interface UHNCGMGlucoseProfile : NSObject <NSCoding, NSCopying>
+
+///------------------------
+/// @name Adding Readings
+///------------------------
+
+/**
+ Add a glucose reading to the bucket of the local time of day of the reading
+
+ @param glucoseConcentration The glucose concentration in mg/dl
+ @param date The date and time of the reading
+
+ */
+- (void)addGlucoseConcentration:(float)glucoseConcentration atDate:(NSDate*)date;
+
+/**
+ Add a glucose reading to the bucket of the time of day
+
+ @param glucoseConcentration The glucose concentration in mg/dl
+ @param minuteOfDay The time of day of the reading in minutes since midnight
+
+ */
+- (void)addGlucoseConcentration:(float)glucoseConcentration atMinuteOfDay:(NSUInteger)minuteOfDay;
+
+/**
+ Merge the readings of another profile into this profile
+
+ @param profile The profile to be merged
+
+ */
+- (void)mergeProfile:(UHNCGMGlucoseProfile*)profile;
+
+///-----------------------
+/// @name Querying Results
+///-----------------------
+
+/**
+ Total number of readings in the profile
+ */
+@property(nonatomic,readonly) NSUInteger numberOfReadings;
+
+/**
+ Number of readings in a time of day bucket
+
+ @param bucket The index of the time of day bucket (0 to `kCGMGlucoseProfileNumberOfBuckets` - 1)
+
+ @return The number of readings in the bucket
+
+ */
+- (NSUInteger)numberOfReadingsInBucket:(NSUInteger)bucket;
+
+/**
+ Percentile of the readings in a time of day bucket
+
+ @param percentile The percentile of interest (0 to 100)
+ @param bucket The index of the time of day bucket (0 to `kCGMGlucoseProfileNumberOfBuckets` - 1)
+
+ @return The glucose concentration (mg/dl) of the percentile or `NAN` if the bucket has no readings
+
+ */
+- (float)percentile:(double)percentile inBucket:(NSUInteger)bucket;
+
+/**
+ The AGP percentiles (5th, 25th, 50th, 75th, and 95th) of a time of day bucket
+
+ @param bucket The index of the time of day bucket (0 to `kCGMGlucoseProfileNumberOfBuckets` - 1)
+
+ @return The percentiles of the bucket
+
+ */
+- (CGMGlucoseProfilePercentiles)percentilesInBucket:(NSUInteger)bucket;
+
+@end
@@ -0,0 +1,180 @@
+//
+//  UHNCGMGlucoseProfile.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMGlucoseProfile.h"
+
+#define kCGMGlucoseProfileCoderKeyCounts @"CGMGlucoseProfileCounts"
+#define kCGMGlucoseProfileSizeOfCounts (kCGMGlucoseProfileNumberOfBuckets * kCGMGlucoseProfileNumberOfBins * sizeof(uint32_t))
+
+@interface UHNCGMGlucoseProfile ()
+{
+    // histogram bins of all buckets, indexed by [bucket * kCGMGlucoseProfileNumberOfBins + bin]
+    uint32_t *_counts;
+    NSUInteger _bucketTotals[kCGMGlucoseProfileNumberOfBuckets];
+}
+@property(nonatomic,readwrite) NSUInteger numberOfReadings;
+@end
+
+@implementation UHNCGMGlucoseProfile
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        _counts = calloc(kCGMGlucoseProfileNumberOfBuckets * kCGMGlucoseProfileNumberOfBins, sizeof(uint32_t));
+    }
+    return self;
+}
+
+- (void)dealloc;
+{
+    free(_counts);
+}
+
+#pragma mark - NSCoding
+
+- (instancetype)initWithCoder:(NSCoder*)aDecoder;
+{
+    if ((self = [self init])) {
+        NSData *counts = [aDecoder decodeObjectForKey:kCGMGlucoseProfileCoderKeyCounts];
+        if ([counts length] == kCGMGlucoseProfileSizeOfCounts) {
+            memcpy(_counts, [counts bytes], kCGMGlucoseProfileSizeOfCounts);
+            [self recalculateTotals];
+        }
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder*)aCoder;
+{
+    [aCoder encodeObject:[NSData dataWithBytes:_counts length:kCGMGlucoseProfileSizeOfCounts] forKey:kCGMGlucoseProfileCoderKeyCounts];
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    UHNCGMGlucoseProfile *profile = [[[self class] allocWithZone:zone] init];
+    [profile mergeProfile:self];
+    return profile;
+}
+
+#pragma mark - Adding Readings
+
+- (void)addGlucoseConcentration:(float)glucoseConcentration atDate:(NSDate*)date;
+{
+    // local time of day without the cost of calendar components
+    NSInteger secondsFromGMT = [[NSTimeZone localTimeZone] secondsFromGMTForDate:date];
+    long long localSeconds = (long long)floor([date timeIntervalSince1970]) + secondsFromGMT;
+    long long secondOfDay = localSeconds % (24 * 60 * 60);
+    if (secondOfDay < 0) {
+        secondOfDay += 24 * 60 * 60;
+    }
+    [self addGlucoseConcentration:glucoseConcentration atMinuteOfDay:(NSUInteger)(secondOfDay / 60)];
+}
+
+- (void)addGlucoseConcentration:(float)glucoseConcentration atMinuteOfDay:(NSUInteger)minuteOfDay;
+{
+    // e.g. the SFLOAT special values, which can not be binned
+    if (!isfinite(glucoseConcentration)) {
+        return;
+    }
+    NSUInteger bucket = (minuteOfDay / kCGMGlucoseProfileMinutesPerBucket) % kCGMGlucoseProfileNumberOfBuckets;
+    _counts[bucket * kCGMGlucoseProfileNumberOfBins + [self binForGlucoseConcentration:glucoseConcentration]]++;
+    _bucketTotals[bucket]++;
+    self.numberOfReadings++;
+}
+
+- (void)mergeProfile:(UHNCGMGlucoseProfile*)profile;
+{
+    if (!profile) {
+        return;
+    }
+    NSUInteger numberOfCounts = kCGMGlucoseProfileNumberOfBuckets * kCGMGlucoseProfileNumberOfBins;
+    for (NSUInteger index = 0; index < numberOfCounts; index++) {
+        _counts[index] += profile->_counts[index];
+    }
+    for (NSUInteger bucket = 0; bucket < kCGMGlucoseProfileNumberOfBuckets; bucket++) {
+        _bucketTotals[bucket] += profile->_bucketTotals[bucket];
+    }
+    self.numberOfReadings += profile.numberOfReadings;
+}
+
+#pragma mark - Querying Results
+
+- (NSUInteger)numberOfReadingsInBucket:(NSUInteger)bucket;
+{
+    if (bucket >= kCGMGlucoseProfileNumberOfBuckets) {
+        return 0;
+    }
+    return _bucketTotals[bucket];
+}
+
+- (float)percentile:(double)percentile inBucket:(NSUInteger)bucket;
+{
+    NSUInteger total = [self numberOfReadingsInBucket:bucket];
+    if (total == 0) {
+        return NAN;
+    }
+
+    // find the bin holding the rank and interpolate within the bin
+    double rank = MIN(MAX(percentile, 0.), 100.) / 100. * total;
+    uint32_t *bins = &_counts[bucket * kCGMGlucoseProfileNumberOfBins];
+    NSUInteger cumulativeCount = 0;
+    for (NSUInteger bin = 0; bin < kCGMGlucoseProfileNumberOfBins; bin++) {
+        if (bins[bin] == 0) {
+            continue;
+        }
+        if (cumulativeCount + bins[bin] >= rank) {
+            double fraction = (rank - cumulativeCount) / bins[bin];
+            return (float)((bin + fraction) * kCGMGlucoseProfileBinWidth);
+        }
+        cumulativeCount += bins[bin];
+    }
+    return kCGMGlucoseProfileMaximumGlucose;
+}
+
+- (CGMGlucoseProfilePercentiles)percentilesInBucket:(NSUInteger)bucket;
+{
+    CGMGlucoseProfilePercentiles percentiles;
+    percentiles.percentile5 = [self percentile:5 inBucket:bucket];
+    percentiles.percentile25 = [self percentile:25 inBucket:bucket];
+    percentiles.percentile50 = [self percentile:50 inBucket:bucket];
+    percentiles.percentile75 = [self percentile:75 inBucket:bucket];
+    percentiles.percentile95 = [self percentile:95 inBucket:bucket];
+    return percentiles;
+}
+
+#pragma mark - Private Methods
+
+- (NSUInteger)binForGlucoseConcentration:(float)glucoseConcentration;
+{
+    if (glucoseConcentration <= 0) {
+        return 0;
+    }
+    NSUInteger bin = (NSUInteger)(glucoseConcentration / kCGMGlucoseProfileBinWidth);
+    return MIN(bin, kCGMGlucoseProfileNumberOfBins - 1);
+}
+
+- (void)recalculateTotals;
+{
+    NSUInteger numberOfReadings = 0;
+    for (NSUInteger bucket = 0; bucket < kCGMGlucoseProfileNumberOfBuckets; bucket++) {
+        NSUInteger bucketTotal = 0;
+        uint32_t *bins = &_counts[bucket * kCGMGlucoseProfileNumberOfBins];
+        for (NSUInteger bin = 0; bin < kCGMGlucoseProfileNumberOfBins; bin++) {
+            bucketTotal += bins[bin];
+        }
+        _bucketTotals[bucket] = bucketTotal;
+        numberOfReadings += bucketTotal;
+    }
+    self.numberOfReadings = numberOfReadings;
+}
+
+@end
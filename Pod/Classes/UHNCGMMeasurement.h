@@ -0,0 +1,108 @@
+//
+//  UHNCGMMeasurement.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+#import "UHNCGMStatus.h"
+#import "UHNCGMMeasurementDetails.h"
+
+/**
+ `UHNCGMMeasurement` is an immutable record of a CGM measurement, with typed fields and the sensor status annunciation packed in one integer, for consumers that keep many measurements.
+ 
+ The flags of the sensor status are tested with `CGMSensorStatusHasStatus`, `CGMSensorStatusHasCalTemp` and `CGMSensorStatusHasWarning`.
+ 
+ */
+@interface UHNCGMMeasurement : NSObject <NSCopying>
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a measurement record
+ 
+ @param measurementDetails The measurement details, including the details added by the `UHNCGMController`
+ 
+ @return The measurement record
+ 
+ */
+- (instancetype)initWithMeasurementDetails:(UHNCGMMeasurementDetails*)measurementDetails;
+
+///------------------
+/// @name Measurement
+///------------------
+
+/**
+ The glucose concentration in mg/dl
+ */
+@property(nonatomic,readonly) float glucoseConcentration;
+
+/**
+ The time offset from the session start time in minutes
+ */
+@property(nonatomic,readonly) uint16_t timeOffset;
+
+/**
+ The packed sensor status annunciation, with the octets that are not present cleared
+ */
+@property(nonatomic,readonly) CGMSensorStatus sensorStatus;
+
+/**
+ The trend information reported by the CGM sensor in (mg/dl)/min, or `NAN` if not present
+ */
+@property(nonatomic,readonly) float trendInformation;
+
+/**
+ The trend derived from the recent measurements in (mg/dl)/min, or `NAN` if not known
+ */
+@property(nonatomic,readonly) float derivedTrend;
+
+/**
+ The rate of change in (mg/dl)/min, which is the reported trend information if present, otherwise the derived trend
+ */
+@property(nonatomic,readonly) float rateOfChange;
+
+/**
+ The trend arrow of the rate of change
+ */
+@property(nonatomic,readonly) CGMTrendArrowOption trendArrow;
+
+/**
+ The measurement quality in %, or `NAN` if not present
+ */
+@property(nonatomic,readonly) float quality;
+
+/**
+ The identifier of the session of the measurement, or `NSNotFound` if not known
+ */
+@property(nonatomic,readonly) NSUInteger sessionID;
+
+/**
+ The date/time of the measurement, or nil if the session start time is not known
+ */
+@property(nonatomic,readonly) NSDate *date;
+
+@end
@@ -0,0 +1,52 @@
+//
+//  UHNCGMMeasurement.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMMeasurement.h"
+
+@interface UHNCGMMeasurement ()
+@property(nonatomic,strong) UHNCGMSessionClock *clock;
+@end
+
+@implementation UHNCGMMeasurement
+
+#pragma mark - Initialization
+
+- (instancetype)initWithMeasurementDetails:(UHNCGMMeasurementDetails*)measurementDetails;
+{
+    if ((self = [super init])) {
+        _glucoseConcentration = measurementDetails.glucoseConcentration;
+        _timeOffset = (uint16_t)measurementDetails.timeOffset;
+        _sensorStatus = measurementDetails.sensorStatus;
+        _trendInformation = measurementDetails.trendInformation;
+        _derivedTrend = measurementDetails.derivedTrend;
+        _trendArrow = measurementDetails.trendArrow;
+        _quality = measurementDetails.quality;
+        _sessionID = measurementDetails.sessionID;
+        _clock = measurementDetails.sessionClock;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    return self;
+}
+
+#pragma mark - Measurement
+
+- (float)rateOfChange;
+{
+    return isnan(self.trendInformation) ? self.derivedTrend : self.trendInformation;
+}
+
+- (NSDate*)date;
+{
+    return [self.clock dateForTimeOffset:self.timeOffset];
+}
+
+@end
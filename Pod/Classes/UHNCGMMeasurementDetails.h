@@ -0,0 +1,181 @@
+//
+//  UHNCGMMeasurementDetails.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+#import "UHNCGMSessionClock.h"
+#import "UHNCGMStatus.h"
+
+///-------------------------
+/// @name Measurement Layout
+///-------------------------
+/**
+ The byte index of each optional field of a measurement, or 0 if the field is not present, and the length of the measurement up to and including the last field
+ */
+typedef struct CGMMeasurementLayout {
+    uint8_t statusIndex;
+    uint8_t calTempIndex;
+    uint8_t warningIndex;
+    uint8_t trendIndex;
+    uint8_t qualityIndex;
+    uint8_t length;
+} CGMMeasurementLayout;
+
+/**
+ The number of distinct combinations of the measurement flags, i.e. the size of the table of layouts
+ */
+#define kCGMMeasurementLayoutCount      32
+
+/**
+ The layout of a measurement with all the fields indicated by the flags, looked up in a table built at compile time
+ */
+extern CGMMeasurementLayout CGMMeasurementLayoutForFlags(uint8_t flags);
+
+/**
+ The layout of a measurement of a given length, computed field by field. Fields indicated by the flags which do not fit the length are not present
+ */
+extern CGMMeasurementLayout CGMMeasurementLayoutMake(uint8_t flags, NSUInteger length);
+
+/**
+ The fields of a measurement needed before its details are created, e.g. to index the measurement and derive its trend
+ */
+typedef struct CGMMeasurementFields {
+    NSUInteger timeOffset;
+    float glucoseConcentration;
+    float trendInformation;
+} CGMMeasurementFields;
+
+/**
+ The time offset in minutes, the glucose concentration in mg/dl and the trend information in (mg/dl)/min, or `NAN` if not present, decoded from the value of the measurement characteristic without creating the measurement details
+ */
+extern CGMMeasurementFields CGMMeasurementFieldsFromData(NSData *data);
+
+/**
+ `UHNCGMMeasurementDetails` is an immutable dictionary of the measurement details backed by the raw bytes of the measurement characteristic. Each field is only decoded and boxed when its key is looked up, so consumers that only use a few fields, e.g. `glucoseValue` and `measurementDateTime` of `NSDictionary+CGMExtensions`, do not pay for the others.
+ 
+ The keys and values are the same as those of `parseMeasurementCharacteristicDetails:`, plus the details added by the `UHNCGMController`: the date/time, session identifier, derived trend and trend arrow. These are passed as typed values to the initializer, so the details are immutable and can be read from any thread.
+ 
+ The offsets of the optional fields only depend on the flags, so they are looked up in a table of layouts rather than computed for each measurement. Only a truncated measurement falls back to computing them.
+ 
+ @discussion A copy returns the same instance. A mutable copy is a regular `NSMutableDictionary` with all fields decoded.
+ 
+ */
+@interface UHNCGMMeasurementDetails : NSDictionary
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize the measurement details
+ 
+ @param data The value of the measurement characteristic
+ @param crcPresent Indicates whether the characteristic includes the E2E-CRC field
+ 
+ @return The measurement details
+ 
+ */
+- (instancetype)initWithMeasurementData:(NSData*)data crcPresent:(BOOL)crcPresent;
+
+/**
+ Initialize the measurement details with the details added by the `UHNCGMController`
+ 
+ @param data The value of the measurement characteristic
+ @param crcPresent Indicates whether the characteristic includes the E2E-CRC field
+ @param sessionClock The clock of the session of the measurement, or nil if the session start time is not known
+ @param sessionID The identifier of the session of the measurement, or `NSNotFound` if not known
+ @param derivedTrend The trend derived from the recent measurements in (mg/dl)/min, or `NAN` if not known
+ @param trendArrow The trend arrow of the measurement
+ 
+ @return The measurement details
+ 
+ */
+- (instancetype)initWithMeasurementData:(NSData*)data
+                             crcPresent:(BOOL)crcPresent
+                           sessionClock:(UHNCGMSessionClock*)sessionClock
+                              sessionID:(NSUInteger)sessionID
+                           derivedTrend:(float)derivedTrend
+                             trendArrow:(CGMTrendArrowOption)trendArrow;
+
+///-------------------
+/// @name Typed Fields
+///-------------------
+
+/**
+ The flags of the measurement as `CGMMeasurementFlagOption`
+ */
+@property(nonatomic,readonly) uint8_t flags;
+
+/**
+ The glucose concentration in mg/dl
+ */
+@property(nonatomic,readonly) float glucoseConcentration;
+
+/**
+ The time offset from the session start time in minutes
+ */
+@property(nonatomic,readonly) NSUInteger timeOffset;
+
+/**
+ The packed sensor status annunciation, with the octets that are not present cleared
+ */
+@property(nonatomic,readonly) CGMSensorStatus sensorStatus;
+
+/**
+ The trend information in (mg/dl)/min, or `NAN` if not present
+ */
+@property(nonatomic,readonly) float trendInformation;
+
+/**
+ The measurement quality in %, or `NAN` if not present
+ */
+@property(nonatomic,readonly) float quality;
+
+///-------------------------
+/// @name Controller Details
+///-------------------------
+
+/**
+ The clock of the session of the measurement, which provides `kCGMKeyDateTime`, or nil if the session start time is not known
+ */
+@property(nonatomic,strong,readonly) UHNCGMSessionClock *sessionClock;
+
+/**
+ The identifier of the session of the measurement for `kCGMKeySessionID`, or `NSNotFound` if not known
+ */
+@property(nonatomic,readonly) NSUInteger sessionID;
+
+/**
+ The trend derived from the recent measurements in (mg/dl)/min for `kCGMMeasurementKeyDerivedTrendInfo`, or `NAN` if not known
+ */
+@property(nonatomic,readonly) float derivedTrend;
+
+/**
+ The trend arrow for `kCGMMeasurementKeyTrendArrow`, which is only present if passed to the initializer
+ */
+@property(nonatomic,readonly) CGMTrendArrowOption trendArrow;
+
+@end
@@ -0,0 +1,349 @@
+//
+//  UHNCGMMeasurementDetails.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMMeasurementDetails.h"
+#import "NSData+CGMCommands.h"
+
+// the keys in the order they are enumerated, with the bit of each key in the mask of present keys
+typedef NS_ENUM (NSUInteger, CGMMeasurementDetailsKey) {
+    CGMMeasurementDetailsKeyGlucoseConcentration = 0,
+    CGMMeasurementDetailsKeyTimeOffset,
+    CGMMeasurementDetailsKeySensorStatus,
+    CGMMeasurementDetailsKeyTrendInfo,
+    CGMMeasurementDetailsKeyQuality,
+    CGMMeasurementDetailsKeyCRCFailed,
+    CGMMeasurementDetailsKeyDateTime,
+    CGMMeasurementDetailsKeySessionID,
+    CGMMeasurementDetailsKeyDerivedTrendInfo,
+    CGMMeasurementDetailsKeyTrendArrow,
+    CGMMeasurementDetailsKeyCount,
+};
+
+static NSString * const kMeasurementDetailsKeys[CGMMeasurementDetailsKeyCount] = {
+    kCGMMeasurementKeyGlucoseConcentration,
+    kCGMKeyTimeOffset,
+    kCGMStatusKeySensorStatus,
+    kCGMMeasurementKeyTrendInfo,
+    kCGMMeasurementKeyQuality,
+    kCGMCRCFailed,
+    kCGMKeyDateTime,
+    kCGMKeySessionID,
+    kCGMMeasurementKeyDerivedTrendInfo,
+    kCGMMeasurementKeyTrendArrow,
+};
+
+static inline uint16_t CGMMeasurementUInt16(const uint8_t *bytes, NSUInteger index)
+{
+    return (uint16_t)(bytes[index] | (bytes[index + 1] << 8));
+}
+
+#pragma mark - Measurement Layout
+
+// the flags compressed to 5 bits: trend and quality in bits 0-1, warning, cal/temp and status in bits 2-4
+static inline NSUInteger CGMMeasurementLayoutIndex(uint8_t flags)
+{
+    return (flags & (CGMMeasurementFlagsTrendInformationPresent | CGMMeasurementFlagsQualityPresent)) |
+           ((flags & (CGMMeasurementFlagsWarningOctetPresent | CGMMeasurementFlagsCalTempOctetPresent | CGMMeasurementFlagsStatusOctetPresent)) >> 3);
+}
+
+// the fixed offsets of each combination of fields, which follow the time offset in the order of the parser
+#define CGM_LAYOUT_HAS(index, field)    (((index) >> (field)) & 1)
+#define CGM_LAYOUT_TREND(index)         CGM_LAYOUT_HAS(index, 0)
+#define CGM_LAYOUT_QUALITY(index)       CGM_LAYOUT_HAS(index, 1)
+#define CGM_LAYOUT_WARNING(index)       CGM_LAYOUT_HAS(index, 2)
+#define CGM_LAYOUT_CALTEMP(index)       CGM_LAYOUT_HAS(index, 3)
+#define CGM_LAYOUT_STATUS(index)        CGM_LAYOUT_HAS(index, 4)
+
+#define CGM_LAYOUT_STATUS_INDEX(index)  6   // NSMaxRange(kCGMMeasurementFieldRangeTimeOffset), as a constant expression
+#define CGM_LAYOUT_CALTEMP_INDEX(index) (CGM_LAYOUT_STATUS_INDEX(index) + CGM_LAYOUT_STATUS(index) * kCGMStatusFieldSizeOctet)
+#define CGM_LAYOUT_WARNING_INDEX(index) (CGM_LAYOUT_CALTEMP_INDEX(index) + CGM_LAYOUT_CALTEMP(index) * kCGMStatusFieldSizeOctet)
+#define CGM_LAYOUT_TREND_INDEX(index)   (CGM_LAYOUT_WARNING_INDEX(index) + CGM_LAYOUT_WARNING(index) * kCGMStatusFieldSizeOctet)
+#define CGM_LAYOUT_QUALITY_INDEX(index) (CGM_LAYOUT_TREND_INDEX(index) + CGM_LAYOUT_TREND(index) * kCGMMeasurementFieldSizeTrendInfo)
+#define CGM_LAYOUT_LENGTH(index)        (CGM_LAYOUT_QUALITY_INDEX(index) + CGM_LAYOUT_QUALITY(index) * kCGMMeasurementFieldSizeQuality)
+
+#define CGM_LAYOUT(index) {                                                 \
+    CGM_LAYOUT_STATUS(index) ? CGM_LAYOUT_STATUS_INDEX(index) : 0,          \
+    CGM_LAYOUT_CALTEMP(index) ? CGM_LAYOUT_CALTEMP_INDEX(index) : 0,        \
+    CGM_LAYOUT_WARNING(index) ? CGM_LAYOUT_WARNING_INDEX(index) : 0,        \
+    CGM_LAYOUT_TREND(index) ? CGM_LAYOUT_TREND_INDEX(index) : 0,            \
+    CGM_LAYOUT_QUALITY(index) ? CGM_LAYOUT_QUALITY_INDEX(index) : 0,        \
+    CGM_LAYOUT_LENGTH(index) }
+
+#define CGM_LAYOUTS_4(index)    CGM_LAYOUT(index), CGM_LAYOUT(index + 1), CGM_LAYOUT(index + 2), CGM_LAYOUT(index + 3)
+#define CGM_LAYOUTS_16(index)   CGM_LAYOUTS_4(index), CGM_LAYOUTS_4(index + 4), CGM_LAYOUTS_4(index + 8), CGM_LAYOUTS_4(index + 12)
+
+static const CGMMeasurementLayout kMeasurementLayouts[kCGMMeasurementLayoutCount] = {
+    CGM_LAYOUTS_16(0), CGM_LAYOUTS_16(16)
+};
+
+CGMMeasurementLayout CGMMeasurementLayoutForFlags(uint8_t flags)
+{
+    return kMeasurementLayouts[CGMMeasurementLayoutIndex(flags)];
+}
+
+CGMMeasurementLayout CGMMeasurementLayoutMake(uint8_t flags, NSUInteger length)
+{
+    CGMMeasurementLayout layout = {0};
+    NSUInteger index = NSMaxRange(kCGMMeasurementFieldRangeTimeOffset);
+    if ((flags & CGMMeasurementFlagsStatusOctetPresent) && index + kCGMStatusFieldSizeOctet <= length) {
+        layout.statusIndex = (uint8_t)index;
+        index += kCGMStatusFieldSizeOctet;
+    }
+    if ((flags & CGMMeasurementFlagsCalTempOctetPresent) && index + kCGMStatusFieldSizeOctet <= length) {
+        layout.calTempIndex = (uint8_t)index;
+        index += kCGMStatusFieldSizeOctet;
+    }
+    if ((flags & CGMMeasurementFlagsWarningOctetPresent) && index + kCGMStatusFieldSizeOctet <= length) {
+        layout.warningIndex = (uint8_t)index;
+        index += kCGMStatusFieldSizeOctet;
+    }
+    if ((flags & CGMMeasurementFlagsTrendInformationPresent) && index + kCGMMeasurementFieldSizeTrendInfo <= length) {
+        layout.trendIndex = (uint8_t)index;
+        index += kCGMMeasurementFieldSizeTrendInfo;
+    }
+    if ((flags & CGMMeasurementFlagsQualityPresent) && index + kCGMMeasurementFieldSizeQuality <= length) {
+        layout.qualityIndex = (uint8_t)index;
+        index += kCGMMeasurementFieldSizeQuality;
+    }
+    layout.length = (uint8_t)index;
+    return layout;
+}
+
+// the layout only depends on the flags, unless the measurement is truncated
+static inline CGMMeasurementLayout CGMMeasurementLayoutForBytes(const uint8_t *bytes, NSUInteger length)
+{
+    uint8_t flags = bytes[kCGMMeasurementFieldRangeFlags.location];
+    CGMMeasurementLayout layout = CGMMeasurementLayoutForFlags(flags);
+    return length < layout.length ? CGMMeasurementLayoutMake(flags, length) : layout;
+}
+
+CGMMeasurementFields CGMMeasurementFieldsFromData(NSData *data)
+{
+    uint8_t bytes[kCGMMeasurementMaxLength] = {0};
+    NSUInteger length = MIN(data.length, (NSUInteger)kCGMMeasurementMaxLength);
+    [data getBytes:bytes length:length];
+    CGMMeasurementLayout layout = CGMMeasurementLayoutForBytes(bytes, length);
+
+    CGMMeasurementFields fields;
+    fields.timeOffset = CGMMeasurementUInt16(bytes, kCGMMeasurementFieldRangeTimeOffset.location);
+    fields.glucoseConcentration = CGMFloatFromSFloat(CGMMeasurementUInt16(bytes, kCGMMeasurementFieldRangeGlucoseConcentration.location));
+    fields.trendInformation = layout.trendIndex ? CGMFloatFromSFloat(CGMMeasurementUInt16(bytes, layout.trendIndex)) : NAN;
+    return fields;
+}
+
+@interface UHNCGMMeasurementDetails ()
+{
+    uint8_t _bytes[kCGMMeasurementMaxLength];
+    CGMMeasurementLayout _layout;
+    BOOL _crcPresent;
+    BOOL _hasTrendArrow;
+}
+@end
+
+@implementation UHNCGMMeasurementDetails
+
+#pragma mark - Initialization
+
+- (instancetype)initWithMeasurementData:(NSData*)data crcPresent:(BOOL)crcPresent;
+{
+    if ((self = [super init])) {
+        NSUInteger length = MIN(data.length, (NSUInteger)kCGMMeasurementMaxLength);
+        memset(_bytes, 0, sizeof(_bytes));
+        [data getBytes:_bytes length:length];
+        _crcPresent = crcPresent;
+        _sessionID = NSNotFound;
+        _derivedTrend = NAN;
+        _layout = CGMMeasurementLayoutForBytes(_bytes, length);
+    }
+    return self;
+}
+
+- (instancetype)initWithMeasurementData:(NSData*)data
+                             crcPresent:(BOOL)crcPresent
+                           sessionClock:(UHNCGMSessionClock*)sessionClock
+                              sessionID:(NSUInteger)sessionID
+                           derivedTrend:(float)derivedTrend
+                             trendArrow:(CGMTrendArrowOption)trendArrow;
+{
+    if ((self = [self initWithMeasurementData:data crcPresent:crcPresent])) {
+        _sessionClock = sessionClock;
+        _sessionID = sessionID;
+        _derivedTrend = derivedTrend;
+        _trendArrow = trendArrow;
+        _hasTrendArrow = YES;
+    }
+    return self;
+}
+
+- (instancetype)initWithObjects:(const id [])objects forKeys:(const id<NSCopying> [])keys count:(NSUInteger)count;
+{
+    // reached from -[NSDictionary init], as the details are only backed by the measurement data
+    NSAssert(count == 0, @"%@ is only initialized with measurement data", NSStringFromClass([self class]));
+    return self;
+}
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    // all details are immutable
+    return self;
+}
+
+#pragma mark - Typed Fields
+
+- (uint8_t)flags;
+{
+    return _bytes[kCGMMeasurementFieldRangeFlags.location];
+}
+
+- (float)glucoseConcentration;
+{
+    return CGMFloatFromSFloat(CGMMeasurementUInt16(_bytes, kCGMMeasurementFieldRangeGlucoseConcentration.location));
+}
+
+- (NSUInteger)timeOffset;
+{
+    return CGMMeasurementUInt16(_bytes, kCGMMeasurementFieldRangeTimeOffset.location);
+}
+
+- (CGMSensorStatus)sensorStatus;
+{
+    return CGMSensorStatusMake(_layout.statusIndex ? _bytes[_layout.statusIndex] : 0,
+                               _layout.calTempIndex ? _bytes[_layout.calTempIndex] : 0,
+                               _layout.warningIndex ? _bytes[_layout.warningIndex] : 0);
+}
+
+- (float)trendInformation;
+{
+    return _layout.trendIndex ? CGMFloatFromSFloat(CGMMeasurementUInt16(_bytes, _layout.trendIndex)) : NAN;
+}
+
+- (float)quality;
+{
+    return _layout.qualityIndex ? CGMFloatFromSFloat(CGMMeasurementUInt16(_bytes, _layout.qualityIndex)) : NAN;
+}
+
+#pragma mark - NSDictionary Primitive Methods
+
+- (NSUInteger)count;
+{
+    return __builtin_popcount([self presentKeys]);
+}
+
+- (id)objectForKey:(id)key;
+{
+    NSUInteger detailsKey = [self detailsKeyForKey:key];
+    if (detailsKey == NSNotFound || !([self presentKeys] & (1 << detailsKey))) {
+        return nil;
+    }
+
+    switch (detailsKey) {
+        case CGMMeasurementDetailsKeyGlucoseConcentration:
+            return @(self.glucoseConcentration);
+        case CGMMeasurementDetailsKeyTimeOffset:
+            return @(self.timeOffset);
+        case CGMMeasurementDetailsKeySensorStatus:
+            return [self sensorStatusDictionary];
+        case CGMMeasurementDetailsKeyTrendInfo:
+            return @(self.trendInformation);
+        case CGMMeasurementDetailsKeyQuality:
+            return @(self.quality);
+        case CGMMeasurementDetailsKeyCRCFailed:
+            // TODO update CRC calculation
+            return @NO;
+        case CGMMeasurementDetailsKeyDateTime:
+            return [self.sessionClock dateForTimeOffset:self.timeOffset];
+        case CGMMeasurementDetailsKeySessionID:
+            return @(self.sessionID);
+        case CGMMeasurementDetailsKeyDerivedTrendInfo:
+            return @(self.derivedTrend);
+        case CGMMeasurementDetailsKeyTrendArrow:
+            return @(self.trendArrow);
+    }
+    return nil;
+}
+
+- (NSEnumerator*)keyEnumerator;
+{
+    NSString *keys[CGMMeasurementDetailsKeyCount];
+    NSUInteger count = 0;
+    NSUInteger presentKeys = [self presentKeys];
+    for (NSUInteger detailsKey = 0; detailsKey < CGMMeasurementDetailsKeyCount; detailsKey++) {
+        if (presentKeys & (1 << detailsKey)) {
+            keys[count++] = kMeasurementDetailsKeys[detailsKey];
+        }
+    }
+    return [[NSArray arrayWithObjects:keys count:count] objectEnumerator];
+}
+
+#pragma mark - Private Methods
+
+- (NSUInteger)presentKeys;
+{
+    NSUInteger presentKeys = (1 << CGMMeasurementDetailsKeyGlucoseConcentration) | (1 << CGMMeasurementDetailsKeyTimeOffset);
+    if (_layout.statusIndex || _layout.calTempIndex || _layout.warningIndex) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeySensorStatus);
+    }
+    if (_layout.trendIndex) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyTrendInfo);
+    }
+    if (_layout.qualityIndex) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyQuality);
+    }
+    if (_crcPresent) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyCRCFailed);
+    }
+    if (self.sessionClock) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyDateTime);
+    }
+    if (self.sessionID != NSNotFound) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeySessionID);
+    }
+    if (!isnan(self.derivedTrend)) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyDerivedTrendInfo);
+    }
+    if (_hasTrendArrow) {
+        presentKeys |= (1 << CGMMeasurementDetailsKeyTrendArrow);
+    }
+    return presentKeys;
+}
+
+- (NSUInteger)detailsKeyForKey:(id)key;
+{
+    // the keys are usually the same constant strings, so compare the pointers first
+    for (NSUInteger detailsKey = 0; detailsKey < CGMMeasurementDetailsKeyCount; detailsKey++) {
+        if (key == kMeasurementDetailsKeys[detailsKey]) {
+            return detailsKey;
+        }
+    }
+    if (![key isKindOfClass:[NSString class]]) {
+        return NSNotFound;
+    }
+    for (NSUInteger detailsKey = 0; detailsKey < CGMMeasurementDetailsKeyCount; detailsKey++) {
+        if ([key isEqualToString:kMeasurementDetailsKeys[detailsKey]]) {
+            return detailsKey;
+        }
+    }
+    return NSNotFound;
+}
+
+- (NSDictionary*)sensorStatusDictionary;
+{
+    NSMutableDictionary *sensorStatus = [NSMutableDictionary dictionaryWithCapacity:3];
+    if (_layout.statusIndex) {
+        sensorStatus[kCGMStatusKeyOctetStatus] = @(_bytes[_layout.statusIndex]);
+    }
+    if (_layout.calTempIndex) {
+        sensorStatus[kCGMStatusKeyOctetCalTemp] = @(_bytes[_layout.calTempIndex]);
+    }
+    if (_layout.warningIndex) {
+        sensorStatus[kCGMStatusKeyOctetWarning] = @(_bytes[_layout.warningIndex]);
+    }
+    return sensorStatus;
+}
+
+@end
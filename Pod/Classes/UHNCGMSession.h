@@ -0,0 +1,168 @@
+//
+//  UHNCGMSession.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMSessionClock.h"
+#import "UHNCGMGapDetector.h"
+
+/**
+ `UHNCGMSession` is a session of a CGM sensor, from the session start time until the session is stopped or another session is started on the sensor.
+ 
+ Each session keeps its own clock and an index of the time offsets of the records received, so a record can be assigned to a session and checked for duplicates without deriving the session boundaries from the record dates. The new records of the index also feed the gap detector of the session, so the missing ranges of a session are kept when another session becomes current, and backfills are reconciled against the records of their own session.
+ 
+ */
+@interface UHNCGMSession : NSObject
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a session
+ 
+ @param sessionID The identifier of the session, which is unique within its session manager
+ @param deviceIdentifier The identifier of the CGM sensor
+ @param startEpochTime The session start time in seconds since 1970
+ 
+ @return The session
+ 
+ */
+- (instancetype)initWithSessionID:(NSUInteger)sessionID
+                 deviceIdentifier:(NSString*)deviceIdentifier
+                   startEpochTime:(int64_t)startEpochTime;
+
+///-----------------
+/// @name Life Cycle
+///-----------------
+
+/**
+ The identifier of the session, which is attached to the records of the session with `kCGMKeySessionID`
+ */
+@property(nonatomic,readonly) NSUInteger sessionID;
+
+/**
+ The identifier of the CGM sensor
+ */
+@property(nonatomic,readonly) NSString *deviceIdentifier;
+
+/**
+ The clock converting the time offsets of the session
+ */
+@property(nonatomic,readonly) UHNCGMSessionClock *clock;
+
+/**
+ The session start time in seconds since 1970
+ */
+@property(nonatomic,readonly) int64_t startEpochTime;
+
+/**
+ The time the session was stopped in seconds since 1970, or `kCGMEpochTimeUnknown` while the session is active
+ */
+@property(nonatomic,readonly) int64_t stopEpochTime;
+
+/**
+ Indicates if the session has not been stopped
+ */
+@property(nonatomic,readonly) BOOL isActive;
+
+/**
+ The expected run time of the session in seconds as read from the CGM sensor, or 0 if not known
+ */
+@property(nonatomic,assign) NSTimeInterval runTime;
+
+/**
+ The status of the CGM sensor when the session was stopped, or nil if not known
+ */
+@property(nonatomic,copy) NSDictionary *statusAtStop;
+
+/**
+ Stop the session. A stopped session is not restarted
+ 
+ @param stopEpochTime The time the session was stopped in seconds since 1970
+ 
+ */
+- (void)stopAtEpochTime:(int64_t)stopEpochTime;
+
+/**
+ Check if a time falls within the session
+ 
+ @param epochTime The time in seconds since 1970
+ 
+ @return YES if the time is at or after the session start time and before the session was stopped, otherwise NO
+ 
+ */
+- (BOOL)containsEpochTime:(int64_t)epochTime;
+
+///--------------
+/// @name Records
+///--------------
+
+/**
+ Detector of the missing ranges of time offsets of the session
+ */
+@property(nonatomic,readonly) UHNCGMGapDetector *gapDetector;
+
+/**
+ Add a record to the index of the session. A new record is also added to the `gapDetector`
+ 
+ @param timeOffset The time offset of the record in minutes
+ 
+ @return YES if the session had no record with the time offset, otherwise NO
+ 
+ */
+- (BOOL)addRecordWithTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Check if a record was received
+ 
+ @param timeOffset The time offset of the record in minutes
+ 
+ @return YES if the session has a record with the time offset, otherwise NO
+ 
+ */
+- (BOOL)containsRecordWithTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ The number of records of the session
+ */
+@property(nonatomic,readonly) NSUInteger numberOfRecords;
+
+/**
+ The time offset of the newest record in minutes, or `NSNotFound` if the session has no records
+ */
+@property(nonatomic,readonly) NSUInteger newestTimeOffset;
+
+/**
+ The number of records received within a range of time offsets
+ 
+ @param range The range of time offsets in minutes
+ 
+ @return The number of records in the range
+ 
+ */
+- (NSUInteger)numberOfRecordsInRange:(NSRange)range;
+
+@end
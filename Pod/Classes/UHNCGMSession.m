@@ -0,0 +1,96 @@
+//
+//  UHNCGMSession.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMSession.h"
+#import "UHNCGMConstants.h"
+
+@interface UHNCGMSession ()
+@property(nonatomic,readwrite) NSUInteger sessionID;
+@property(nonatomic,strong,readwrite) NSString *deviceIdentifier;
+@property(nonatomic,strong,readwrite) UHNCGMSessionClock *clock;
+@property(nonatomic,readwrite) int64_t stopEpochTime;
+@property(nonatomic,strong) NSMutableIndexSet *recordTimeOffsets;
+@property(nonatomic,strong,readwrite) UHNCGMGapDetector *gapDetector;
+@end
+
+@implementation UHNCGMSession
+
+#pragma mark - Initialization
+
+- (instancetype)initWithSessionID:(NSUInteger)sessionID
+                 deviceIdentifier:(NSString*)deviceIdentifier
+                   startEpochTime:(int64_t)startEpochTime;
+{
+    if ((self = [super init])) {
+        self.sessionID = sessionID;
+        self.deviceIdentifier = deviceIdentifier;
+        self.clock = [[UHNCGMSessionClock alloc] initWithSessionStartEpochTime:startEpochTime];
+        self.stopEpochTime = kCGMEpochTimeUnknown;
+        self.recordTimeOffsets = [NSMutableIndexSet indexSet];
+        self.gapDetector = [[UHNCGMGapDetector alloc] init];
+    }
+    return self;
+}
+
+#pragma mark - Life Cycle
+
+- (int64_t)startEpochTime;
+{
+    return self.clock.sessionStartEpochTime;
+}
+
+- (BOOL)isActive;
+{
+    return self.stopEpochTime == kCGMEpochTimeUnknown;
+}
+
+- (void)stopAtEpochTime:(int64_t)stopEpochTime;
+{
+    if (self.isActive) {
+        self.stopEpochTime = MAX(stopEpochTime, self.startEpochTime);
+    }
+}
+
+- (BOOL)containsEpochTime:(int64_t)epochTime;
+{
+    return epochTime >= self.startEpochTime && (self.isActive || epochTime < self.stopEpochTime);
+}
+
+#pragma mark - Records
+
+- (BOOL)addRecordWithTimeOffset:(NSUInteger)timeOffset;
+{
+    if ([self.recordTimeOffsets containsIndex:timeOffset]) {
+        return NO;
+    }
+    [self.recordTimeOffsets addIndex:timeOffset];
+    [self.gapDetector addTimeOffset:timeOffset];
+    return YES;
+}
+
+- (BOOL)containsRecordWithTimeOffset:(NSUInteger)timeOffset;
+{
+    return [self.recordTimeOffsets containsIndex:timeOffset];
+}
+
+- (NSUInteger)numberOfRecords;
+{
+    return self.recordTimeOffsets.count;
+}
+
+- (NSUInteger)newestTimeOffset;
+{
+    return self.recordTimeOffsets.lastIndex;
+}
+
+- (NSUInteger)numberOfRecordsInRange:(NSRange)range;
+{
+    return [self.recordTimeOffsets countOfIndexesInRange:range];
+}
+
+@end
@@ -0,0 +1,114 @@
+//
+//  UHNCGMSessionClock.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+
+/**
+ The number of recently converted time offsets for which the `NSDate` is kept
+ */
+#define kCGMSessionClockDateCacheSize   4
+
+/**
+ `UHNCGMSessionClock` converts the time offsets of a CGM session to absolute times. It is created once per session start time, and converts with integer math on seconds since 1970 (epoch time).
+ 
+ `NSDate` objects are only created when asked for. The dates of the most recently converted time offsets are kept, so the measurement, status and glucose profile of a time offset share one date. The cache is guarded by a lock, so a clock can be used from any thread, e.g. by measurement details read on another queue.
+ 
+ */
+@interface UHNCGMSessionClock : NSObject
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a session clock
+ 
+ @param sessionStartEpochTime The session start time in seconds since 1970
+ 
+ @return The session clock
+ 
+ */
+- (instancetype)initWithSessionStartEpochTime:(int64_t)sessionStartEpochTime;
+
+///-------------------------
+/// @name Session Start Time
+///-------------------------
+
+/**
+ The session start time in seconds since 1970
+ */
+@property(nonatomic,readonly) int64_t sessionStartEpochTime;
+
+/**
+ The session start time, which is created the first time it is asked for
+ */
+@property(nonatomic,readonly) NSDate *sessionStartDate;
+
+///-------------------
+/// @name Time Offsets
+///-------------------
+
+/**
+ Convert a time offset to epoch time
+ 
+ @param timeOffset The time offset in minutes
+ 
+ @return The time in seconds since 1970
+ 
+ */
+- (int64_t)epochTimeForTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Convert a time offset to a date
+ 
+ @param timeOffset The time offset in minutes
+ 
+ @return The date, which is shared with the recent conversions of the same time offset
+ 
+ */
+- (NSDate*)dateForTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Convert an interval since the session start time to a date, for example the session run time
+ 
+ @param timeInterval The interval in seconds
+ 
+ @return The date
+ 
+ */
+- (NSDate*)dateForTimeIntervalSinceSessionStart:(NSTimeInterval)timeInterval;
+
+/**
+ Convert a date to a time offset
+ 
+ @param date The date
+ 
+ @return The time offset in whole minutes since the session start time, which is negative for a date before the session started
+ 
+ */
+- (NSInteger)timeOffsetForDate:(NSDate*)date;
+
+@end
@@ -0,0 +1,75 @@
+//
+//  UHNCGMSessionClock.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMSessionClock.h"
+#import "UHNCGMConstants.h"
+
+@interface UHNCGMSessionClock ()
+{
+    // direct-mapped by time offset
+    __strong NSDate *_cachedDates[kCGMSessionClockDateCacheSize];
+    NSUInteger _cachedTimeOffsets[kCGMSessionClockDateCacheSize];
+}
+@property(nonatomic,readwrite) int64_t sessionStartEpochTime;
+@property(nonatomic,strong) NSDate *cachedSessionStartDate;
+@end
+
+@implementation UHNCGMSessionClock
+
+#pragma mark - Initialization
+
+- (instancetype)initWithSessionStartEpochTime:(int64_t)sessionStartEpochTime;
+{
+    if ((self = [super init])) {
+        _sessionStartEpochTime = sessionStartEpochTime;
+    }
+    return self;
+}
+
+#pragma mark - Session Start Time
+
+- (NSDate*)sessionStartDate;
+{
+    @synchronized(self) {
+        if (!self.cachedSessionStartDate) {
+            self.cachedSessionStartDate = [NSDate dateWithTimeIntervalSince1970:self.sessionStartEpochTime];
+        }
+        return self.cachedSessionStartDate;
+    }
+}
+
+#pragma mark - Time Offsets
+
+- (int64_t)epochTimeForTimeOffset:(NSUInteger)timeOffset;
+{
+    return self.sessionStartEpochTime + (int64_t)timeOffset * kCGMSecondsInMinute;
+}
+
+- (NSDate*)dateForTimeOffset:(NSUInteger)timeOffset;
+{
+    NSUInteger index = timeOffset % kCGMSessionClockDateCacheSize;
+    @synchronized(self) {
+        if (!_cachedDates[index] || _cachedTimeOffsets[index] != timeOffset) {
+            _cachedDates[index] = [NSDate dateWithTimeIntervalSince1970:[self epochTimeForTimeOffset:timeOffset]];
+            _cachedTimeOffsets[index] = timeOffset;
+        }
+        return _cachedDates[index];
+    }
+}
+
+- (NSDate*)dateForTimeIntervalSinceSessionStart:(NSTimeInterval)timeInterval;
+{
+    return [NSDate dateWithTimeIntervalSince1970:self.sessionStartEpochTime + timeInterval];
+}
+
+- (NSInteger)timeOffsetForDate:(NSDate*)date;
+{
+    return (NSInteger)floor(([date timeIntervalSince1970] - self.sessionStartEpochTime) / kCGMSecondsInMinute);
+}
+
+@end
@@ -0,0 +1,126 @@
+//
+//  UHNCGMSessionManager.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMSession.h"
+
+/**
+ Number of seconds two session start times of a sensor can differ and still be the same session, e.g. when the start time is read again after a reconnect
+ */
+#define kCGMSessionStartTimeTolerance   60
+
+/**
+ `UHNCGMSessionManager` keeps the history of the sessions of one or more CGM sensors. Sessions are indexed by identifier, by sensor, and by start time, so the session of a record or a date is found without scanning the records.
+ 
+ A CGM sensor has at most one active session. When a new session start time is reported for a sensor, its active session is stopped at the new start time, whether or not the sensor supports multiple sessions.
+ 
+ */
+@interface UHNCGMSessionManager : NSObject
+
+///-------------------
+/// @name Life Cycle
+///-------------------
+
+/**
+ Find the session of a sensor with a session start time, or begin a new session if there is none
+
+ @discussion A session that started within `kCGMSessionStartTimeTolerance` of the start time is returned, and keeps its own start time and clock
+ 
+ @param startEpochTime The session start time in seconds since 1970
+ @param deviceIdentifier The identifier of the CGM sensor
+ 
+ @return The session
+ 
+ */
+- (UHNCGMSession*)sessionWithStartEpochTime:(int64_t)startEpochTime deviceIdentifier:(NSString*)deviceIdentifier;
+
+/**
+ Stop the active session of a sensor, if any
+ 
+ @param deviceIdentifier The identifier of the CGM sensor
+ @param stopEpochTime The time the session was stopped in seconds since 1970
+ 
+ @return The stopped session, or nil if the sensor had no active session
+ 
+ */
+- (UHNCGMSession*)stopActiveSessionForDeviceIdentifier:(NSString*)deviceIdentifier atEpochTime:(int64_t)stopEpochTime;
+
+/**
+ Remove all sessions. Session identifiers are not reused
+ */
+- (void)removeAllSessions;
+
+///--------------
+/// @name Queries
+///--------------
+
+/**
+ All sessions in the order they were begun
+ */
+@property(nonatomic,readonly) NSArray *sessions;
+
+/**
+ The session with an identifier
+ 
+ @param sessionID The identifier of the session
+ 
+ @return The session, or nil if there is none
+ 
+ */
+- (UHNCGMSession*)sessionWithID:(NSUInteger)sessionID;
+
+/**
+ The active session of a sensor
+ 
+ @param deviceIdentifier The identifier of the CGM sensor
+ 
+ @return The session, or nil if the sensor has no active session
+ 
+ */
+- (UHNCGMSession*)activeSessionForDeviceIdentifier:(NSString*)deviceIdentifier;
+
+/**
+ The sessions of a sensor
+ 
+ @param deviceIdentifier The identifier of the CGM sensor
+ 
+ @return The sessions in ascending order of start time
+ 
+ */
+- (NSArray*)sessionsForDeviceIdentifier:(NSString*)deviceIdentifier;
+
+/**
+ The session of a sensor that a time falls within
+ 
+ @param deviceIdentifier The identifier of the CGM sensor
+ @param epochTime The time in seconds since 1970
+ 
+ @return The session, or nil if the time falls outside the sessions of the sensor
+ 
+ */
+- (UHNCGMSession*)sessionForDeviceIdentifier:(NSString*)deviceIdentifier atEpochTime:(int64_t)epochTime;
+
+@end
@@ -0,0 +1,138 @@
+//
+//  UHNCGMSessionManager.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMSessionManager.h"
+#import "UHNCGMConstants.h"
+
+@interface UHNCGMSessionManager ()
+@property(nonatomic,strong) NSMutableArray *allSessions;
+@property(nonatomic,strong) NSMutableDictionary *sessionsByID;
+// sessions of each sensor in ascending order of start time
+@property(nonatomic,strong) NSMutableDictionary *sessionsByDevice;
+@property(nonatomic,assign) NSUInteger lastSessionID;
+@end
+
+@implementation UHNCGMSessionManager
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        self.allSessions = [NSMutableArray array];
+        self.sessionsByID = [NSMutableDictionary dictionary];
+        self.sessionsByDevice = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+#pragma mark - Life Cycle
+
+- (UHNCGMSession*)sessionWithStartEpochTime:(int64_t)startEpochTime deviceIdentifier:(NSString*)deviceIdentifier;
+{
+    NSMutableArray *deviceSessions = [self mutableSessionsForDeviceIdentifier:deviceIdentifier];
+    // a session start time read again can be shifted by the clock of the sensor, so a close start time is the same session.
+    // Without a session within the tolerance, the index is also where a new session is inserted
+    NSUInteger index = [self indexOfFirstSessionIn:deviceSessions startingAtOrAfter:startEpochTime - kCGMSessionStartTimeTolerance];
+    if (index < deviceSessions.count && [deviceSessions[index] startEpochTime] <= startEpochTime + kCGMSessionStartTimeTolerance) {
+        return deviceSessions[index];
+    }
+
+    UHNCGMSession *session = [[UHNCGMSession alloc] initWithSessionID:++self.lastSessionID
+                                                     deviceIdentifier:deviceIdentifier
+                                                       startEpochTime:startEpochTime];
+    if (index == deviceSessions.count) {
+        // a sensor has one active session, which ends when the next one starts
+        [self stopActiveSessionForDeviceIdentifier:deviceIdentifier atEpochTime:startEpochTime];
+    } else {
+        // an older session reported later ended when the next known session started
+        [session stopAtEpochTime:[deviceSessions[index] startEpochTime]];
+    }
+    [deviceSessions insertObject:session atIndex:index];
+    [self.allSessions addObject:session];
+    self.sessionsByID[@(session.sessionID)] = session;
+    return session;
+}
+
+- (UHNCGMSession*)stopActiveSessionForDeviceIdentifier:(NSString*)deviceIdentifier atEpochTime:(int64_t)stopEpochTime;
+{
+    UHNCGMSession *session = [self activeSessionForDeviceIdentifier:deviceIdentifier];
+    [session stopAtEpochTime:stopEpochTime];
+    return session;
+}
+
+- (void)removeAllSessions;
+{
+    [self.allSessions removeAllObjects];
+    [self.sessionsByID removeAllObjects];
+    [self.sessionsByDevice removeAllObjects];
+}
+
+#pragma mark - Queries
+
+- (NSArray*)sessions;
+{
+    return [self.allSessions copy];
+}
+
+- (UHNCGMSession*)sessionWithID:(NSUInteger)sessionID;
+{
+    return self.sessionsByID[@(sessionID)];
+}
+
+- (UHNCGMSession*)activeSessionForDeviceIdentifier:(NSString*)deviceIdentifier;
+{
+    // only the newest session of a sensor can be active
+    UHNCGMSession *session = [self.sessionsByDevice[deviceIdentifier] lastObject];
+    return session.isActive ? session : nil;
+}
+
+- (NSArray*)sessionsForDeviceIdentifier:(NSString*)deviceIdentifier;
+{
+    return [self.sessionsByDevice[deviceIdentifier] copy] ?: @[];
+}
+
+- (UHNCGMSession*)sessionForDeviceIdentifier:(NSString*)deviceIdentifier atEpochTime:(int64_t)epochTime;
+{
+    NSArray *deviceSessions = self.sessionsByDevice[deviceIdentifier];
+    NSUInteger index = [self indexOfFirstSessionIn:deviceSessions startingAtOrAfter:epochTime + 1];
+    if (index == 0) {
+        return nil;
+    }
+    UHNCGMSession *session = deviceSessions[index - 1];
+    return [session containsEpochTime:epochTime] ? session : nil;
+}
+
+#pragma mark - Private Methods
+
+- (NSMutableArray*)mutableSessionsForDeviceIdentifier:(NSString*)deviceIdentifier;
+{
+    NSMutableArray *deviceSessions = self.sessionsByDevice[deviceIdentifier];
+    if (!deviceSessions) {
+        deviceSessions = [NSMutableArray array];
+        self.sessionsByDevice[deviceIdentifier] = deviceSessions;
+    }
+    return deviceSessions;
+}
+
+- (NSUInteger)indexOfFirstSessionIn:(NSArray*)deviceSessions startingAtOrAfter:(int64_t)epochTime;
+{
+    NSUInteger low = 0;
+    NSUInteger high = deviceSessions.count;
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if ([deviceSessions[middle] startEpochTime] < epochTime) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+@end
@@ -0,0 +1,187 @@
+//
+//  UHNCGMSettings.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+
+///---------------------------
+/// @name Settings Definitions
+///---------------------------
+/**
+ The CGM sensor settings kept by `UHNCGMSettings`
+ */
+typedef NS_ENUM (NSUInteger, CGMSetting) {
+    /** The communication interval in minutes */
+    CGMSettingCommunicationInterval = 0,
+    /** The patient high alert level */
+    CGMSettingAlertLevelPatientHigh,
+    /** The patient low alert level */
+    CGMSettingAlertLevelPatientLow,
+    /** The hypo alert level */
+    CGMSettingAlertLevelHypo,
+    /** The hyper alert level */
+    CGMSettingAlertLevelHyper,
+    /** The rate of decrease alert level */
+    CGMSettingAlertLevelRateDecrease,
+    /** The rate of increase alert level */
+    CGMSettingAlertLevelRateIncrease,
+};
+
+/**
+ The number of CGM sensor settings
+ */
+#define kCGMSettingCount                7
+
+/**
+ `UHNCGMSettings` is a snapshot of the settings of the CGM sensor, so the settings can be read without a CGMCP procedure each time.
+ 
+ A refresh requests the value of each supported setting one after another, skipping the settings that the CGM sensor features do not support. Only one CGMCP procedure can be in progress, so each request is sent as soon as the previous one completes. A setting that is rejected as not supported is skipped by later refreshes.
+ 
+ A value written to the CGM sensor is kept once the CGM sensor confirms it, so the snapshot stays current without reading the setting back.
+ 
+ */
+@interface UHNCGMSettings : NSObject
+
+///-------------------------
+/// @name Supported Settings
+///-------------------------
+
+/**
+ The features of the CGM sensor as `CGMFeatureOption` flags. Until the features are read, all settings are assumed to be supported
+ */
+@property(nonatomic,assign) NSUInteger supportedFeatures;
+
+/**
+ Determine if a setting is supported by the CGM sensor
+ 
+ @param setting The setting
+ 
+ @return YES if the setting is supported by the features and was not rejected by the CGM sensor, otherwise NO
+ 
+ */
+- (BOOL)isSettingSupported:(CGMSetting)setting;
+
+///-------------
+/// @name Values
+///-------------
+
+/**
+ Determine if the value of a setting is known
+ 
+ @param setting The setting
+ 
+ @return YES if the value was read from or confirmed by the CGM sensor, otherwise NO
+ 
+ */
+- (BOOL)hasValueForSetting:(CGMSetting)setting;
+
+/**
+ The value of a setting
+ 
+ @param setting The setting
+ 
+ @return The value, or NAN if not known
+ 
+ */
+- (float)valueForSetting:(CGMSetting)setting;
+
+/**
+ Remove all values and forget the supported settings, e.g. when connecting to another CGM sensor
+ */
+- (void)reset;
+
+///--------------------
+/// @name CGMCP Updates
+///--------------------
+
+/**
+ Update the value of a setting from a CGMCP response
+ 
+ @param value The value of the response
+ @param responseOpCode The op code of the response
+ 
+ */
+- (void)updateValue:(float)value forResponseOpCode:(CGMCPOpCode)responseOpCode;
+
+/**
+ Keep the value of a setting that is being written, until the CGM sensor confirms it
+ 
+ @param value The value written to the CGM sensor
+ @param requestOpCode The op code of the request
+ 
+ */
+- (void)willSetValue:(float)value forRequestOpCode:(CGMCPOpCode)requestOpCode;
+
+/**
+ Handle a successful CGMCP procedure, keeping the value written by the request if any
+ 
+ @param requestOpCode The op code of the request
+ 
+ */
+- (void)didSucceedRequestOpCode:(CGMCPOpCode)requestOpCode;
+
+/**
+ Handle a failed CGMCP procedure. A setting not supported by the CGM sensor is skipped from then on
+ 
+ @param requestOpCode The op code of the request
+ @param responseCode The response code of the failure
+ 
+ */
+- (void)didFailRequestOpCode:(CGMCPOpCode)requestOpCode responseCode:(CGMCPResponseCode)responseCode;
+
+///--------------
+/// @name Refresh
+///--------------
+
+/**
+ Indicates if a refresh is in progress
+ */
+@property(nonatomic,readonly) BOOL isRefreshing;
+
+/**
+ The CGMCP op code of the request of the refresh in progress, or `NSNotFound`
+ */
+@property(nonatomic,readonly) NSUInteger requestedOpCode;
+
+/**
+ Begin a refresh of all supported settings
+ */
+- (void)beginRefresh;
+
+/**
+ The op code of the next request of a refresh
+ 
+ @return The CGMCP op code to request, or `NSNotFound` if the refresh is completed
+ 
+ */
+- (NSUInteger)nextOpCodeToRequest;
+
+/**
+ Cancel the refresh in progress, e.g. when the CGM sensor disconnects. The values read so far are kept
+ */
+- (void)cancelRefresh;
+
+@end
@@ -0,0 +1,174 @@
+//
+//  UHNCGMSettings.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMSettings.h"
+
+// the CGMCP set op code of each setting, which is followed by its get and response op codes
+static const CGMCPOpCode kSettingSetOpCodes[kCGMSettingCount] = {
+    CGMCPOpCodeCommIntervalSet,
+    CGMCPOpCodeAlertLevelPatientHighSet,
+    CGMCPOpCodeAlertLevelPatientLowSet,
+    CGMCPOpCodeAlertLevelHypoSet,
+    CGMCPOpCodeAlertLevelHyperSet,
+    CGMCPOpCodeAlertLevelRateDecreaseSet,
+    CGMCPOpCodeAlertLevelRateIncreaseSet,
+};
+
+// the CGM feature required by each setting
+static const NSUInteger kSettingFeatures[kCGMSettingCount] = {
+    0,
+    CGMFeatureSupportedAlertLowHighPatient,
+    CGMFeatureSupportedAlertLowHighPatient,
+    CGMFeatureSupportedAlertHypo,
+    CGMFeatureSupportedAlertHyper,
+    CGMFeatureSupportedAlertIncreaseDecreaseRate,
+    CGMFeatureSupportedAlertIncreaseDecreaseRate,
+};
+
+static NSUInteger CGMSettingForOpCode(CGMCPOpCode opCode, NSUInteger position)
+{
+    for (NSUInteger setting = 0; setting < kCGMSettingCount; setting++) {
+        if (kSettingSetOpCodes[setting] + position == opCode) {
+            return setting;
+        }
+    }
+    return NSNotFound;
+}
+
+@interface UHNCGMSettings ()
+{
+    float _values[kCGMSettingCount];
+}
+@property(nonatomic,readwrite) BOOL isRefreshing;
+@property(nonatomic,assign) NSUInteger refreshSetting;
+@property(nonatomic,readwrite) NSUInteger requestedOpCode;
+@property(nonatomic,assign) NSUInteger unsupportedSettings;
+@property(nonatomic,assign) NSUInteger pendingSetting;
+@property(nonatomic,assign) float pendingValue;
+@end
+
+@implementation UHNCGMSettings
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        [self reset];
+    }
+    return self;
+}
+
+- (void)reset;
+{
+    for (NSUInteger setting = 0; setting < kCGMSettingCount; setting++) {
+        _values[setting] = NAN;
+    }
+    self.supportedFeatures = NSUIntegerMax;
+    self.unsupportedSettings = 0;
+    self.pendingSetting = NSNotFound;
+    self.isRefreshing = NO;
+    self.requestedOpCode = NSNotFound;
+}
+
+#pragma mark - Supported Settings
+
+- (BOOL)isSettingSupported:(CGMSetting)setting;
+{
+    if (setting >= kCGMSettingCount || (self.unsupportedSettings & (1 << setting))) {
+        return NO;
+    }
+    return (self.supportedFeatures & kSettingFeatures[setting]) == kSettingFeatures[setting];
+}
+
+#pragma mark - Values
+
+- (BOOL)hasValueForSetting:(CGMSetting)setting;
+{
+    return setting < kCGMSettingCount && !isnan(_values[setting]);
+}
+
+- (float)valueForSetting:(CGMSetting)setting;
+{
+    return setting < kCGMSettingCount ? _values[setting] : NAN;
+}
+
+#pragma mark - CGMCP Updates
+
+- (void)updateValue:(float)value forResponseOpCode:(CGMCPOpCode)responseOpCode;
+{
+    NSUInteger setting = CGMSettingForOpCode(responseOpCode, 2);
+    if (setting != NSNotFound) {
+        _values[setting] = value;
+    }
+}
+
+- (void)willSetValue:(float)value forRequestOpCode:(CGMCPOpCode)requestOpCode;
+{
+    self.pendingSetting = CGMSettingForOpCode(requestOpCode, 0);
+    self.pendingValue = value;
+}
+
+- (void)didSucceedRequestOpCode:(CGMCPOpCode)requestOpCode;
+{
+    NSUInteger setting = CGMSettingForOpCode(requestOpCode, 0);
+    if (setting != NSNotFound && setting == self.pendingSetting) {
+        _values[setting] = self.pendingValue;
+        self.pendingSetting = NSNotFound;
+    }
+}
+
+- (void)didFailRequestOpCode:(CGMCPOpCode)requestOpCode responseCode:(CGMCPResponseCode)responseCode;
+{
+    // both the set and get op code of a setting tell if it is supported
+    NSUInteger setting = CGMSettingForOpCode(requestOpCode, 0);
+    if (setting == NSNotFound) {
+        setting = CGMSettingForOpCode(requestOpCode, 1);
+    } else if (setting == self.pendingSetting) {
+        self.pendingSetting = NSNotFound;
+    }
+    if (setting != NSNotFound && responseCode == CGMCPOpCodeNotSupported) {
+        self.unsupportedSettings |= (1 << setting);
+    }
+}
+
+#pragma mark - Refresh
+
+- (void)beginRefresh;
+{
+    self.isRefreshing = YES;
+    self.refreshSetting = NSNotFound;
+    self.requestedOpCode = NSNotFound;
+}
+
+- (NSUInteger)nextOpCodeToRequest;
+{
+    if (!self.isRefreshing) {
+        return NSNotFound;
+    }
+    NSUInteger setting = (self.refreshSetting == NSNotFound) ? 0 : self.refreshSetting + 1;
+    while (setting < kCGMSettingCount && ![self isSettingSupported:setting]) {
+        setting++;
+    }
+    if (setting == kCGMSettingCount) {
+        self.isRefreshing = NO;
+        self.requestedOpCode = NSNotFound;
+        return NSNotFound;
+    }
+    self.refreshSetting = setting;
+    self.requestedOpCode = kSettingSetOpCodes[setting] + 1;
+    return self.requestedOpCode;
+}
+
+- (void)cancelRefresh;
+{
+    self.isRefreshing = NO;
+    self.requestedOpCode = NSNotFound;
+}
+
+@end
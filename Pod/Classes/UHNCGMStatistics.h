@@ -0,0 +1,171 @@
+//
+//  UHNCGMStatistics.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+///----------------------------
+/// @name Statistics Definitions
+///----------------------------
+/**
+ Default glycemic thresholds (mg/dl) used until the alert levels have been read from the CGM sensor. Values follow the international consensus on time in range.
+ */
+#define kCGMStatisticsDefaultLevelHypo              54.
+#define kCGMStatisticsDefaultLevelPatientLow        70.
+#define kCGMStatisticsDefaultLevelPatientHigh       180.
+#define kCGMStatisticsDefaultLevelHyper             250.
+
+/**
+ Two readings further apart than this (in minutes) are not considered part of the same hypo episode
+ */
+#define kCGMStatisticsEpisodeGapInMinutes           15
+
+/**
+ All supported sliding windows with their length in minutes
+ */
+typedef NS_ENUM (NSUInteger, CGMStatisticsWindow) {
+    /** Sliding window covering the last 24 hours */
+    CGMStatisticsWindowDay          = 24 * 60,
+    /** Sliding window covering the last 7 days */
+    CGMStatisticsWindowWeek         = 7 * 24 * 60,
+    /** Sliding window covering the last 14 days */
+    CGMStatisticsWindowTwoWeeks     = 14 * 24 * 60,
+};
+
+/**
+ Glycemic summary of a sliding window. Glucose values are in mg/dl and times in range are fractions between 0 and 1.
+ */
+typedef struct CGMGlycemicSummary {
+    /** Number of readings in the window */
+    NSUInteger numberOfReadings;
+    /** Mean glucose concentration */
+    double meanGlucose;
+    /** Standard deviation of the glucose concentration */
+    double standardDeviation;
+    /** Coefficient of variation (standard deviation / mean) */
+    double coefficientOfVariation;
+    /** Glucose management indicator in % */
+    double glucoseManagementIndicator;
+    /** Fraction of readings below the hypo level */
+    double timeBelowHypo;
+    /** Fraction of readings below the patient low level (includes readings below the hypo level) */
+    double timeBelowRange;
+    /** Fraction of readings within the patient low and high levels (inclusive) */
+    double timeInRange;
+    /** Fraction of readings above the patient high level (includes readings above the hyper level) */
+    double timeAboveRange;
+    /** Fraction of readings above the hyper level */
+    double timeAboveHyper;
+    /** Number of hypo episodes (runs of consecutive readings below the hypo level) */
+    NSUInteger numberOfHypoEpisodes;
+} CGMGlycemicSummary;
+
+/**
+ `UHNCGMStatistics` maintains glycemic statistics of the measurement stream incrementally. Each reading is added in O(1) and the 24 hour, 7 day and 14 day sliding windows evict old readings as time advances, so a summary can be queried at any time without iterating the history.
+
+ Readings are keyed by their time offset (in minutes), which allows backfilled records to be added out of order. A reading for a time offset that is already known is ignored, so overlapping record transfers do not skew the statistics.
+
+ @discussion The `UHNCGMController` feeds its `statistics` with every measurement and updates the thresholds with the alert levels read from the CGM sensor.
+
+ */
+@interface UHNCGMStatistics : NSObject
+
+///-------------------------
+/// @name Glycemic Thresholds
+///-------------------------
+
+/**
+ The hypo level (mg/dl). Default is `kCGMStatisticsDefaultLevelHypo`
+ */
+@property(nonatomic,assign) float levelHypo;
+
+/**
+ The patient low level (mg/dl), which is the lower bound of the target range. Default is `kCGMStatisticsDefaultLevelPatientLow`
+ */
+@property(nonatomic,assign) float levelPatientLow;
+
+/**
+ The patient high level (mg/dl), which is the upper bound of the target range. Default is `kCGMStatisticsDefaultLevelPatientHigh`
+ */
+@property(nonatomic,assign) float levelPatientHigh;
+
+/**
+ The hyper level (mg/dl). Default is `kCGMStatisticsDefaultLevelHyper`
+
+ @discussion Changing any of the thresholds reclassifies the readings currently held in the windows
+ */
+@property(nonatomic,assign) float levelHyper;
+
+///------------------------
+/// @name Adding Readings
+///------------------------
+
+/**
+ Add a glucose reading
+
+ @param glucoseConcentration The glucose concentration in mg/dl
+ @param timeOffset The time offset of the reading in minutes
+
+ @return YES if the reading was added, NO if it was ignored
+
+ @discussion Readings older than the longest window or for an already known time offset are ignored
+
+ */
+- (BOOL)addGlucoseConcentration:(float)glucoseConcentration atTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Add the glucose reading of a measurement
+
+ @param measurementDetails The measurement details as reported by the `UHNCGMController`
+
+ @return YES if the reading was added, NO if it was ignored
+
+ */
+- (BOOL)addMeasurementDetails:(NSDictionary*)measurementDetails;
+
+/**
+ Remove all the readings, keeping the thresholds
+ */
+- (void)reset;
+
+///-----------------------
+/// @name Querying Results
+///-----------------------
+
+/**
+ The time offset of the newest reading in minutes, or `NSNotFound` if no reading was added
+ */
+@property(nonatomic,readonly) NSUInteger newestTimeOffset;
+
+/**
+ Summary of the readings in the sliding window
+
+ @param window The sliding window of interest
+
+ @return The glycemic summary of the window. All values are 0 if there are no readings in the window
+
+ */
+- (CGMGlycemicSummary)summaryForWindow:(CGMStatisticsWindow)window;
+
+@end
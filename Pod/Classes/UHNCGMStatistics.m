@@ -0,0 +1,332 @@
+//
+//  UHNCGMStatistics.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMStatistics.h"
+#import "UHNCGMConstants.h"
+
+#define kCGMStatisticsNumberOfWindows   3
+#define kCGMStatisticsCapacity          CGMStatisticsWindowTwoWeeks
+
+typedef struct CGMStatisticsWindowState {
+    NSUInteger length;
+    NSUInteger lowerBound;
+    NSUInteger count;
+    double sum;
+    double sumOfSquares;
+    NSUInteger belowHypo;
+    NSUInteger belowRange;
+    NSUInteger inRange;
+    NSUInteger aboveRange;
+    NSUInteger aboveHyper;
+    NSUInteger hypoEpisodes;
+} CGMStatisticsWindowState;
+
+@interface UHNCGMStatistics ()
+{
+    // one slot per minute, indexed by time offset modulo the capacity. NAN marks an empty slot
+    float *_readings;
+    CGMStatisticsWindowState _windows[kCGMStatisticsNumberOfWindows];
+}
+@property(nonatomic,readwrite) NSUInteger newestTimeOffset;
+@end
+
+@implementation UHNCGMStatistics
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    if ((self = [super init])) {
+        _readings = malloc(kCGMStatisticsCapacity * sizeof(float));
+        _levelHypo = kCGMStatisticsDefaultLevelHypo;
+        _levelPatientLow = kCGMStatisticsDefaultLevelPatientLow;
+        _levelPatientHigh = kCGMStatisticsDefaultLevelPatientHigh;
+        _levelHyper = kCGMStatisticsDefaultLevelHyper;
+        [self reset];
+    }
+    return self;
+}
+
+- (void)dealloc;
+{
+    free(_readings);
+}
+
+- (void)reset;
+{
+    for (NSUInteger index = 0; index < kCGMStatisticsCapacity; index++) {
+        _readings[index] = NAN;
+    }
+    CGMStatisticsWindow windows[kCGMStatisticsNumberOfWindows] = {CGMStatisticsWindowDay, CGMStatisticsWindowWeek, CGMStatisticsWindowTwoWeeks};
+    for (NSUInteger index = 0; index < kCGMStatisticsNumberOfWindows; index++) {
+        memset(&_windows[index], 0, sizeof(CGMStatisticsWindowState));
+        _windows[index].length = windows[index];
+    }
+    self.newestTimeOffset = NSNotFound;
+}
+
+#pragma mark - Thresholds
+
+- (void)setLevelHypo:(float)levelHypo;
+{
+    _levelHypo = levelHypo;
+    [self recalculateWindows];
+}
+
+- (void)setLevelPatientLow:(float)levelPatientLow;
+{
+    _levelPatientLow = levelPatientLow;
+    [self recalculateWindows];
+}
+
+- (void)setLevelPatientHigh:(float)levelPatientHigh;
+{
+    _levelPatientHigh = levelPatientHigh;
+    [self recalculateWindows];
+}
+
+- (void)setLevelHyper:(float)levelHyper;
+{
+    _levelHyper = levelHyper;
+    [self recalculateWindows];
+}
+
+#pragma mark - Adding Readings
+
+- (BOOL)addMeasurementDetails:(NSDictionary*)measurementDetails;
+{
+    NSNumber *glucoseConcentration = measurementDetails[kCGMMeasurementKeyGlucoseConcentration];
+    NSNumber *timeOffset = measurementDetails[kCGMKeyTimeOffset];
+    if (glucoseConcentration && timeOffset) {
+        return [self addGlucoseConcentration:[glucoseConcentration floatValue] atTimeOffset:[timeOffset unsignedIntegerValue]];
+    }
+    return NO;
+}
+
+- (BOOL)addGlucoseConcentration:(float)glucoseConcentration atTimeOffset:(NSUInteger)timeOffset;
+{
+    if (isnan(glucoseConcentration) || isinf(glucoseConcentration)) {
+        return NO;
+    }
+
+    if (self.newestTimeOffset == NSNotFound || timeOffset > self.newestTimeOffset) {
+        [self advanceToTimeOffset:timeOffset];
+    } else if (timeOffset < _windows[kCGMStatisticsNumberOfWindows - 1].lowerBound) {
+        // older than the longest window
+        return NO;
+    }
+
+    NSUInteger slot = timeOffset % kCGMStatisticsCapacity;
+    if (!isnan(_readings[slot])) {
+        // duplicate reading
+        return NO;
+    }
+
+    // the episode count depends on whether the next reading starts an episode, which the new reading may change
+    BOOL nextStartedEpisode[kCGMStatisticsNumberOfWindows];
+    NSUInteger nextTimeOffset = [self timeOffsetOfReadingAfter:timeOffset];
+    for (NSUInteger index = 0; index < kCGMStatisticsNumberOfWindows; index++) {
+        nextStartedEpisode[index] = (nextTimeOffset != NSNotFound && [self readingAtTimeOffset:nextTimeOffset startsEpisodeInWindow:&_windows[index]]);
+    }
+
+    _readings[slot] = glucoseConcentration;
+
+    for (NSUInteger index = 0; index < kCGMStatisticsNumberOfWindows; index++) {
+        CGMStatisticsWindowState *window = &_windows[index];
+        if (timeOffset < window->lowerBound) {
+            continue;
+        }
+        [self addGlucoseConcentration:glucoseConcentration toWindow:window];
+        if ([self readingAtTimeOffset:timeOffset startsEpisodeInWindow:window]) {
+            window->hypoEpisodes++;
+        }
+        if (nextTimeOffset != NSNotFound) {
+            BOOL nextStartsEpisode = [self readingAtTimeOffset:nextTimeOffset startsEpisodeInWindow:window];
+            window->hypoEpisodes = window->hypoEpisodes + nextStartsEpisode - nextStartedEpisode[index];
+        }
+    }
+    return YES;
+}
+
+#pragma mark - Querying Results
+
+- (CGMGlycemicSummary)summaryForWindow:(CGMStatisticsWindow)window;
+{
+    CGMGlycemicSummary summary;
+    memset(&summary, 0, sizeof(CGMGlycemicSummary));
+
+    CGMStatisticsWindowState *state = [self stateForWindow:window];
+    if (!state || state->count == 0) {
+        return summary;
+    }
+
+    double count = state->count;
+    double mean = state->sum / count;
+    double variance = (state->sumOfSquares / count) - (mean * mean);
+    summary.numberOfReadings = state->count;
+    summary.meanGlucose = mean;
+    summary.standardDeviation = (variance > 0 ? sqrt(variance) : 0);
+    summary.coefficientOfVariation = (mean > 0 ? summary.standardDeviation / mean : 0);
+    summary.glucoseManagementIndicator = 3.31 + 0.02392 * mean;
+    summary.timeBelowHypo = state->belowHypo / count;
+    summary.timeBelowRange = state->belowRange / count;
+    summary.timeInRange = state->inRange / count;
+    summary.timeAboveRange = state->aboveRange / count;
+    summary.timeAboveHyper = state->aboveHyper / count;
+    summary.numberOfHypoEpisodes = state->hypoEpisodes;
+    return summary;
+}
+
+#pragma mark - Private Methods
+
+- (CGMStatisticsWindowState*)stateForWindow:(CGMStatisticsWindow)window;
+{
+    for (NSUInteger index = 0; index < kCGMStatisticsNumberOfWindows; index++) {
+        if (_windows[index].length == window) {
+            return &_windows[index];
+        }
+    }
+    return NULL;
+}
+
+- (void)addGlucoseConcentration:(float)glucoseConcentration toWindow:(CGMStatisticsWindowState*)window;
+{
+    window->count++;
+    window->sum += glucoseConcentration;
+    window->sumOfSquares += (double)glucoseConcentration * glucoseConcentration;
+    window->belowHypo += (glucoseConcentration < self.levelHypo);
+    window->belowRange += (glucoseConcentration < self.levelPatientLow);
+    window->inRange += (glucoseConcentration >= self.levelPatientLow && glucoseConcentration <= self.levelPatientHigh);
+    window->aboveRange += (glucoseConcentration > self.levelPatientHigh);
+    window->aboveHyper += (glucoseConcentration > self.levelHyper);
+}
+
+- (void)removeGlucoseConcentration:(float)glucoseConcentration fromWindow:(CGMStatisticsWindowState*)window;
+{
+    window->count--;
+    window->sum -= glucoseConcentration;
+    window->sumOfSquares -= (double)glucoseConcentration * glucoseConcentration;
+    window->belowHypo -= (glucoseConcentration < self.levelHypo);
+    window->belowRange -= (glucoseConcentration < self.levelPatientLow);
+    window->inRange -= (glucoseConcentration >= self.levelPatientLow && glucoseConcentration <= self.levelPatientHigh);
+    window->aboveRange -= (glucoseConcentration > self.levelPatientHigh);
+    window->aboveHyper -= (glucoseConcentration > self.levelHyper);
+}
+
+- (float)readingAtTimeOffset:(NSUInteger)timeOffset;
+{
+    return _readings[timeOffset % kCGMStatisticsCapacity];
+}
+
+- (NSUInteger)timeOffsetOfReadingAfter:(NSUInteger)timeOffset;
+{
+    // only readings within the episode gap can be affected by this reading
+    NSUInteger lastTimeOffset = MIN(self.newestTimeOffset, timeOffset + kCGMStatisticsEpisodeGapInMinutes);
+    for (NSUInteger nextTimeOffset = timeOffset + 1; nextTimeOffset <= lastTimeOffset; nextTimeOffset++) {
+        if (!isnan([self readingAtTimeOffset:nextTimeOffset])) {
+            return nextTimeOffset;
+        }
+    }
+    return NSNotFound;
+}
+
+- (BOOL)readingAtTimeOffset:(NSUInteger)timeOffset startsEpisodeInWindow:(CGMStatisticsWindowState*)window;
+{
+    // a hypo reading starts an episode unless the previous reading in the window is within the gap and also hypo
+    if (timeOffset < window->lowerBound || !([self readingAtTimeOffset:timeOffset] < self.levelHypo)) {
+        return NO;
+    }
+    NSUInteger firstTimeOffset = MAX(window->lowerBound, (timeOffset > kCGMStatisticsEpisodeGapInMinutes ? timeOffset - kCGMStatisticsEpisodeGapInMinutes : 0));
+    for (NSUInteger previousTimeOffset = timeOffset; previousTimeOffset > firstTimeOffset; previousTimeOffset--) {
+        float previousReading = [self readingAtTimeOffset:previousTimeOffset - 1];
+        if (!isnan(previousReading)) {
+            return !(previousReading < self.levelHypo);
+        }
+    }
+    return YES;
+}
+
+- (void)advanceToTimeOffset:(NSUInteger)timeOffset;
+{
+    NSUInteger previousNewestTimeOffset = self.newestTimeOffset;
+    self.newestTimeOffset = timeOffset;
+
+    // evict from the longest window first, so stale slots are cleared before the shorter windows scan ahead.
+    // The shorter windows only evict readings the longest window has cleared if they empty completely
+    for (NSUInteger index = kCGMStatisticsNumberOfWindows; index-- > 0;) {
+        CGMStatisticsWindowState *window = &_windows[index];
+        NSUInteger lowerBound = (timeOffset + 1 > window->length ? timeOffset + 1 - window->length : 0);
+        BOOL clearsSlots = (index == kCGMStatisticsNumberOfWindows - 1);
+
+        if (previousNewestTimeOffset == NSNotFound || lowerBound > previousNewestTimeOffset) {
+            // every reading leaves the window
+            if (clearsSlots) {
+                [self reset];
+                self.newestTimeOffset = timeOffset;
+                for (NSUInteger windowIndex = 0; windowIndex < kCGMStatisticsNumberOfWindows; windowIndex++) {
+                    CGMStatisticsWindowState *resetWindow = &_windows[windowIndex];
+                    resetWindow->lowerBound = (timeOffset + 1 > resetWindow->length ? timeOffset + 1 - resetWindow->length : 0);
+                }
+                return;
+            }
+            NSUInteger length = window->length;
+            memset(window, 0, sizeof(CGMStatisticsWindowState));
+            window->length = length;
+            window->lowerBound = lowerBound;
+            continue;
+        }
+
+        while (window->lowerBound < lowerBound) {
+            NSUInteger evictedTimeOffset = window->lowerBound;
+            float evictedReading = [self readingAtTimeOffset:evictedTimeOffset];
+            if (!isnan(evictedReading)) {
+                // the oldest hypo reading in a window always starts an episode, which ends here unless the
+                // next reading continues it and therefore becomes the start of the episode
+                BOOL evictedStartedEpisode = [self readingAtTimeOffset:evictedTimeOffset startsEpisodeInWindow:window];
+                NSUInteger nextTimeOffset = [self timeOffsetOfReadingAfter:evictedTimeOffset];
+                BOOL nextStartedEpisode = (nextTimeOffset != NSNotFound && [self readingAtTimeOffset:nextTimeOffset startsEpisodeInWindow:window]);
+
+                [self removeGlucoseConcentration:evictedReading fromWindow:window];
+                window->lowerBound++;
+                if (clearsSlots) {
+                    _readings[evictedTimeOffset % kCGMStatisticsCapacity] = NAN;
+                }
+
+                BOOL nextStartsEpisode = (nextTimeOffset != NSNotFound && [self readingAtTimeOffset:nextTimeOffset startsEpisodeInWindow:window]);
+                window->hypoEpisodes = window->hypoEpisodes - evictedStartedEpisode - nextStartedEpisode + nextStartsEpisode;
+            } else {
+                window->lowerBound++;
+            }
+        }
+    }
+}
+
+- (void)recalculateWindows;
+{
+    if (self.newestTimeOffset == NSNotFound) {
+        return;
+    }
+    for (NSUInteger index = 0; index < kCGMStatisticsNumberOfWindows; index++) {
+        CGMStatisticsWindowState *window = &_windows[index];
+        NSUInteger length = window->length;
+        NSUInteger lowerBound = window->lowerBound;
+        memset(window, 0, sizeof(CGMStatisticsWindowState));
+        window->length = length;
+        window->lowerBound = lowerBound;
+        for (NSUInteger timeOffset = lowerBound; timeOffset <= self.newestTimeOffset; timeOffset++) {
+            float reading = [self readingAtTimeOffset:timeOffset];
+            if (isnan(reading)) {
+                continue;
+            }
+            [self addGlucoseConcentration:reading toWindow:window];
+            window->hypoEpisodes += [self readingAtTimeOffset:timeOffset startsEpisodeInWindow:window];
+        }
+    }
+}
+
+@end
@@ -0,0 +1,124 @@
+//
+//  UHNCGMStatus.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+#import "UHNCGMSession.h"
+
+///--------------------------
+/// @name Sensor Status Flags
+///--------------------------
+/**
+ The sensor status annunciation packed in one integer: the status octet in bits 0-7, the cal/temp octet in bits 8-15 and the warning octet in bits 16-23
+ */
+typedef uint32_t CGMSensorStatus;
+
+#define kCGMSensorStatusShiftStatus     0
+#define kCGMSensorStatusShiftCalTemp    8
+#define kCGMSensorStatusShiftWarning    16
+
+/**
+ Pack the three octets of the sensor status annunciation
+ */
+static inline CGMSensorStatus CGMSensorStatusMake(uint8_t statusOctet, uint8_t calTempOctet, uint8_t warningOctet)
+{
+    return ((CGMSensorStatus)statusOctet << kCGMSensorStatusShiftStatus) |
+           ((CGMSensorStatus)calTempOctet << kCGMSensorStatusShiftCalTemp) |
+           ((CGMSensorStatus)warningOctet << kCGMSensorStatusShiftWarning);
+}
+
+/**
+ Determine if any of the status flags is set
+ */
+static inline BOOL CGMSensorStatusHasStatus(CGMSensorStatus sensorStatus, CGMStatusStatusOptions options)
+{
+    return (sensorStatus & ((CGMSensorStatus)options << kCGMSensorStatusShiftStatus)) != 0;
+}
+
+/**
+ Determine if any of the cal/temp flags is set
+ */
+static inline BOOL CGMSensorStatusHasCalTemp(CGMSensorStatus sensorStatus, CGMStatusCalTempOption options)
+{
+    return (sensorStatus & ((CGMSensorStatus)options << kCGMSensorStatusShiftCalTemp)) != 0;
+}
+
+/**
+ Determine if any of the warning flags is set
+ */
+static inline BOOL CGMSensorStatusHasWarning(CGMSensorStatus sensorStatus, CGMStatusWarningOption options)
+{
+    return (sensorStatus & ((CGMSensorStatus)options << kCGMSensorStatusShiftWarning)) != 0;
+}
+
+/**
+ `UHNCGMStatus` is an immutable record of the CGM status characteristic, with the sensor status annunciation packed in one integer.
+ 
+ The flags are tested with `CGMSensorStatusHasStatus`, `CGMSensorStatusHasCalTemp` and `CGMSensorStatusHasWarning`, which are inlined, instead of a dictionary lookup per flag.
+ 
+ */
+@interface UHNCGMStatus : NSObject <NSCopying>
+
+///---------------------
+/// @name Initialization
+///---------------------
+
+/**
+ Initialize a status record
+ 
+ @param data The value of the CGM status characteristic
+ @param session The session of the status, or nil if the session start time is not known
+ 
+ @return The status record
+ 
+ */
+- (instancetype)initWithStatusData:(NSData*)data session:(UHNCGMSession*)session;
+
+///-------------
+/// @name Status
+///-------------
+
+/**
+ The time offset from the session start time in minutes
+ */
+@property(nonatomic,readonly) uint16_t timeOffset;
+
+/**
+ The packed sensor status annunciation
+ */
+@property(nonatomic,readonly) CGMSensorStatus sensorStatus;
+
+/**
+ The identifier of the session of the status, or `NSNotFound` if not known
+ */
+@property(nonatomic,readonly) NSUInteger sessionID;
+
+/**
+ The date/time of the status, or nil if the session start time is not known
+ */
+@property(nonatomic,readonly) NSDate *date;
+
+@end
@@ -0,0 +1,48 @@
+//
+//  UHNCGMStatus.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMStatus.h"
+
+@interface UHNCGMStatus ()
+@property(nonatomic,strong) UHNCGMSessionClock *clock;
+@end
+
+@implementation UHNCGMStatus
+
+#pragma mark - Initialization
+
+- (instancetype)initWithStatusData:(NSData*)data session:(UHNCGMSession*)session;
+{
+    if ((self = [super init])) {
+        // the time offset and the status octets, without the E2E-CRC
+        uint8_t bytes[5] = {0};
+        [data getBytes:bytes length:MIN(data.length, sizeof(bytes))];
+        _timeOffset = (uint16_t)(bytes[kCGMStatusFieldRangeTimeOffset.location] | (bytes[kCGMStatusFieldRangeTimeOffset.location + 1] << 8));
+
+        // the octets are in the order of the parser: status, cal/temp and warning
+        NSUInteger index = kCGMStatusFieldRangeStatus.location;
+        _sensorStatus = CGMSensorStatusMake(bytes[index], bytes[index + 1], bytes[index + 2]);
+        _sessionID = session ? session.sessionID : NSNotFound;
+        _clock = session.clock;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone*)zone;
+{
+    return self;
+}
+
+#pragma mark - Status
+
+- (NSDate*)date;
+{
+    return [self.clock dateForTimeOffset:self.timeOffset];
+}
+
+@end
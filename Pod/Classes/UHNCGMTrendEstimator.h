@@ -0,0 +1,101 @@
+//
+//  UHNCGMTrendEstimator.h
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import "UHNCGMConstants.h"
+
+///----------------------------------
+/// @name Trend Estimator Definitions
+///----------------------------------
+/**
+ Default length (in minutes) of the window of readings used to estimate the rate of change
+ */
+#define kCGMTrendEstimatorDefaultWindowInMinutes    15
+
+/**
+ Maximum length (in minutes) of the window of readings used to estimate the rate of change
+ */
+#define kCGMTrendEstimatorMaximumWindowInMinutes    60
+
+/**
+ Minimum number of readings in the window before a rate of change is estimated
+ */
+#define kCGMTrendEstimatorMinimumNumberOfReadings   3
+
+/**
+ `UHNCGMTrendEstimator` estimates the rate of change of the glucose concentration from the measurement stream, for CGM sensors that do not report trend information. The rate of change is the slope of a least squares fit over the readings within a sliding window, maintained with running sums so each reading is processed in O(1).
+
+ @discussion Readings are expected in order of time offset. A reading older than the newest reading (e.g. the start of a stored records transfer) restarts the estimation.
+
+ */
+@interface UHNCGMTrendEstimator : NSObject
+
+/**
+ UHNCGMTrendEstimator is initialized with the length of the sliding window
+
+ @param windowInMinutes The length of the sliding window in minutes. Limited to `kCGMTrendEstimatorMaximumWindowInMinutes`
+
+ @return Instance of a UHNCGMTrendEstimator
+
+ */
+- (instancetype)initWithWindow:(NSUInteger)windowInMinutes;
+
+/**
+ The length of the sliding window in minutes. Default is `kCGMTrendEstimatorDefaultWindowInMinutes`
+ */
+@property(nonatomic,readonly) NSUInteger windowInMinutes;
+
+/**
+ The current rate of change in (mg/dl)/min, or `NAN` if there are not enough readings in the window
+ */
+@property(nonatomic,readonly) float rateOfChange;
+
+/**
+ Add a glucose reading and update the rate of change
+
+ @param glucoseConcentration The glucose concentration in mg/dl
+ @param timeOffset The time offset of the reading in minutes
+
+ @return The rate of change in (mg/dl)/min, or `NAN` if there are not enough readings in the window
+
+ */
+- (float)addGlucoseConcentration:(float)glucoseConcentration atTimeOffset:(NSUInteger)timeOffset;
+
+/**
+ Remove all the readings
+ */
+- (void)reset;
+
+/**
+ Classify a rate of change into a trend arrow
+
+ @param rateOfChange The rate of change in (mg/dl)/min
+
+ @return The trend arrow of the rate of change, or `CGMTrendArrowUnknown` if the rate of change is `NAN`
+
+ */
++ (CGMTrendArrowOption)trendArrowForRateOfChange:(float)rateOfChange;
+
+@end
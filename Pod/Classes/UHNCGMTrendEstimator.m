@@ -0,0 +1,151 @@
+//
+//  UHNCGMTrendEstimator.m
+//  UHNCGMController
+//
+//  Created by eHealth Innovation on 2026-10-19.
+//  Copyright (c) 2026 University Health Network.
+//
+
+#import "UHNCGMTrendEstimator.h"
+
+#define kCGMTrendEstimatorCapacity (kCGMTrendEstimatorMaximumWindowInMinutes + 1)
+
+typedef struct CGMTrendReading {
+    NSUInteger timeOffset;
+    float glucoseConcentration;
+} CGMTrendReading;
+
+@interface UHNCGMTrendEstimator ()
+{
+    // readings in the window, oldest first, starting at _firstIndex
+    CGMTrendReading _readings[kCGMTrendEstimatorCapacity];
+    NSUInteger _firstIndex;
+    NSUInteger _count;
+
+    // running sums of the least squares fit. Times are relative to _referenceTimeOffset
+    double _sumTime;
+    double _sumGlucose;
+    double _sumTimeSquared;
+    double _sumTimeGlucose;
+    NSUInteger _referenceTimeOffset;
+}
+@property(nonatomic,readwrite) NSUInteger windowInMinutes;
+@property(nonatomic,readwrite) float rateOfChange;
+@end
+
+@implementation UHNCGMTrendEstimator
+
+#pragma mark - Initialization
+
+- (instancetype)init;
+{
+    return [self initWithWindow:kCGMTrendEstimatorDefaultWindowInMinutes];
+}
+
+- (instancetype)initWithWindow:(NSUInteger)windowInMinutes;
+{
+    if ((self = [super init])) {
+        self.windowInMinutes = MAX(MIN(windowInMinutes, kCGMTrendEstimatorMaximumWindowInMinutes), 1);
+        [self reset];
+    }
+    return self;
+}
+
+- (void)reset;
+{
+    _firstIndex = 0;
+    _count = 0;
+    _sumTime = 0;
+    _sumGlucose = 0;
+    _sumTimeSquared = 0;
+    _sumTimeGlucose = 0;
+    self.rateOfChange = NAN;
+}
+
+#pragma mark - Estimation
+
+- (float)addGlucoseConcentration:(float)glucoseConcentration atTimeOffset:(NSUInteger)timeOffset;
+{
+    // e.g. the SFLOAT special values, which would poison the running sums
+    if (!isfinite(glucoseConcentration)) {
+        return self.rateOfChange;
+    }
+
+    if (_count > 0) {
+        NSUInteger newestTimeOffset = _readings[(_firstIndex + _count - 1) % kCGMTrendEstimatorCapacity].timeOffset;
+        if (timeOffset == newestTimeOffset) {
+            return self.rateOfChange;
+        } else if (timeOffset < newestTimeOffset) {
+            [self reset];
+        }
+    }
+    if (_count == 0) {
+        _referenceTimeOffset = timeOffset;
+    }
+
+    // evict the readings that leave the window
+    while (_count > 0 && _readings[_firstIndex].timeOffset + self.windowInMinutes < timeOffset) {
+        [self updateSumsWithReading:_readings[_firstIndex] sign:-1];
+        _firstIndex = (_firstIndex + 1) % kCGMTrendEstimatorCapacity;
+        _count--;
+    }
+    if (_count == 0) {
+        // restart the sums to avoid accumulating rounding errors
+        [self reset];
+        _referenceTimeOffset = timeOffset;
+    }
+
+    CGMTrendReading reading = {timeOffset, glucoseConcentration};
+    _readings[(_firstIndex + _count) % kCGMTrendEstimatorCapacity] = reading;
+    _count++;
+    [self updateSumsWithReading:reading sign:1];
+
+    self.rateOfChange = [self slope];
+    return self.rateOfChange;
+}
+
++ (CGMTrendArrowOption)trendArrowForRateOfChange:(float)rateOfChange;
+{
+    if (isnan(rateOfChange)) {
+        return CGMTrendArrowUnknown;
+    } else if (rateOfChange >= kCGMTrendArrowThresholdRapid) {
+        return CGMTrendArrowRisingRapidly;
+    } else if (rateOfChange >= kCGMTrendArrowThresholdModerate) {
+        return CGMTrendArrowRising;
+    } else if (rateOfChange >= kCGMTrendArrowThresholdSlight) {
+        return CGMTrendArrowRisingSlightly;
+    } else if (rateOfChange > -1 * kCGMTrendArrowThresholdSlight) {
+        return CGMTrendArrowFlat;
+    } else if (rateOfChange > -1 * kCGMTrendArrowThresholdModerate) {
+        return CGMTrendArrowFallingSlightly;
+    } else if (rateOfChange > -1 * kCGMTrendArrowThresholdRapid) {
+        return CGMTrendArrowFalling;
+    }
+    return CGMTrendArrowFallingRapidly;
+}
+
+#pragma mark - Private Methods
+
+- (void)updateSumsWithReading:(CGMTrendReading)reading sign:(double)sign;
+{
+    double time = (double)reading.timeOffset - (double)_referenceTimeOffset;
+    _sumTime += sign * time;
+    _sumGlucose += sign * reading.glucoseConcentration;
+    _sumTimeSquared += sign * time * time;
+    _sumTimeGlucose += sign * time * reading.glucoseConcentration;
+}
+
+- (float)slope;
+{
+    if (_count < kCGMTrendEstimatorMinimumNumberOfReadings) {
+        return NAN;
+    }
+    double count = _count;
+    double denominator = count * _sumTimeSquared - _sumTime * _sumTime;
+    if (fabs(denominator) < DBL_EPSILON) {
+        return NAN;
+    }
+    return (float)((count * _sumTimeGlucose - _sumTime * _sumGlucose) / denominator);
+}
+
+@end